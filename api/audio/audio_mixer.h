@@ -12,9 +12,11 @@
 #define API_AUDIO_AUDIO_MIXER_H_
 
 #include <cstddef>
+#include <optional>
 
 #include "api/audio/audio_frame.h"
 #include "api/ref_count.h"
+#include "api/rtp_headers.h"
 
 namespace webrtc {
 
@@ -48,6 +50,24 @@ class AudioMixer : public RefCountInterface {
     // with this sample rate or higher will not cause quality loss.
     virtual int PreferredSampleRate() const = 0;
 
+    // The audio level that the sender signaled for the most recently
+    // received audio, in the audio level RTP header extension (RFC 6464), or
+    // nullopt if the source never signaled one. A source that stopped
+    // signaling its level reports digital silence (127). Lets a mixer
+    // that only mixes the loudest sources rank them without decoding any
+    // audio.
+    virtual std::optional<AudioLevel> LastReceivedAudioLevel() const {
+      return std::nullopt;
+    }
+
+    // Called instead of GetAudioFrameWithInfo() for 10 ms of audio that will
+    // not be mixed. The source must still advance, e.g. keep its jitter
+    // buffer and playout timing in step, but may skip producing the audio.
+    virtual void SkipAudioFrame(int sample_rate_hz) {
+      AudioFrame audio_frame;
+      GetAudioFrameWithInfo(sample_rate_hz, &audio_frame);
+    }
+
     virtual ~Source() {}
   };
 
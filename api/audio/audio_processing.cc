@@ -135,6 +135,8 @@ std::string AudioProcessing::Config::ToString() const {
           << pipeline.maximum_internal_processing_rate
           << ", multi_channel_render: " << pipeline.multi_channel_render
           << ", multi_channel_capture: " << pipeline.multi_channel_capture
+          << ", capture_processing_threads: "
+          << pipeline.capture_processing_threads
           << " }, pre_amplifier: { enabled: " << pre_amplifier.enabled
           << ", fixed_gain_factor: " << pre_amplifier.fixed_gain_factor
           << " },capture_level_adjustment: { enabled: "
@@ -162,6 +162,12 @@ class RTC_EXPORT AudioProcessing : public RefCountInterface {
       // Indicates how to downmix multi-channel capture audio to mono (when
       // needed).
       DownmixMethod capture_downmix_method = DownmixMethod::kAverageChannels;
+      // Number of threads, including the capture thread, across which the
+      // per-channel capture processing of AEC3 and the noise suppressor is
+      // split. The output does not depend on the number of threads. Only pays
+      // off for multi-channel capture, as the threads are synchronized for
+      // every 64 sample block.
+      int capture_processing_threads = 1;
     } pipeline;
 
     // Enabled the pre-amplifier. It amplifies the capture signal
@@ -962,6 +962,16 @@ class RTC_EXPORT PeerConnectionInterface : public webrtc::RefCountInterface {
   // receiver. https://w3c.github.io/webrtc-pc/#dom-rtcrtpreceiver-getstats
   virtual void GetStats(scoped_refptr<RtpReceiverInterface> selector,
                         scoped_refptr<RTCStatsCollectorCallback> callback) = 0;
+  // Spec-compliant getStats() that only needs to include the stats of the
+  // given `stats_types`, as returned by RTCStats::type() (e.g. "outbound-rtp"
+  // or "candidate-pair"). Gathering fewer stats is cheaper than producing the
+  // full report when e.g. only RTP stream stats are polled frequently. The
+  // report may still contain stats of other types; the default implementation
+  // delivers the full report.
+  virtual void GetStats(const std::vector<std::string>& stats_types,
+                        scoped_refptr<RTCStatsCollectorCallback> callback) {
+    GetStats(callback.get());
+  }
   // Clear cached stats in the RTCStatsCollector.
   virtual void ClearStatsCache() {}
 
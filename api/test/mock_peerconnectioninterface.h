@@ -127,6 +127,11 @@ class MockPeerConnectionInterface : public webrtc::PeerConnectionInterface {
               (webrtc::scoped_refptr<RtpReceiverInterface>,
                webrtc::scoped_refptr<RTCStatsCollectorCallback>),
               (override));
+  MOCK_METHOD(void,
+              GetStats,
+              (const std::vector<std::string>&,
+               webrtc::scoped_refptr<RTCStatsCollectorCallback>),
+              (override));
   MOCK_METHOD(void, ClearStatsCache, (), (override));
   MOCK_METHOD(scoped_refptr<SctpTransportInterface>,
               GetSctpTransport,
@@ -0,0 +1,34 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/frame_buffer_memory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rtc_base/memory/size_class_allocator.h"
+
+namespace webrtc {
+
+// Aligning pointer to 64 bytes for improved performance, e.g. use SIMD.
+static_assert(SizeClassAllocator::kAlignment >= 64);
+
+void FrameBufferMemoryDeleter::operator()(uint8_t* data) const {
+  SizeClassAllocator::Global().Free(data, size_, uncached_);
+}
+
+FrameBufferMemory AllocateFrameBufferMemory(size_t size) {
+  SizeClassAllocator::Block block = SizeClassAllocator::Global().Allocate(size);
+  FrameBufferMemoryDeleter deleter(block.get_deleter().size(),
+                                   block.get_deleter().uncached());
+  return FrameBufferMemory(block.release(), deleter);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,46 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_FRAME_BUFFER_MEMORY_H_
+#define API_VIDEO_FRAME_BUFFER_MEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Deleter of the pixel memory of I420Buffer and NV12Buffer. The memory is
+// recycled by an allocator that is an implementation detail of
+// frame_buffer_memory.cc, so the deleter only carries what that allocator
+// needs to take it back.
+class RTC_EXPORT FrameBufferMemoryDeleter {
+ public:
+  FrameBufferMemoryDeleter() = default;
+  FrameBufferMemoryDeleter(size_t size, bool uncached)
+      : size_(size), uncached_(uncached) {}
+
+  void operator()(uint8_t* data) const;
+
+ private:
+  size_t size_ = 0;
+  bool uncached_ = false;
+};
+
+using FrameBufferMemory = std::unique_ptr<uint8_t, FrameBufferMemoryDeleter>;
+
+// Returns at least `size` bytes aligned to 64 bytes.
+RTC_EXPORT FrameBufferMemory AllocateFrameBufferMemory(size_t size);
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_FRAME_BUFFER_MEMORY_H_
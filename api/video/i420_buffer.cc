@@ -17,19 +17,16 @@
 
 #include "api/make_ref_counted.h"
 #include "api/scoped_refptr.h"
+#include "api/video/frame_buffer_memory.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_rotation.h"
 #include "rtc_base/checks.h"
-#include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "third_party/libyuv/include/libyuv/convert.h"
 #include "third_party/libyuv/include/libyuv/planar_functions.h"
 #include "third_party/libyuv/include/libyuv/rotate.h"
 #include "third_party/libyuv/include/libyuv/scale.h"
 
-// Aligning pointer to 64 bytes for improved performance, e.g. use SIMD.
-static const int kBufferAlignment = 64;
-
 namespace webrtc {
 
 namespace {
@@ -61,9 +58,8 @@ I420Buffer::I420Buffer(int width,
       stride_y_(stride_y),
       stride_u_(stride_u),
       stride_v_(stride_v),
-      data_(static_cast<uint8_t*>(AlignedMalloc(
-          I420DataSize(width, height, stride_y, stride_u, stride_v),
-          kBufferAlignment))) {
+      data_(AllocateFrameBufferMemory(
+          I420DataSize(width, height, stride_y, stride_u, stride_v))) {
   RTC_DCHECK_GE(stride_u, (width + 1) / 2);
   RTC_DCHECK_GE(stride_v, (width + 1) / 2);
 }
@@ -16,9 +16,9 @@
 #include <memory>
 
 #include "api/scoped_refptr.h"
+#include "api/video/frame_buffer_memory.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_rotation.h"
-#include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -110,7 +110,7 @@ class RTC_EXPORT I420Buffer : public I420BufferInterface {
   const int stride_y_;
   const int stride_u_;
   const int stride_v_;
-  const std::unique_ptr<uint8_t, AlignedFreeDeleter> data_;
+  const FrameBufferMemory data_;
 };
 
 }  // namespace webrtc
@@ -16,10 +16,10 @@
 
 #include "api/make_ref_counted.h"
 #include "api/scoped_refptr.h"
+#include "api/video/frame_buffer_memory.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame_buffer.h"
 #include "rtc_base/checks.h"
-#include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "third_party/libyuv/include/libyuv/convert.h"
 #include "third_party/libyuv/include/libyuv/convert_from.h"
@@ -29,8 +29,6 @@ namespace webrtc {
 
 namespace {
 
-static const int kBufferAlignment = 64;
-
 int NV12DataSize(int width, int height, int stride_y, int stride_uv) {
   CheckValidDimensions(width, height, stride_y, stride_uv, stride_uv);
   int64_t h = height, y = stride_y, uv = stride_uv;
@@ -47,9 +45,8 @@ NV12Buffer::NV12Buffer(int width, int height, int stride_y, int stride_uv)
       height_(height),
       stride_y_(stride_y),
       stride_uv_(stride_uv),
-      data_(static_cast<uint8_t*>(
-          AlignedMalloc(NV12DataSize(width, height, stride_y, stride_uv),
-                        kBufferAlignment))) {
+      data_(AllocateFrameBufferMemory(
+          NV12DataSize(width, height, stride_y, stride_uv))) {
   RTC_DCHECK_GE(stride_uv, width + width % 2);
 }
 
@@ -16,8 +16,8 @@
 #include <memory>
 
 #include "api/scoped_refptr.h"
+#include "api/video/frame_buffer_memory.h"
 #include "api/video/video_frame_buffer.h"
-#include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -77,7 +77,7 @@ class RTC_EXPORT NV12Buffer : public NV12BufferInterface {
   const int height_;
   const int stride_y_;
   const int stride_uv_;
-  const std::unique_ptr<uint8_t, AlignedFreeDeleter> data_;
+  const FrameBufferMemory data_;
 };
 
 }  // namespace webrtc
@@ -91,6 +91,11 @@ namespace {
 
 constexpr double kAudioSampleDurationSeconds = 0.01;
 
+// How long a signaled audio level is reported after the packet carrying it
+// was received. Longer than the 400 ms between packets of Opus DTX, so that
+// a stream in discontinuous transmission keeps its level.
+constexpr TimeDelta kReceivedAudioLevelTimeout = TimeDelta::Millis(500);
+
 // Video Sync.
 constexpr int kVoiceEngineMinMinPlayoutDelayMs = 0;
 constexpr int kVoiceEngineMaxMinPlayoutDelayMs = 10000;
@@ -199,6 +204,9 @@ class ChannelReceive : public ChannelReceiveInterface,
 
   int PreferredSampleRate() const override;
 
+  std::optional<webrtc::AudioLevel> LastReceivedAudioLevel() const override;
+  void SkipAudioFrame(int sample_rate_hz) override;
+
   std::vector<RtpSource> GetSources() const override;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
@@ -227,6 +235,10 @@ class ChannelReceive : public ChannelReceiveInterface,
 
   int GetRtpTimestampRateHz() const;
 
+  // Computes the elapsed and NTP time of `audio_frame`, fresh out of NetEq,
+  // and reports its packets to the source tracker.
+  void UpdateTiming(AudioFrame* audio_frame);
+
   void OnReceivedPayloadData(ArrayView<const uint8_t> payload,
                              const RTPHeader& rtpHeader,
                              Timestamp receive_time)
@@ -254,6 +266,7 @@ class ChannelReceive : public ChannelReceiveInterface,
   Mutex callback_mutex_;
   Mutex volume_settings_mutex_;
   mutable Mutex call_stats_mutex_;
+  mutable Mutex received_audio_level_mutex_;
 
   bool playing_ RTC_GUARDED_BY(worker_thread_checker_) = false;
 
@@ -269,10 +282,18 @@ class ChannelReceive : public ChannelReceiveInterface,
       RTC_GUARDED_BY(&worker_thread_checker_);
   std::optional<int64_t> last_received_rtp_system_time_ms_
       RTC_GUARDED_BY(&worker_thread_checker_);
+  // From the audio level header extension of the last received packet that
+  // carried one. Unset if no packet did.
+  std::optional<webrtc::AudioLevel> last_received_audio_level_
+      RTC_GUARDED_BY(received_audio_level_mutex_);
+  Timestamp last_received_audio_level_time_
+      RTC_GUARDED_BY(received_audio_level_mutex_) = Timestamp::MinusInfinity();
 
   const std::unique_ptr<NetEq> neteq_;  // NetEq is thread-safe; no lock needed.
   acm2::ResamplerHelper resampler_helper_
       RTC_GUARDED_BY(audio_thread_race_checker_);
+  // Output of NetEq for audio that is not mixed, see SkipAudioFrame().
+  AudioFrame skipped_audio_frame_ RTC_GUARDED_BY(audio_thread_race_checker_);
   acm2::CallStatistics call_stats_ RTC_GUARDED_BY(call_stats_mutex_);
   AudioSinkInterface* audio_sink_ = nullptr;
   AudioLevel _outputAudioLevel;
@@ -463,6 +484,33 @@ AudioMixer::Source::AudioFrameInfo ChannelReceive::GetAudioFrameWithInfo(
   // https://crbug.com/webrtc/7517).
   _outputAudioLevel.ComputeLevel(*audio_frame, kAudioSampleDurationSeconds);
 
+  UpdateTiming(audio_frame);
+
+  ++audio_frame_interval_count_;
+  if (audio_frame_interval_count_ >= kHistogramReportingInterval) {
+    audio_frame_interval_count_ = 0;
+    worker_thread_->PostTask(SafeTask(worker_safety_.flag(), [this]() {
+      RTC_DCHECK_RUN_ON(&worker_thread_checker_);
+      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.TargetJitterBufferDelayMs",
+                                neteq_->TargetDelayMs());
+      const int jitter_buffer_delay = neteq_->FilteredCurrentDelayMs();
+      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverDelayEstimateMs",
+                                jitter_buffer_delay + playout_delay_ms_);
+      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverJitterBufferDelayMs",
+                                jitter_buffer_delay);
+      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverDeviceDelayMs",
+                                playout_delay_ms_);
+    }));
+  }
+
+  TRACE_EVENT_END2("webrtc", "ChannelReceive::GetAudioFrameWithInfo", "gain",
+                   output_gain, "muted", audio_frame->muted());
+  return audio_frame->muted() ? AudioMixer::Source::AudioFrameInfo::kMuted
+                              : AudioMixer::Source::AudioFrameInfo::kNormal;
+}
+
+void ChannelReceive::UpdateTiming(AudioFrame* audio_frame) {
+  RTC_DCHECK_RUNS_SERIALIZED(&audio_thread_race_checker_);
   if (capture_start_rtp_time_stamp_ < 0 && audio_frame->timestamp_ != 0) {
     // The first frame with a valid rtp timestamp.
     capture_start_rtp_time_stamp_ = audio_frame->timestamp_;
@@ -516,28 +564,49 @@ AudioMixer::Source::AudioFrameInfo ChannelReceive::GetAudioFrameWithInfo(
           source_tracker_.OnFrameDelivered(infos_copy, delivery_time);
         }));
   }
+}
 
-  ++audio_frame_interval_count_;
-  if (audio_frame_interval_count_ >= kHistogramReportingInterval) {
-    audio_frame_interval_count_ = 0;
-    worker_thread_->PostTask(SafeTask(worker_safety_.flag(), [this]() {
-      RTC_DCHECK_RUN_ON(&worker_thread_checker_);
-      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.TargetJitterBufferDelayMs",
-                                neteq_->TargetDelayMs());
-      const int jitter_buffer_delay = neteq_->FilteredCurrentDelayMs();
-      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverDelayEstimateMs",
-                                jitter_buffer_delay + playout_delay_ms_);
-      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverJitterBufferDelayMs",
-                                jitter_buffer_delay);
-      RTC_HISTOGRAM_COUNTS_1000("WebRTC.Audio.ReceiverDeviceDelayMs",
-                                playout_delay_ms_);
-    }));
+std::optional<webrtc::AudioLevel> ChannelReceive::LastReceivedAudioLevel()
+    const {
+  const Timestamp now = env_.clock().CurrentTime();
+  MutexLock lock(&received_audio_level_mutex_);
+  // A stream that stops signaling a level, e.g. because it stopped sending,
+  // is treated as digital silence and so competes for no slot in the mix.
+  if (last_received_audio_level_ &&
+      now - last_received_audio_level_time_ > kReceivedAudioLevelTimeout) {
+    return webrtc::AudioLevel(/*voice_activity=*/false, /*level=*/127);
   }
+  return last_received_audio_level_;
+}
 
-  TRACE_EVENT_END2("webrtc", "ChannelReceive::GetAudioFrameWithInfo", "gain",
-                   output_gain, "muted", audio_frame->muted());
-  return audio_frame->muted() ? AudioMixer::Source::AudioFrameInfo::kMuted
-                              : AudioMixer::Source::AudioFrameInfo::kNormal;
+void ChannelReceive::SkipAudioFrame(int sample_rate_hz) {
+  RTC_DCHECK_RUNS_SERIALIZED(&audio_thread_race_checker_);
+  bool has_sink;
+  {
+    MutexLock lock(&callback_mutex_);
+    has_sink = audio_sink_ != nullptr;
+  }
+  if (has_sink) {
+    // The sink gets all received audio, whether it is mixed or not.
+    GetAudioFrameWithInfo(sample_rate_hz, &skipped_audio_frame_);
+    return;
+  }
+
+  // NetEq is still pulled, and so still decodes, so that the jitter buffer
+  // keeps up with the incoming packets and the decoder state stays
+  // continuous for when this stream is mixed again. Resampling, gain and level measurement are
+  // skipped, but the timing is kept up to date for A/V sync and the source
+  // tracker.
+  if (neteq_->GetAudio(&skipped_audio_frame_) != NetEq::kOK) {
+    RTC_DLOG(LS_ERROR) << "ChannelReceive::SkipAudioFrame() failed!";
+    return;
+  }
+  {
+    MutexLock lock(&call_stats_mutex_);
+    call_stats_.DecodedByNetEq(skipped_audio_frame_.speech_type_,
+                               skipped_audio_frame_.muted());
+  }
+  UpdateTiming(&skipped_audio_frame_);
 }
 
 int ChannelReceive::PreferredSampleRate() const {
@@ -684,6 +753,14 @@ void ChannelReceive::OnRtpPacket(const RtpPacketReceived& packet) {
   RTPHeader header;
   packet_copy.GetHeader(&header);
 
+  {
+    MutexLock lock(&received_audio_level_mutex_);
+    if (header.extension.audio_level()) {
+      last_received_audio_level_ = header.extension.audio_level();
+      last_received_audio_level_time_ = env_.clock().CurrentTime();
+    }
+  }
+
   // Interpolates absolute capture timestamp RTP header extension.
   header.extension.absolute_capture_time =
       absolute_capture_time_interpolator_.OnReceivePacket(
@@ -151,6 +151,10 @@ class ChannelReceiveInterface : public RtpPacketSinkInterface {
 
   virtual int PreferredSampleRate() const = 0;
 
+  // See AudioMixer::Source.
+  virtual std::optional<webrtc::AudioLevel> LastReceivedAudioLevel() const = 0;
+  virtual void SkipAudioFrame(int sample_rate_hz) = 0;
+
   virtual std::vector<RtpSource> GetSources() const = 0;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
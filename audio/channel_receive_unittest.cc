@@ -23,6 +23,7 @@
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sdes.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/thread.h"
@@ -82,8 +83,9 @@ class ChannelReceiveTest : public Test {
     return TimeMillis() * 1000 / kSampleRateHz;
   }
 
-  RtpPacketReceived CreateRtpPacket() {
-    RtpPacketReceived packet;
+  RtpPacketReceived CreateRtpPacket(
+      const RtpHeaderExtensionMap* extensions = nullptr) {
+    RtpPacketReceived packet(extensions);
     packet.set_arrival_time(time_controller_.GetClock()->CurrentTime());
     packet.SetTimestamp(RtpNow());
     packet.SetSsrc(kLocalSsrc);
@@ -143,13 +145,18 @@ class ChannelReceiveTest : public Test {
     }
   }
 
-  int64_t ProbeCaptureStartNtpTime(ChannelReceiveInterface& channel) {
+  int64_t ProbeCaptureStartNtpTime(ChannelReceiveInterface& channel,
+                                   bool skip_audio = false) {
     // Computation of the capture_start_ntp_time_ms_ occurs when the
     // audio data is pulled, not when it is received. So we need to
     // inject an RTP packet, and then fetch its data.
     AudioFrame audio_frame;
     channel.OnRtpPacket(CreateRtpPacket());
-    channel.GetAudioFrameWithInfo(kSampleRateHz, &audio_frame);
+    if (skip_audio) {
+      channel.SkipAudioFrame(kSampleRateHz);
+    } else {
+      channel.GetAudioFrameWithInfo(kSampleRateHz, &audio_frame);
+    }
     CallReceiveStatistics stats = channel.GetRTCPStatistics();
     return stats.capture_start_ntp_time_ms;
   }
@@ -225,6 +232,72 @@ TEST_F(ChannelReceiveTest, CaptureStartTimeBecomesValid) {
   EXPECT_NE(ProbeCaptureStartNtpTime(*channel), -1);
 }
 
+TEST_F(ChannelReceiveTest, CaptureStartTimeBecomesValidWhenSkippingAudio) {
+  auto channel = CreateTestChannelReceive();
+
+  EXPECT_CALL(transport_, SendRtcp)
+      .WillRepeatedly([&](ArrayView<const uint8_t> packet) {
+        HandleGeneratedRtcp(*channel, packet);
+        return true;
+      });
+  // Before any packets are sent, CaptureStartTime is invalid.
+  EXPECT_EQ(ProbeCaptureStartNtpTime(*channel, /*skip_audio=*/true), -1);
+
+  // Must start playout, otherwise packet is discarded.
+  channel->StartPlayout();
+  // Send one RTP packet. This causes registration of the SSRC.
+  channel->OnRtpPacket(CreateRtpPacket());
+  EXPECT_EQ(ProbeCaptureStartNtpTime(*channel, /*skip_audio=*/true), -1);
+
+  // Receive a sender report.
+  auto rtcp_packet_1 = CreateRtcpSenderReport();
+  channel->ReceivedRTCPPacket(rtcp_packet_1.data(), rtcp_packet_1.size());
+  EXPECT_EQ(ProbeCaptureStartNtpTime(*channel, /*skip_audio=*/true), -1);
+
+  time_controller_.AdvanceTime(TimeDelta::Seconds(5));
+
+  // Receive a receiver report. This is necessary, which is odd.
+  // Presumably it is because the receiver needs to know the RTT
+  // before it can compute the capture start NTP time.
+  // The receiver report must happen before the second sender report.
+  auto rtcp_rr = CreateRtcpReceiverReport();
+  channel->ReceivedRTCPPacket(rtcp_rr.data(), rtcp_rr.size());
+  EXPECT_EQ(ProbeCaptureStartNtpTime(*channel, /*skip_audio=*/true), -1);
+
+  // Receive another sender report after 5 seconds.
+  // This should be enough to establish the capture start NTP time.
+  auto rtcp_packet_2 = CreateRtcpSenderReport();
+  channel->ReceivedRTCPPacket(rtcp_packet_2.data(), rtcp_packet_2.size());
+
+  EXPECT_NE(ProbeCaptureStartNtpTime(*channel, /*skip_audio=*/true), -1);
+}
+
+TEST_F(ChannelReceiveTest, LastReceivedAudioLevelExpires) {
+  auto channel = CreateTestChannelReceive();
+  RtpHeaderExtensionMap extensions;
+  extensions.Register<AudioLevelExtension>(1);
+  EXPECT_EQ(channel->LastReceivedAudioLevel(), std::nullopt);
+
+  RtpPacketReceived packet = CreateRtpPacket(&extensions);
+  packet.SetExtension<AudioLevelExtension>(
+      AudioLevel(/*voice_activity=*/true, /*audio_level=*/30));
+  channel->OnRtpPacket(packet);
+  std::optional<AudioLevel> level = channel->LastReceivedAudioLevel();
+  ASSERT_TRUE(level.has_value());
+  EXPECT_EQ(level->level(), 30);
+
+  // A sender in Opus DTX sends a packet every 400 ms.
+  time_controller_.AdvanceTime(TimeDelta::Millis(400));
+  EXPECT_TRUE(channel->LastReceivedAudioLevel().has_value());
+
+  // A sender that stops sending is treated as digital silence.
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  level = channel->LastReceivedAudioLevel();
+  ASSERT_TRUE(level.has_value());
+  EXPECT_EQ(level->level(), 127);
+  EXPECT_FALSE(level->voice_activity());
+}
+
 TEST_F(ChannelReceiveTest, SettingFrameTransformer) {
   auto channel = CreateTestChannelReceive();
 
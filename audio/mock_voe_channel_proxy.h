@@ -81,6 +81,11 @@ class MockChannelReceive : public voe::ChannelReceiveInterface {
               (int sample_rate_hz, AudioFrame*),
               (override));
   MOCK_METHOD(int, PreferredSampleRate, (), (const, override));
+  MOCK_METHOD(std::optional<AudioLevel>,
+              LastReceivedAudioLevel,
+              (),
+              (const, override));
+  MOCK_METHOD(void, SkipAudioFrame, (int sample_rate_hz), (override));
   MOCK_METHOD(std::vector<RtpSource>, GetSources, (), (const, override));
   MOCK_METHOD(bool,
               GetPlayoutRtpTimestamp,
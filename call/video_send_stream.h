@@ -26,6 +26,7 @@
 #include "api/rtp_sender_interface.h"
 #include "api/scoped_refptr.h"
 #include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
 #include "api/video/video_content_type.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_source_interface.h"
@@ -111,6 +112,10 @@ class VideoSendStream {
     int encode_frame_rate = 0;
     int avg_encode_time_ms = 0;
     int encode_usage_percent = 0;
+    // Time that frames spent queued before encoding, when the encoder runs
+    // asynchronously from the encoder queue ("WebRTC-Video-AsyncEncode").
+    int avg_encode_queueing_delay_ms = 0;
+    TimeDelta total_encode_queueing_delay = TimeDelta::Zero();
     uint32_t frames_encoded = 0;
     // https://w3c.github.io/webrtc-stats/#dom-rtcoutboundrtpstreamstats-totalencodetime
     uint64_t total_encode_time_ms = 0;
@@ -20,7 +20,9 @@ namespace webrtc {
 
 class PushSincResampler;
 
-// Wraps PushSincResampler to provide stereo support.
+// Wraps PushSincResampler to provide stereo support. Channel counts for which
+// SincResampler has a vectorized interleaved path are resampled in one pass,
+// without deinterleaving; others use one resampler per channel.
 // Note: This implementation assumes 10ms buffer sizes throughout.
 template <typename T>
 class PushResampler final {
@@ -52,6 +54,8 @@ class PushResampler final {
   DeinterleavedView<T> destination_view_;
 
   std::vector<std::unique_ptr<PushSincResampler>> resamplers_;
+  // Set instead of `resamplers_` when resampling interleaved audio directly.
+  std::unique_ptr<PushSincResampler> interleaved_resampler_;
 };
 }  // namespace webrtc
 
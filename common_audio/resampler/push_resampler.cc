@@ -18,6 +18,7 @@
 #include "api/audio/audio_frame.h"
 #include "common_audio/include/audio_util.h"
 #include "common_audio/resampler/push_sinc_resampler.h"
+#include "common_audio/resampler/sinc_resampler.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -69,6 +70,13 @@ void PushResampler<T>::EnsureInitialized(size_t src_samples_per_channel,
                                       num_channels);
   destination_view_ = DeinterleavedView<T>(
       destination_.get(), dst_samples_per_channel, num_channels);
+  if (num_channels > 1 && SincResampler::HasFastInterleavedPath(num_channels)) {
+    resamplers_.clear();
+    interleaved_resampler_ = std::make_unique<PushSincResampler>(
+        src_samples_per_channel, dst_samples_per_channel, num_channels);
+    return;
+  }
+  interleaved_resampler_.reset();
   resamplers_.resize(num_channels);
   for (size_t i = 0; i < num_channels; ++i) {
     resamplers_[i] = std::make_unique<PushSincResampler>(
@@ -94,6 +102,13 @@ int PushResampler<T>::Resample(InterleavedView<const T> src,
     return static_cast<int>(src.data().size());
   }
 
+  if (interleaved_resampler_) {
+    size_t dst_length = interleaved_resampler_->Resample(
+        src.data().data(), src.size(), dst.data().data(), dst.size());
+    RTC_DCHECK_EQ(dst_length, dst.size());
+    return static_cast<int>(dst_length);
+  }
+
   Deinterleave(src, source_view_);
 
   for (size_t i = 0; i < resamplers_.size(); ++i) {
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_view.h"
+#include "benchmark/benchmark.h"
+#include "common_audio/resampler/include/push_resampler.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kChunksPerSecond = 100;
+
+// Throughput of resampling 10 ms chunks of interleaved audio, reported as
+// seconds of audio per channel resampled per second of CPU time on one core.
+void BM_PushResampler(benchmark::State& state) {
+  const size_t src_rate_hz = state.range(0);
+  const size_t dst_rate_hz = state.range(1);
+  const size_t num_channels = state.range(2);
+  const size_t src_samples = src_rate_hz / kChunksPerSecond;
+  const size_t dst_samples = dst_rate_hz / kChunksPerSecond;
+
+  std::vector<int16_t> src(src_samples * num_channels);
+  std::vector<int16_t> dst(dst_samples * num_channels);
+  for (size_t i = 0; i < src_samples; ++i) {
+    for (size_t c = 0; c < num_channels; ++c) {
+      src[i * num_channels + c] =
+          static_cast<int16_t>(8000 * std::sin(0.01 * i * (c + 1)));
+    }
+  }
+
+  PushResampler<int16_t> resampler(src_samples, dst_samples, num_channels);
+  for (auto _ : state) {
+    resampler.Resample(
+        InterleavedView<const int16_t>(src.data(), src_samples, num_channels),
+        InterleavedView<int16_t>(dst.data(), dst_samples, num_channels));
+    benchmark::DoNotOptimize(dst.data());
+  }
+
+  state.counters["channel_seconds_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * num_channels /
+          kChunksPerSecond,
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_PushResampler)
+    ->ArgNames({"src_hz", "dst_hz", "channels"})
+    ->ArgsProduct({{48000}, {8000, 16000, 44100}, {1, 2, 8}})
+    ->ArgsProduct({{8000, 16000, 44100}, {48000}, {1, 2, 8}});
+
+// Cost of creating a resampler, e.g. when a stream starts, which is small when
+// another resampler already uses the same rates and shares its kernels.
+void BM_PushResamplerCreate(benchmark::State& state) {
+  const bool shared = state.range(0) != 0;
+  std::unique_ptr<PushResampler<int16_t>> existing;
+  if (shared) {
+    existing = std::make_unique<PushResampler<int16_t>>(441, 480, 2);
+  }
+  for (auto _ : state) {
+    PushResampler<int16_t> resampler(441, 480, 2);
+    benchmark::DoNotOptimize(&resampler);
+  }
+}
+
+BENCHMARK(BM_PushResamplerCreate)->ArgName("shared")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
@@ -10,6 +10,10 @@
 
 #include "common_audio/resampler/include/push_resampler.h"
 
+#include <cmath>
+#include <vector>
+
+#include "api/audio/audio_view.h"
 #include "rtc_base/checks.h"  // RTC_DCHECK_IS_ON
 #include "test/gtest.h"
 #include "test/testsupport/rtc_expect_death.h"
@@ -24,6 +28,41 @@ TEST(PushResamplerTest, VerifiesInputParameters) {
   PushResampler<int16_t> resampler3(160, 160, 8);
 }
 
+// Multichannel audio may be resampled interleaved, which must not change the
+// result compared to resampling each channel on its own.
+TEST(PushResamplerTest, MultichannelMatchesMono) {
+  constexpr size_t kSrcSamples = 480;
+  constexpr size_t kDstSamples = 160;
+  for (size_t num_channels : {2, 3, 4, 8}) {
+    SCOPED_TRACE(num_channels);
+    PushResampler<float> resampler(kSrcSamples, kDstSamples, num_channels);
+    PushResampler<float> mono_resampler(kSrcSamples, kDstSamples, 1);
+    std::vector<float> src(kSrcSamples * num_channels);
+    std::vector<float> dst(kDstSamples * num_channels);
+    std::vector<float> mono_src(kSrcSamples);
+    std::vector<float> mono_dst(kDstSamples);
+    for (int block = 0; block < 4; ++block) {
+      for (size_t i = 0; i < kSrcSamples; ++i) {
+        mono_src[i] = 1000.f * std::sin(0.05f * (block * kSrcSamples + i));
+        for (size_t c = 0; c < num_channels; ++c)
+          src[i * num_channels + c] = mono_src[i] * (c + 1);
+      }
+      resampler.Resample(
+          InterleavedView<const float>(src.data(), kSrcSamples, num_channels),
+          InterleavedView<float>(dst.data(), kDstSamples, num_channels));
+      mono_resampler.Resample(
+          MonoView<const float>(mono_src.data(), kSrcSamples),
+          MonoView<float>(mono_dst.data(), kDstSamples));
+      for (size_t i = 0; i < kDstSamples; ++i) {
+        for (size_t c = 0; c < num_channels; ++c) {
+          ASSERT_NEAR(dst[i * num_channels + c], mono_dst[i] * (c + 1),
+                      0.01f * (c + 1));
+        }
+      }
+    }
+  }
+}
+
 #if RTC_DCHECK_IS_ON && GTEST_HAS_DEATH_TEST && !defined(WEBRTC_ANDROID)
 TEST(PushResamplerDeathTest, VerifiesBadInputParameters1) {
   RTC_EXPECT_DEATH(PushResampler<int16_t>(-1, 160, 1),
@@ -31,6 +31,12 @@ class PushSincResampler : public SincResamplerCallback {
   // must correspond to the same time duration (typically 10 ms) as the sample
   // ratio is inferred from them.
   PushSincResampler(size_t source_frames, size_t destination_frames);
+  // As above, for blocks of `num_channels` interleaved channels, with sizes
+  // given in frames per channel. The lengths passed to Resample() and
+  // returned by it are then in samples across all channels.
+  PushSincResampler(size_t source_frames,
+                    size_t destination_frames,
+                    size_t num_channels);
   ~PushSincResampler() override;
 
   PushSincResampler(const PushSincResampler&) = delete;
@@ -75,6 +81,7 @@ class PushSincResampler : public SincResamplerCallback {
   const float* source_ptr_;
   const int16_t* source_ptr_int_;
   const size_t destination_frames_;
+  const size_t num_channels_;
 
   // True on the first call to Resample(), to prime the SincResampler buffer.
   bool first_pass_;
@@ -81,6 +81,9 @@
 //
 // Note: we're glossing over how the sub-sample handling works with
 // `virtual_source_idx_`, etc.
+//
+// With several channels, every region holds interleaved frames, so all sizes
+// and offsets above are in frames of `num_channels_` samples.
 
 // MSVC++ requires this to be set before any other includes to get M_PI.
 #define _USE_MATH_DEFINES
@@ -92,8 +95,13 @@
 #include <string.h>
 
 #include <limits>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/system/arch.h"
 #include "system_wrappers/include/cpu_features_wrapper.h"  // kSSE2, WebRtc_G...
 
@@ -117,8 +125,145 @@ double SincScaleFactor(double io_ratio) {
   return sinc_scale_factor;
 }
 
+// Computes a windowed sinc() kernel of `kernel_size` taps shifted by
+// `subsample_offset`, with each tap repeated `channel_stride` times.
+void ComputeKernel(double sinc_scale_factor,
+                   float subsample_offset,
+                   size_t kernel_size,
+                   size_t channel_stride,
+                   float* kernel) {
+  // Blackman window parameters.
+  static const double kAlpha = 0.16;
+  static const double kA0 = 0.5 * (1.0 - kAlpha);
+  static const double kA1 = 0.5;
+  static const double kA2 = 0.5 * kAlpha;
+
+  for (size_t i = 0; i < kernel_size; ++i) {
+    const float pre_sinc = static_cast<float>(
+        M_PI * (static_cast<int>(i) - static_cast<int>(kernel_size / 2) -
+                subsample_offset));
+
+    // Compute Blackman window, matching the offset of the sinc().
+    const float x = (i - subsample_offset) / kernel_size;
+    const float window = static_cast<float>(kA0 - kA1 * cos(2.0 * M_PI * x) +
+                                            kA2 * cos(4.0 * M_PI * x));
+
+    // Compute the sinc with offset, then window the sinc() function and store
+    // at the correct offset.
+    const float tap = static_cast<float>(
+        window * ((pre_sinc == 0)
+                      ? sinc_scale_factor
+                      : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
+    for (size_t channel = 0; channel < channel_stride; ++channel) {
+      kernel[i * channel_stride + channel] = tap;
+    }
+  }
+}
+
 }  // namespace
 
+class SincResampler::Kernels {
+ public:
+  // Returns the kernels for `io_sample_rate_ratio` with each tap repeated
+  // `channel_stride` times, computing them unless another SincResampler
+  // already uses them.
+  static std::shared_ptr<const Kernels> Get(double io_sample_rate_ratio,
+                                            size_t channel_stride);
+
+  Kernels(double io_sample_rate_ratio, size_t channel_stride);
+
+  // Kernel `offset_idx` of kKernelOffsetCount + 1, for sub-sample shifts from
+  // 0.0 to 1.0 sample.
+  const float* interpolation_kernel(size_t offset_idx) const {
+    return interpolation_kernels_.get() + offset_idx * kernel_stride_;
+  }
+
+  // The ratio is `phase_step()` / `num_phases()` if there are polyphase
+  // kernels, otherwise `num_phases()` is 0.
+  int num_phases() const { return num_phases_; }
+  int phase_step() const { return phase_step_; }
+
+  // Kernel for a sub-sample shift of `phase` / `num_phases()`.
+  const float* phase_kernel(int phase) const {
+    return phase_kernels_.get() + phase * kernel_stride_;
+  }
+
+  size_t kernel_stride() const { return kernel_stride_; }
+
+ private:
+  const size_t kernel_stride_;
+  int num_phases_ = 0;
+  int phase_step_ = 0;
+  std::unique_ptr<float[], AlignedFreeDeleter> interpolation_kernels_;
+  std::unique_ptr<float[], AlignedFreeDeleter> phase_kernels_;
+};
+
+std::shared_ptr<const SincResampler::Kernels> SincResampler::Kernels::Get(
+    double io_sample_rate_ratio,
+    size_t channel_stride) {
+  // Kernels stay alive while a resampler uses them, so that the resamplers of
+  // all streams and channels with the same ratio share them.
+  static Mutex* const mutex = new Mutex();
+  static auto* const cache =
+      new std::map<std::pair<double, size_t>, std::weak_ptr<const Kernels>>();
+  MutexLock lock(mutex);
+  const std::pair<double, size_t> key(io_sample_rate_ratio, channel_stride);
+  auto it = cache->find(key);
+  if (it != cache->end()) {
+    if (std::shared_ptr<const Kernels> kernels = it->second.lock()) {
+      return kernels;
+    }
+  }
+  // Drop the kernels of the ratios no longer in use.
+  for (it = cache->begin(); it != cache->end();) {
+    it = it->second.expired() ? cache->erase(it) : std::next(it);
+  }
+  auto kernels =
+      std::make_shared<const Kernels>(io_sample_rate_ratio, channel_stride);
+  (*cache)[key] = kernels;
+  return kernels;
+}
+
+SincResampler::Kernels::Kernels(double io_sample_rate_ratio,
+                                size_t channel_stride)
+    : kernel_stride_(kKernelSize * channel_stride),
+      // Create the kernels with a 32-byte alignment for SIMD optimizations.
+      interpolation_kernels_(static_cast<float*>(
+          AlignedMalloc(sizeof(float) * kKernelStorageSize * channel_stride,
+                        32))) {
+  // Generates a set of windowed sinc() kernels.
+  // We generate a range of sub-sample offsets from 0.0 to 1.0.
+  const double sinc_scale_factor = SincScaleFactor(io_sample_rate_ratio);
+  for (size_t offset_idx = 0; offset_idx <= kKernelOffsetCount; ++offset_idx) {
+    ComputeKernel(sinc_scale_factor,
+                  static_cast<float>(offset_idx) / kKernelOffsetCount,
+                  kKernelSize, channel_stride,
+                  interpolation_kernels_.get() + offset_idx * kernel_stride_);
+  }
+
+  // Look for the smallest number of phases such that every output frame is
+  // at a whole phase.  For numbers of phases dividing kKernelOffsetCount, the
+  // polyphase kernels are the same as the interpolation kernels.
+  for (int num_phases = 1; num_phases <= kMaxPolyphasePhases; ++num_phases) {
+    const double phase_step = io_sample_rate_ratio * num_phases;
+    if (phase_step >= 1.0 && fabs(phase_step - round(phase_step)) < 1e-9) {
+      num_phases_ = num_phases;
+      phase_step_ = static_cast<int>(round(phase_step));
+      break;
+    }
+  }
+  if (num_phases_ == 0) {
+    return;
+  }
+  phase_kernels_.reset(static_cast<float*>(
+      AlignedMalloc(sizeof(float) * kernel_stride_ * num_phases_, 32)));
+  for (int phase = 0; phase < num_phases_; ++phase) {
+    ComputeKernel(sinc_scale_factor, static_cast<float>(phase) / num_phases_,
+                  kKernelSize, channel_stride,
+                  phase_kernels_.get() + phase * kernel_stride_);
+  }
+}
+
 const size_t SincResampler::kKernelSize;
 
 // If we know the minimum architecture at compile time, avoid CPU detection.
@@ -137,41 +282,59 @@ void SincResampler::InitializeCPUSpecificFeatures() {
   // Unknown architecture.
   convolve_proc_ = Convolve_C;
 #endif
+
+  convolve_interleaved_proc_ = ConvolveInterleaved_C;
+  kernel_channel_stride_ = 1;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (num_channels_ > 1 && HasFastInterleavedPath(num_channels_)) {
+    convolve_interleaved_proc_ = ConvolveInterleaved_AVX2;
+    kernel_channel_stride_ = num_channels_;
+  }
+#endif
+}
+
+bool SincResampler::HasFastInterleavedPath(size_t num_channels) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  return (num_channels == 2 || num_channels == 4 || num_channels == 8) &&
+         GetCPUInfo(kAVX2) && GetCPUInfo(kFMA3);
+#else
+  return false;
+#endif
 }
 
 SincResampler::SincResampler(double io_sample_rate_ratio,
                              size_t request_frames,
                              SincResamplerCallback* read_cb)
+    : SincResampler(io_sample_rate_ratio,
+                    request_frames,
+                    /*num_channels=*/1,
+                    read_cb) {}
+
+SincResampler::SincResampler(double io_sample_rate_ratio,
+                             size_t request_frames,
+                             size_t num_channels,
+                             SincResamplerCallback* read_cb)
     : io_sample_rate_ratio_(io_sample_rate_ratio),
+      num_channels_(num_channels),
       read_cb_(read_cb),
       request_frames_(request_frames),
-      input_buffer_size_(request_frames_ + kKernelSize),
+      input_buffer_size_((request_frames_ + kKernelSize) * num_channels_),
       // Create input buffers with a 32-byte alignment for SIMD optimizations.
-      kernel_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
-      kernel_pre_sinc_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
-      kernel_window_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
       input_buffer_(static_cast<float*>(
           AlignedMalloc(sizeof(float) * input_buffer_size_, 32))),
       convolve_proc_(nullptr),
+      convolve_interleaved_proc_(nullptr),
       r1_(input_buffer_.get()),
-      r2_(input_buffer_.get() + kKernelSize / 2) {
+      r2_(input_buffer_.get() + kKernelSize / 2 * num_channels_) {
+  RTC_DCHECK_GT(num_channels_, 0);
   InitializeCPUSpecificFeatures();
   RTC_DCHECK(convolve_proc_);
+  RTC_DCHECK(convolve_interleaved_proc_);
   RTC_DCHECK_GT(request_frames_, 0);
   Flush();
   RTC_DCHECK_GT(block_size_, kKernelSize);
 
-  memset(kernel_storage_.get(), 0,
-         sizeof(*kernel_storage_.get()) * kKernelStorageSize);
-  memset(kernel_pre_sinc_storage_.get(), 0,
-         sizeof(*kernel_pre_sinc_storage_.get()) * kKernelStorageSize);
-  memset(kernel_window_storage_.get(), 0,
-         sizeof(*kernel_window_storage_.get()) * kKernelStorageSize);
-
-  InitializeKernel();
+  UpdateKernels();
 }
 
 SincResampler::~SincResampler() {}
@@ -179,10 +342,11 @@ SincResampler::~SincResampler() {}
 void SincResampler::UpdateRegions(bool second_load) {
   // Setup various region pointers in the buffer (see diagram above).  If we're
   // on the second load we need to slide r0_ to the right by kKernelSize / 2.
-  r0_ = input_buffer_.get() + (second_load ? kKernelSize : kKernelSize / 2);
-  r3_ = r0_ + request_frames_ - kKernelSize;
-  r4_ = r0_ + request_frames_ - kKernelSize / 2;
-  block_size_ = r4_ - r2_;
+  r0_ = input_buffer_.get() +
+        (second_load ? kKernelSize : kKernelSize / 2) * num_channels_;
+  r3_ = r0_ + (request_frames_ - kKernelSize) * num_channels_;
+  r4_ = r0_ + (request_frames_ - kKernelSize / 2) * num_channels_;
+  block_size_ = (r4_ - r2_) / num_channels_;
 
   // r1_ at the beginning of the buffer.
   RTC_DCHECK_EQ(r1_, input_buffer_.get());
@@ -192,39 +356,23 @@ void SincResampler::UpdateRegions(bool second_load) {
   RTC_DCHECK_LT(r2_, r3_);
 }
 
-void SincResampler::InitializeKernel() {
-  // Blackman window parameters.
-  static const double kAlpha = 0.16;
-  static const double kA0 = 0.5 * (1.0 - kAlpha);
-  static const double kA1 = 0.5;
-  static const double kA2 = 0.5 * kAlpha;
+void SincResampler::UpdateKernels() {
+  const int previous_num_phases = kernels_ ? kernels_->num_phases() : 0;
+  kernels_ = Kernels::Get(io_sample_rate_ratio_, kernel_channel_stride_);
 
-  // Generates a set of windowed sinc() kernels.
-  // We generate a range of sub-sample offsets from 0.0 to 1.0.
-  const double sinc_scale_factor = SincScaleFactor(io_sample_rate_ratio_);
-  for (size_t offset_idx = 0; offset_idx <= kKernelOffsetCount; ++offset_idx) {
-    const float subsample_offset =
-        static_cast<float>(offset_idx) / kKernelOffsetCount;
-
-    for (size_t i = 0; i < kKernelSize; ++i) {
-      const size_t idx = i + offset_idx * kKernelSize;
-      const float pre_sinc = static_cast<float>(
-          M_PI * (static_cast<int>(i) - static_cast<int>(kKernelSize / 2) -
-                  subsample_offset));
-      kernel_pre_sinc_storage_[idx] = pre_sinc;
-
-      // Compute Blackman window, matching the offset of the sinc().
-      const float x = (i - subsample_offset) / kKernelSize;
-      const float window = static_cast<float>(kA0 - kA1 * cos(2.0 * M_PI * x) +
-                                              kA2 * cos(4.0 * M_PI * x));
-      kernel_window_storage_[idx] = window;
-
-      // Compute the sinc with offset, then window the sinc() function and store
-      // at the correct offset.
-      kernel_storage_[idx] = static_cast<float>(
-          window * ((pre_sinc == 0)
-                        ? sinc_scale_factor
-                        : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
+  if (previous_num_phases > 0) {
+    virtual_source_idx_ =
+        source_idx_ + static_cast<double>(phase_) / previous_num_phases;
+  }
+  const int num_phases = kernels_->num_phases();
+  if (num_phases > 0) {
+    // Continue from the nearest phase.
+    source_idx_ = static_cast<size_t>(virtual_source_idx_);
+    phase_ = static_cast<int>(
+        round((virtual_source_idx_ - source_idx_) * num_phases));
+    if (phase_ == num_phases) {
+      ++source_idx_;
+      phase_ = 0;
     }
   }
 }
@@ -236,22 +384,11 @@ void SincResampler::SetRatio(double io_sample_rate_ratio) {
   }
 
   io_sample_rate_ratio_ = io_sample_rate_ratio;
+  UpdateKernels();
+}
 
-  // Optimize reinitialization by reusing values which are independent of
-  // `sinc_scale_factor`.  Provides a 3x speedup.
-  const double sinc_scale_factor = SincScaleFactor(io_sample_rate_ratio_);
-  for (size_t offset_idx = 0; offset_idx <= kKernelOffsetCount; ++offset_idx) {
-    for (size_t i = 0; i < kKernelSize; ++i) {
-      const size_t idx = i + offset_idx * kKernelSize;
-      const float window = kernel_window_storage_[idx];
-      const float pre_sinc = kernel_pre_sinc_storage_[idx];
-
-      kernel_storage_[idx] = static_cast<float>(
-          window * ((pre_sinc == 0)
-                        ? sinc_scale_factor
-                        : (sin(sinc_scale_factor * pre_sinc) / pre_sinc)));
-    }
-  }
+const float* SincResampler::get_kernel_for_testing() const {
+  return kernels_->interpolation_kernel(0);
 }
 
 void SincResampler::Resample(size_t frames, float* destination) {
@@ -266,16 +403,39 @@ void SincResampler::Resample(size_t frames, float* destination) {
   // Step (2) -- Resample!  const what we can outside of the loop for speed.  It
   // actually has an impact on ARM performance.  See inner loop comment below.
   const double current_io_ratio = io_sample_rate_ratio_;
-  const float* const kernel_ptr = kernel_storage_.get();
+  const Kernels& kernels = *kernels_;
+  const float* const kernel_ptr = kernels.interpolation_kernel(0);
+  const size_t kernel_stride = kernels.kernel_stride();
+  const int num_phases = kernels.num_phases();
+  const int phase_step = kernels.phase_step();
   while (remaining_frames) {
+    // With polyphase kernels, every output frame is a single convolution with
+    // the kernel of its phase.
+    while (num_phases > 0 && source_idx_ < block_size_) {
+      Convolve(r1_ + source_idx_ * num_channels_,
+               kernels.phase_kernel(phase_), nullptr, 0.0, destination);
+      destination += num_channels_;
+
+      // Advance the index.
+      phase_ += phase_step;
+      source_idx_ += phase_ / num_phases;
+      phase_ %= num_phases;
+
+      if (!--remaining_frames)
+        return;
+    }
+
     // `i` may be negative if the last Resample() call ended on an iteration
     // that put `virtual_source_idx_` over the limit.
     //
     // Note: The loop construct here can severely impact performance on ARM
     // or when built with clang.  See https://codereview.chromium.org/18566009/
-    for (int i = static_cast<int>(
-             ceil((block_size_ - virtual_source_idx_) / current_io_ratio));
-         i > 0; --i) {
+    const int num_interpolated_frames =
+        num_phases > 0 ? 0
+                       : static_cast<int>(ceil(
+                             (block_size_ - virtual_source_idx_) /
+                             current_io_ratio));
+    for (int i = num_interpolated_frames; i > 0; --i) {
       RTC_DCHECK_LT(virtual_source_idx_, block_size_);
 
       // `virtual_source_idx_` lies in between two kernel offsets so figure out
@@ -289,8 +449,8 @@ void SincResampler::Resample(size_t frames, float* destination) {
 
       // We'll compute "convolutions" for the two kernels which straddle
       // `virtual_source_idx_`.
-      const float* const k1 = kernel_ptr + offset_idx * kKernelSize;
-      const float* const k2 = k1 + kKernelSize;
+      const float* const k1 = kernel_ptr + offset_idx * kernel_stride;
+      const float* const k2 = k1 + kernel_stride;
 
       // Ensure `k1`, `k2` are 32-byte aligned for SIMD usage.  Should always be
       // true so long as kKernelSize is a multiple of 32.
@@ -298,13 +458,13 @@ void SincResampler::Resample(size_t frames, float* destination) {
       RTC_DCHECK_EQ(0, reinterpret_cast<uintptr_t>(k2) % 32);
 
       // Initialize input pointer based on quantized `virtual_source_idx_`.
-      const float* const input_ptr = r1_ + source_idx;
+      const float* const input_ptr = r1_ + source_idx * num_channels_;
 
       // Figure out how much to weight each kernel's "convolution".
       const double kernel_interpolation_factor =
           virtual_offset_idx - offset_idx;
-      *destination++ =
-          convolve_proc_(input_ptr, k1, k2, kernel_interpolation_factor);
+      Convolve(input_ptr, k1, k2, kernel_interpolation_factor, destination);
+      destination += num_channels_;
 
       // Advance the virtual index.
       virtual_source_idx_ += current_io_ratio;
@@ -314,11 +474,16 @@ void SincResampler::Resample(size_t frames, float* destination) {
     }
 
     // Wrap back around to the start.
-    virtual_source_idx_ -= block_size_;
+    if (num_phases > 0) {
+      source_idx_ -= block_size_;
+    } else {
+      virtual_source_idx_ -= block_size_;
+    }
 
     // Step (3) -- Copy r3_, r4_ to r1_, r2_.
     // This wraps the last input frames back to the start of the buffer.
-    memcpy(r1_, r3_, sizeof(*input_buffer_.get()) * kKernelSize);
+    memcpy(r1_, r3_,
+           sizeof(*input_buffer_.get()) * kKernelSize * num_channels_);
 
     // Step (4) -- Reinitialize regions if necessary.
     if (r0_ == r2_)
@@ -337,12 +502,28 @@ size_t SincResampler::ChunkSize() const {
 
 void SincResampler::Flush() {
   virtual_source_idx_ = 0;
+  source_idx_ = 0;
+  phase_ = 0;
   buffer_primed_ = false;
   memset(input_buffer_.get(), 0,
          sizeof(*input_buffer_.get()) * input_buffer_size_);
   UpdateRegions(false);
 }
 
+void SincResampler::Convolve(const float* input_ptr,
+                             const float* k1,
+                             const float* k2,
+                             double kernel_interpolation_factor,
+                             float* destination) const {
+  if (num_channels_ == 1) {
+    *destination =
+        convolve_proc_(input_ptr, k1, k2, kernel_interpolation_factor);
+  } else {
+    convolve_interleaved_proc_(input_ptr, num_channels_, k1, k2,
+                               kernel_interpolation_factor, destination);
+  }
+}
+
 float SincResampler::Convolve_C(const float* input_ptr,
                                 const float* k1,
                                 const float* k2,
@@ -353,6 +534,11 @@ float SincResampler::Convolve_C(const float* input_ptr,
   // Generate a single output sample.  Unrolling this loop hurt performance in
   // local testing.
   size_t n = kKernelSize;
+  if (!k2) {
+    while (n--)
+      sum1 += *input_ptr++ * *k1++;
+    return sum1;
+  }
   while (n--) {
     sum1 += *input_ptr * *k1++;
     sum2 += *input_ptr++ * *k2++;
@@ -363,4 +549,27 @@ float SincResampler::Convolve_C(const float* input_ptr,
                             kernel_interpolation_factor * sum2);
 }
 
+void SincResampler::ConvolveInterleaved_C(const float* input_ptr,
+                                          size_t num_channels,
+                                          const float* k1,
+                                          const float* k2,
+                                          double kernel_interpolation_factor,
+                                          float* destination) {
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    float sum1 = 0;
+    float sum2 = 0;
+    const float* input = input_ptr + channel;
+    for (size_t i = 0; i < kKernelSize; ++i, input += num_channels) {
+      sum1 += *input * k1[i];
+      if (k2) {
+        sum2 += *input * k2[i];
+      }
+    }
+    destination[channel] =
+        k2 ? static_cast<float>((1.0 - kernel_interpolation_factor) * sum1 +
+                                kernel_interpolation_factor * sum2)
+           : sum1;
+  }
+}
+
 }  // namespace webrtc
@@ -33,7 +33,8 @@ class SincResamplerCallback {
   virtual void Run(size_t frames, float* destination) = 0;
 };
 
-// SincResampler is a high-quality single-channel sample-rate converter.
+// SincResampler is a high-quality sample-rate converter, for a single channel
+// or for several interleaved channels resampled in lockstep.
 class SincResampler {
  public:
   // The kernel size can be adjusted for quality (higher is better) at the
@@ -52,6 +53,12 @@ class SincResampler {
   static const size_t kKernelStorageSize =
       kKernelSize * (kKernelOffsetCount + 1);
 
+  // Ratios of M / N input to output frames with N up to this many are
+  // resampled with one precomputed kernel per output phase (polyphase)
+  // instead of interpolating between two kernels, e.g. 48 kHz to and from
+  // 8, 16, 24 and 32 kHz.
+  static const int kMaxPolyphasePhases = 8;
+
   // Constructs a SincResampler with the specified `read_cb`, which is used to
   // acquire audio data for resampling.  `io_sample_rate_ratio` is the ratio
   // of input / output sample rates.  `request_frames` controls the size in
@@ -61,6 +68,12 @@ class SincResampler {
   SincResampler(double io_sample_rate_ratio,
                 size_t request_frames,
                 SincResamplerCallback* read_cb);
+  // As above, for `num_channels` interleaved channels. `read_cb` is asked for,
+  // and Resample() produces, frames of `num_channels` interleaved samples.
+  SincResampler(double io_sample_rate_ratio,
+                size_t request_frames,
+                size_t num_channels,
+                SincResamplerCallback* read_cb);
   virtual ~SincResampler();
 
   SincResampler(const SincResampler&) = delete;
@@ -69,6 +82,11 @@ class SincResampler {
   // Resample `frames` of data from `read_cb_` into `destination`.
   void Resample(size_t frames, float* destination);
 
+  // Returns true if resampling `num_channels` interleaved channels with one
+  // SincResampler is faster than resampling each channel separately, i.e. if
+  // there is a SIMD implementation for that number of interleaved channels.
+  static bool HasFastInterleavedPath(size_t num_channels);
+
   // The maximum size in frames that guarantees Resample() will only make a
   // single call to `read_cb_` for more data.
   size_t ChunkSize() const;
@@ -79,23 +97,39 @@ class SincResampler {
   // not call while Resample() is in progress.
   void Flush();
 
-  // Update `io_sample_rate_ratio_`.  SetRatio() will cause a reconstruction of
-  // the kernels used for resampling.  Not thread safe, do not call while
-  // Resample() is in progress.
+  // Update `io_sample_rate_ratio_`.  SetRatio() will switch to the kernels
+  // for the new ratio, which are computed if no other SincResampler uses that
+  // ratio.  Not thread safe, do not call while Resample() is in progress.
   //
   // TODO(ajm): Use this in PushSincResampler rather than reconstructing
   // SincResampler.  We would also need a way to update `request_frames_`.
   void SetRatio(double io_sample_rate_ratio);
 
-  float* get_kernel_for_testing() { return kernel_storage_.get(); }
+  const float* get_kernel_for_testing() const;
 
  private:
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, Convolve);
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, ConvolveBenchmark);
+  FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, ConvolveInterleaved);
+
+  // Immutable kernels for one ratio, shared by all resamplers using it.
+  class Kernels;
 
-  void InitializeKernel();
   void UpdateRegions(bool second_load);
 
+  // Switches to the kernels for `io_sample_rate_ratio_`, converting the
+  // position in the input between the polyphase and interpolated
+  // representations if needed.
+  void UpdateKernels();
+
+  // Computes one output frame from the input frame at `input_ptr` into
+  // `destination`.  `k2` is null when `k1` is an exact polyphase kernel.
+  void Convolve(const float* input_ptr,
+                const float* k1,
+                const float* k2,
+                double kernel_interpolation_factor,
+                float* destination) const;
+
   // Selects runtime specific CPU features like SSE.  Must be called before
   // using SincResampler.
   // TODO(ajm): Currently managed by the class internally. See the note with
@@ -103,8 +137,9 @@ class SincResampler {
   void InitializeCPUSpecificFeatures();
 
   // Compute convolution of `k1` and `k2` over `input_ptr`, resultant sums are
-  // linearly interpolated using `kernel_interpolation_factor`.  On x86 and ARM
-  // the underlying implementation is chosen at run time.
+  // linearly interpolated using `kernel_interpolation_factor`.  If `k2` is
+  // null, only the convolution with `k1` is computed.  On x86 and ARM the
+  // underlying implementation is chosen at run time.
   static float Convolve_C(const float* input_ptr,
                           const float* k1,
                           const float* k2,
@@ -125,13 +160,40 @@ class SincResampler {
                              double kernel_interpolation_factor);
 #endif
 
+  // As above, for `num_channels` interleaved channels, writing one sample per
+  // channel to `destination`.  The generic version takes single-channel
+  // kernels, while the SIMD versions take kernels with each tap repeated
+  // `num_channels` times, matching the interleaved input.
+  static void ConvolveInterleaved_C(const float* input_ptr,
+                                    size_t num_channels,
+                                    const float* k1,
+                                    const float* k2,
+                                    double kernel_interpolation_factor,
+                                    float* destination);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static void ConvolveInterleaved_AVX2(const float* input_ptr,
+                                       size_t num_channels,
+                                       const float* k1,
+                                       const float* k2,
+                                       double kernel_interpolation_factor,
+                                       float* destination);
+#endif
+
   // The ratio of input / output sample rates.
   double io_sample_rate_ratio_;
 
+  // The number of interleaved channels.
+  const size_t num_channels_;
+
   // An index on the source input buffer with sub-sample precision.  It must be
-  // double precision to avoid drift.
+  // double precision to avoid drift.  Not used with polyphase kernels.
   double virtual_source_idx_;
 
+  // With polyphase kernels, the index on the source input buffer is
+  // `source_idx_` + `phase_` / number of phases, without drift.
+  size_t source_idx_;
+  int phase_;
+
   // The buffer is primed once at the very beginning of processing.
   bool buffer_primed_;
 
@@ -147,12 +209,9 @@ class SincResampler {
   // The size (in samples) of the internal buffer used by the resampler.
   const size_t input_buffer_size_;
 
-  // Contains kKernelOffsetCount kernels back-to-back, each of size kKernelSize.
-  // The kernel offsets are sub-sample shifts of a windowed sinc shifted from
-  // 0.0 to 1.0 sample.
-  std::unique_ptr<float[], AlignedFreeDeleter> kernel_storage_;
-  std::unique_ptr<float[], AlignedFreeDeleter> kernel_pre_sinc_storage_;
-  std::unique_ptr<float[], AlignedFreeDeleter> kernel_window_storage_;
+  // The kernels for `io_sample_rate_ratio_`, laid out for the interleaved
+  // convolution if it is used.
+  std::shared_ptr<const Kernels> kernels_;
 
   // Data from the source is copied into this buffer for each processing pass.
   std::unique_ptr<float[], AlignedFreeDeleter> input_buffer_;
@@ -167,6 +226,18 @@ class SincResampler {
                                 double);
   ConvolveProc convolve_proc_;
 
+  typedef void (*ConvolveInterleavedProc)(const float*,
+                                          size_t,
+                                          const float*,
+                                          const float*,
+                                          double,
+                                          float*);
+  ConvolveInterleavedProc convolve_interleaved_proc_;
+
+  // The number of times each kernel tap is repeated, either 1 or
+  // `num_channels_` for the SIMD interleaved convolution.
+  size_t kernel_channel_stride_;
+
   // Pointers to the various regions inside `input_buffer_`.  See the diagram at
   // the top of the .cc file for more information.
   float* r0_;
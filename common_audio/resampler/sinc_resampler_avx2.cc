@@ -14,6 +14,7 @@
 #include <xmmintrin.h>
 
 #include "common_audio/resampler/sinc_resampler.h"
+#include "rtc_base/checks.h"
 
 namespace webrtc {
 
@@ -28,7 +29,12 @@ float SincResampler::Convolve_AVX2(const float* input_ptr,
   // Based on `input_ptr` alignment, we need to use loadu or load.  Unrolling
   // these loops has not been tested or benchmarked.
   bool aligned_input = (reinterpret_cast<uintptr_t>(input_ptr) & 0x1F) == 0;
-  if (!aligned_input) {
+  if (!k2) {
+    for (size_t i = 0; i < kKernelSize; i += 8) {
+      m_input = _mm256_loadu_ps(input_ptr + i);
+      m_sums1 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k1 + i), m_sums1);
+    }
+  } else if (!aligned_input) {
     for (size_t i = 0; i < kKernelSize; i += 8) {
       m_input = _mm256_loadu_ps(input_ptr + i);
       m_sums1 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k1 + i), m_sums1);
@@ -47,12 +53,15 @@ float SincResampler::Convolve_AVX2(const float* input_ptr,
                                  _mm256_extractf128_ps(m_sums1, 1));
   __m128 m128_sums2 = _mm_add_ps(_mm256_extractf128_ps(m_sums2, 0),
                                  _mm256_extractf128_ps(m_sums2, 1));
-  m128_sums1 = _mm_mul_ps(
-      m128_sums1,
-      _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor)));
-  m128_sums2 = _mm_mul_ps(
-      m128_sums2, _mm_set_ps1(static_cast<float>(kernel_interpolation_factor)));
-  m128_sums1 = _mm_add_ps(m128_sums1, m128_sums2);
+  if (k2) {
+    m128_sums1 = _mm_mul_ps(
+        m128_sums1,
+        _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor)));
+    m128_sums2 = _mm_mul_ps(
+        m128_sums2,
+        _mm_set_ps1(static_cast<float>(kernel_interpolation_factor)));
+    m128_sums1 = _mm_add_ps(m128_sums1, m128_sums2);
+  }
 
   // Sum components together.
   float result;
@@ -63,4 +72,51 @@ float SincResampler::Convolve_AVX2(const float* input_ptr,
   return result;
 }
 
+void SincResampler::ConvolveInterleaved_AVX2(
+    const float* input_ptr,
+    size_t num_channels,
+    const float* k1,
+    const float* k2,
+    double kernel_interpolation_factor,
+    float* destination) {
+  // Each register holds 8 / `num_channels` taps of all channels, multiplied by
+  // kernels with each tap repeated `num_channels` times.
+  const size_t length = kKernelSize * num_channels;
+  __m256 m_sums1 = _mm256_setzero_ps();
+  __m256 m_sums2 = _mm256_setzero_ps();
+  if (!k2) {
+    for (size_t i = 0; i < length; i += 8) {
+      m_sums1 = _mm256_fmadd_ps(_mm256_loadu_ps(input_ptr + i),
+                                _mm256_load_ps(k1 + i), m_sums1);
+    }
+  } else {
+    for (size_t i = 0; i < length; i += 8) {
+      const __m256 m_input = _mm256_loadu_ps(input_ptr + i);
+      m_sums1 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k1 + i), m_sums1);
+      m_sums2 = _mm256_fmadd_ps(m_input, _mm256_load_ps(k2 + i), m_sums2);
+    }
+    // Linearly interpolate the two "convolutions".
+    m_sums1 = _mm256_add_ps(
+        _mm256_mul_ps(m_sums1, _mm256_set1_ps(static_cast<float>(
+                                   1.0 - kernel_interpolation_factor))),
+        _mm256_mul_ps(m_sums2, _mm256_set1_ps(static_cast<float>(
+                                   kernel_interpolation_factor))));
+  }
+
+  // Sum the taps of each channel together.
+  if (num_channels == 8) {
+    _mm256_storeu_ps(destination, m_sums1);
+    return;
+  }
+  __m128 m128_sums = _mm_add_ps(_mm256_castps256_ps128(m_sums1),
+                                _mm256_extractf128_ps(m_sums1, 1));
+  if (num_channels == 4) {
+    _mm_storeu_ps(destination, m128_sums);
+    return;
+  }
+  RTC_DCHECK_EQ(num_channels, 2);
+  m128_sums = _mm_add_ps(m128_sums, _mm_movehl_ps(m128_sums, m128_sums));
+  _mm_storel_pi(reinterpret_cast<__m64*>(destination), m128_sums);
+}
+
 }  // namespace webrtc
@@ -26,6 +26,17 @@ float SincResampler::Convolve_NEON(const float* input_ptr,
   float32x4_t m_sums2 = vmovq_n_f32(0);
 
   const float* upper = input_ptr + kKernelSize;
+  if (!k2) {
+    for (; input_ptr < upper;) {
+      m_input = vld1q_f32(input_ptr);
+      input_ptr += 4;
+      m_sums1 = vmlaq_f32(m_sums1, m_input, vld1q_f32(k1));
+      k1 += 4;
+    }
+    float32x2_t m_half =
+        vadd_f32(vget_high_f32(m_sums1), vget_low_f32(m_sums1));
+    return vget_lane_f32(vpadd_f32(m_half, m_half), 0);
+  }
   for (; input_ptr < upper;) {
     m_input = vld1q_f32(input_ptr);
     input_ptr += 4;
@@ -29,7 +29,12 @@ float SincResampler::Convolve_SSE(const float* input_ptr,
 
   // Based on `input_ptr` alignment, we need to use loadu or load.  Unrolling
   // these loops hurt performance in local testing.
-  if (reinterpret_cast<uintptr_t>(input_ptr) & 0x0F) {
+  if (!k2) {
+    for (size_t i = 0; i < kKernelSize; i += 4) {
+      m_input = _mm_loadu_ps(input_ptr + i);
+      m_sums1 = _mm_add_ps(m_sums1, _mm_mul_ps(m_input, _mm_load_ps(k1 + i)));
+    }
+  } else if (reinterpret_cast<uintptr_t>(input_ptr) & 0x0F) {
     for (size_t i = 0; i < kKernelSize; i += 4) {
       m_input = _mm_loadu_ps(input_ptr + i);
       m_sums1 = _mm_add_ps(m_sums1, _mm_mul_ps(m_input, _mm_load_ps(k1 + i)));
@@ -44,12 +49,14 @@ float SincResampler::Convolve_SSE(const float* input_ptr,
   }
 
   // Linearly interpolate the two "convolutions".
-  m_sums1 = _mm_mul_ps(
-      m_sums1,
-      _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor)));
-  m_sums2 = _mm_mul_ps(
-      m_sums2, _mm_set_ps1(static_cast<float>(kernel_interpolation_factor)));
-  m_sums1 = _mm_add_ps(m_sums1, m_sums2);
+  if (k2) {
+    m_sums1 = _mm_mul_ps(
+        m_sums1,
+        _mm_set_ps1(static_cast<float>(1.0 - kernel_interpolation_factor)));
+    m_sums2 = _mm_mul_ps(
+        m_sums2, _mm_set_ps1(static_cast<float>(kernel_interpolation_factor)));
+    m_sums1 = _mm_add_ps(m_sums1, m_sums2);
+  }
 
   // Sum components together.
   float result;
@@ -23,6 +23,7 @@
 #include <tuple>
 
 #include "common_audio/resampler/sinusoidal_linear_chirp_source.h"
+#include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_base/system/arch.h"
 #include "rtc_base/time_utils.h"
 #include "system_wrappers/include/cpu_features_wrapper.h"
@@ -128,6 +129,7 @@ TEST(SincResamplerTest, Convolve) {
   MockSource mock_source;
   SincResampler resampler(kSampleRateRatio, SincResampler::kDefaultRequestSize,
                           &mock_source);
+  const float* kernel = resampler.get_kernel_for_testing();
 
   // The optimized Convolve methods are slightly more precise than Convolve_C(),
   // so comparison must be done using an epsilon.
@@ -136,20 +138,16 @@ TEST(SincResamplerTest, Convolve) {
   // Use a kernel from SincResampler as input and kernel data, this has the
   // benefit of already being properly sized and aligned for Convolve_SSE().
   double result = resampler.Convolve_C(
-      resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
-      resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+      kernel, kernel, kernel, kKernelInterpolationFactor);
   double result2 = resampler.convolve_proc_(
-      resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
-      resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+      kernel, kernel, kernel, kKernelInterpolationFactor);
   EXPECT_NEAR(result2, result, kEpsilon);
 
   // Test Convolve() w/ unaligned input pointer.
   result = resampler.Convolve_C(
-      resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
-      resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+      kernel + 1, kernel, kernel, kKernelInterpolationFactor);
   result2 = resampler.convolve_proc_(
-      resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
-      resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+      kernel + 1, kernel, kernel, kKernelInterpolationFactor);
   EXPECT_NEAR(result2, result, kEpsilon);
 }
 
@@ -161,6 +159,7 @@ TEST(SincResamplerTest, ConvolveBenchmark) {
   MockSource mock_source;
   SincResampler resampler(kSampleRateRatio, SincResampler::kDefaultRequestSize,
                           &mock_source);
+  const float* kernel = resampler.get_kernel_for_testing();
 
   // Retrieve benchmark iterations from command line.
   // TODO(ajm): Reintroduce this as a command line option.
@@ -172,8 +171,7 @@ TEST(SincResamplerTest, ConvolveBenchmark) {
   int64_t start = TimeNanos();
   for (int i = 0; i < kConvolveIterations; ++i) {
     resampler.Convolve_C(
-        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
-        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+        kernel, kernel, kernel, kKernelInterpolationFactor);
   }
   double total_time_c_us = (TimeNanos() - start) / kNumNanosecsPerMicrosec;
   printf("Convolve_C took %.2fms.\n", total_time_c_us / 1000);
@@ -188,8 +186,7 @@ TEST(SincResamplerTest, ConvolveBenchmark) {
   start = TimeNanos();
   for (int j = 0; j < kConvolveIterations; ++j) {
     resampler.convolve_proc_(
-        resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
-        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+        kernel + 1, kernel, kernel, kKernelInterpolationFactor);
   }
   double total_time_optimized_unaligned_us =
       (TimeNanos() - start) / kNumNanosecsPerMicrosec;
@@ -203,8 +200,7 @@ TEST(SincResamplerTest, ConvolveBenchmark) {
   start = TimeNanos();
   for (int j = 0; j < kConvolveIterations; ++j) {
     resampler.convolve_proc_(
-        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
-        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+        kernel, kernel, kernel, kKernelInterpolationFactor);
   }
   double total_time_optimized_aligned_us =
       (TimeNanos() - start) / kNumNanosecsPerMicrosec;
@@ -217,6 +213,126 @@ TEST(SincResamplerTest, ConvolveBenchmark) {
       total_time_optimized_unaligned_us / total_time_optimized_aligned_us);
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Ensure the SIMD interleaved convolution, which takes kernels with each tap
+// repeated for every channel, matches the generic one.
+TEST(SincResamplerTest, ConvolveInterleaved) {
+  MockSource mock_source;
+  SincResampler resampler(kSampleRateRatio, SincResampler::kDefaultRequestSize,
+                          &mock_source);
+  const float* kernel = resampler.get_kernel_for_testing();
+  static const double kEpsilon = 0.00000005;
+
+  for (size_t num_channels : {2, 4, 8}) {
+    if (!SincResampler::HasFastInterleavedPath(num_channels))
+      continue;
+    SCOPED_TRACE(num_channels);
+    const size_t length = SincResampler::kKernelSize * num_channels;
+    std::unique_ptr<float[], AlignedFreeDeleter> expanded(
+        static_cast<float*>(AlignedMalloc(sizeof(float) * 2 * length, 32)));
+    std::unique_ptr<float[]> input(new float[length + 1]);
+    for (size_t i = 0; i < length; ++i) {
+      const size_t tap = i / num_channels;
+      expanded[i] = kernel[tap];
+      expanded[length + i] = kernel[SincResampler::kKernelSize + tap];
+    }
+    for (size_t i = 0; i < length + 1; ++i)
+      input[i] = sinf(0.1f * i);
+
+    float result[8];
+    float result2[8];
+    // Test both the interpolated and the single kernel convolution, with an
+    // unaligned input pointer.
+    for (const float* k2 : {kernel + SincResampler::kKernelSize,
+                            static_cast<const float*>(nullptr)}) {
+      SincResampler::ConvolveInterleaved_C(input.get() + 1, num_channels,
+                                           kernel, k2,
+                                           kKernelInterpolationFactor, result);
+      SincResampler::ConvolveInterleaved_AVX2(
+          input.get() + 1, num_channels, expanded.get(),
+          k2 ? expanded.get() + length : nullptr, kKernelInterpolationFactor,
+          result2);
+      for (size_t c = 0; c < num_channels; ++c)
+        EXPECT_NEAR(result2[c], result[c], kEpsilon);
+    }
+  }
+}
+#endif
+
+// Source of `num_channels` interleaved chirps, channel `c` being the chirp of
+// SinusoidalLinearChirpSource scaled by `c` + 1.
+class InterleavedChirpSource : public SincResamplerCallback {
+ public:
+  InterleavedChirpSource(int sample_rate, size_t num_channels)
+      : chirp_(sample_rate, sample_rate, 0.5 * sample_rate, 0),
+        num_channels_(num_channels) {}
+
+  void Run(size_t frames, float* destination) override {
+    std::unique_ptr<float[]> mono(new float[frames]);
+    chirp_.Run(frames, mono.get());
+    for (size_t i = 0; i < frames; ++i) {
+      for (size_t c = 0; c < num_channels_; ++c)
+        destination[i * num_channels_ + c] = mono[i] * (c + 1);
+    }
+  }
+
+ private:
+  SinusoidalLinearChirpSource chirp_;
+  const size_t num_channels_;
+};
+
+// Ensure resampling interleaved channels gives the same result as resampling
+// each channel separately, for polyphase and interpolated ratios.
+TEST(SincResamplerTest, InterleavedMatchesMono) {
+  static const size_t kOutputFrames = 4800;
+  for (int input_rate : {8000, 16000, 44100, 48000}) {
+    for (int output_rate : {8000, 16000, 48000}) {
+      for (size_t num_channels : {2, 3, 8}) {
+        SCOPED_TRACE(::testing::Message() << input_rate << " -> "
+                                          << output_rate << ", "
+                                          << num_channels << " channels");
+        const double ratio = input_rate / static_cast<double>(output_rate);
+        InterleavedChirpSource mono_source(input_rate, 1);
+        SincResampler mono(ratio, SincResampler::kDefaultRequestSize,
+                           &mono_source);
+        InterleavedChirpSource source(input_rate, num_channels);
+        SincResampler interleaved(ratio, SincResampler::kDefaultRequestSize,
+                                  num_channels, &source);
+
+        std::unique_ptr<float[]> expected(new float[kOutputFrames]);
+        std::unique_ptr<float[]> result(
+            new float[kOutputFrames * num_channels]);
+        mono.Resample(kOutputFrames, expected.get());
+        interleaved.Resample(kOutputFrames, result.get());
+        for (size_t i = 0; i < kOutputFrames; ++i) {
+          for (size_t c = 0; c < num_channels; ++c) {
+            ASSERT_NEAR(result[i * num_channels + c], expected[i] * (c + 1),
+                        1e-5 * (c + 1));
+          }
+        }
+      }
+    }
+  }
+}
+
+// Ensure resamplers with the same ratio share their kernels.
+TEST(SincResamplerTest, SharesKernels) {
+  MockSource mock_source;
+  SincResampler resampler1(kSampleRateRatio, SincResampler::kDefaultRequestSize,
+                           &mock_source);
+  SincResampler resampler2(kSampleRateRatio, SincResampler::kDefaultRequestSize,
+                           &mock_source);
+  SincResampler resampler3(1.0 / kSampleRateRatio,
+                           SincResampler::kDefaultRequestSize, &mock_source);
+  EXPECT_EQ(resampler1.get_kernel_for_testing(),
+            resampler2.get_kernel_for_testing());
+  EXPECT_NE(resampler1.get_kernel_for_testing(),
+            resampler3.get_kernel_for_testing());
+  resampler3.SetRatio(kSampleRateRatio);
+  EXPECT_EQ(resampler1.get_kernel_for_testing(),
+            resampler3.get_kernel_for_testing());
+}
+
 typedef std::tuple<int, int, double, double> SincResamplerTestData;
 class SincResamplerTest
     : public ::testing::TestWithParam<SincResamplerTestData> {
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <smmintrin.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+// Longest filter handled with SIMD, in multiples of 8 coefficients.
+#define MAX_COEFFICIENT_BLOCKS 4
+
+// SSE4.1 version of WebRtcSpl_DownsampleFast() for x86 platforms. Each output
+// sample is the dot product of a window of the input with the reversed filter,
+// zero-padded to a multiple of 8 coefficients, and four output samples are
+// computed at a time. The output samples whose zero-padded window would reach
+// beyond the end of the input are left to the C version.
+int WebRtcSpl_DownsampleFastSse41(const int16_t* data_in,
+                                  size_t data_in_length,
+                                  int16_t* data_out,
+                                  size_t data_out_length,
+                                  const int16_t* __restrict coefficients,
+                                  size_t coefficients_length,
+                                  int factor,
+                                  size_t delay) {
+  size_t endpos = delay + factor * (data_out_length - 1) + 1;
+  size_t num_blocks = (coefficients_length + 7) / 8;
+  int16_t reversed[8 * MAX_COEFFICIENT_BLOCKS] = {0};
+  __m128i coefficient_blocks[MAX_COEFFICIENT_BLOCKS];
+  size_t i = 0;
+  size_t j = 0;
+  size_t k = 0;
+
+  // Return error if any of the running conditions doesn't meet.
+  if (data_out_length == 0 || coefficients_length == 0 ||
+      data_in_length < endpos) {
+    return -1;
+  }
+  if (num_blocks > MAX_COEFFICIENT_BLOCKS) {
+    return WebRtcSpl_DownsampleFastC(data_in, data_in_length, data_out,
+                                     data_out_length, coefficients,
+                                     coefficients_length, factor, delay);
+  }
+
+  for (j = 0; j < coefficients_length; j++) {
+    reversed[coefficients_length - 1 - j] = coefficients[j];
+  }
+  for (j = 0; j < num_blocks; j++) {
+    coefficient_blocks[j] = _mm_loadu_si128((const __m128i*)&reversed[8 * j]);
+  }
+
+  const __m128i round = _mm_set1_epi32(2048);  // 0.5 in Q12.
+  for (; k + 4 <= data_out_length; k += 4) {
+    // The window of output sample `n` starts at data_in[i_n + 1 - length].
+    const size_t last_i = delay + (k + 3) * factor;
+    if (last_i + 8 * num_blocks > data_in_length + coefficients_length - 1) {
+      break;
+    }
+    __m128i sums[4];
+    for (i = 0; i < 4; i++) {
+      const int16_t* window =
+          &data_in[delay + (k + i) * factor + 1 - coefficients_length];
+      sums[i] = _mm_setzero_si128();
+      for (j = 0; j < num_blocks; j++) {
+        const __m128i x = _mm_loadu_si128((const __m128i*)&window[8 * j]);
+        sums[i] =
+            _mm_add_epi32(sums[i], _mm_madd_epi16(x, coefficient_blocks[j]));
+      }
+    }
+    __m128i out = _mm_hadd_epi32(_mm_hadd_epi32(sums[0], sums[1]),
+                                 _mm_hadd_epi32(sums[2], sums[3]));
+    out = _mm_srai_epi32(_mm_add_epi32(out, round), 12);  // Q0.
+    // Saturate and store the output.
+    _mm_storel_epi64((__m128i*)&data_out[k], _mm_packs_epi32(out, out));
+  }
+
+  if (k < data_out_length) {
+    return WebRtcSpl_DownsampleFastC(
+        data_in, data_in_length, &data_out[k], data_out_length - k,
+        coefficients, coefficients_length, factor, delay + k * factor);
+  }
+  return 0;
+}
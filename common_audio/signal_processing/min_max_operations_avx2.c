@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+#include <stdlib.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/checks.h"
+
+// AVX2 version of WebRtcSpl_MaxAbsValueW16() for x86 platforms.
+int16_t WebRtcSpl_MaxAbsValueW16Avx2(const int16_t* vector, size_t length) {
+  size_t i = 0;
+  int absolute = 0, maximum = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  // The absolute values are compared as unsigned, so that abs(-32768) is
+  // 32768 rather than -32768.
+  __m256i max_value = _mm256_setzero_si256();
+  for (; i + 16 <= length; i += 16) {
+    const __m256i x = _mm256_loadu_si256((const __m256i*)&vector[i]);
+    max_value = _mm256_max_epu16(max_value, _mm256_abs_epi16(x));
+  }
+  __m128i max_value128 = _mm_max_epu16(_mm256_castsi256_si128(max_value),
+                                       _mm256_extracti128_si256(max_value, 1));
+  // The minimum of the inverted values is the inverted maximum.
+  max_value128 =
+      _mm_minpos_epu16(_mm_xor_si128(max_value128, _mm_set1_epi16(-1)));
+  maximum = 0xFFFF - (_mm_cvtsi128_si32(max_value128) & 0xFFFF);
+
+  for (; i < length; i++) {
+    absolute = abs((int)vector[i]);
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  // Guard the case for abs(-32768).
+  if (maximum > WEBRTC_SPL_WORD16_MAX) {
+    maximum = WEBRTC_SPL_WORD16_MAX;
+  }
+
+  return (int16_t)maximum;
+}
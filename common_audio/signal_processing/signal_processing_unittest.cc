@@ -12,11 +12,15 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <vector>
 
 #include "common_audio/signal_processing/dot_product_with_scale.h"
 #include "common_audio/signal_processing/include/signal_processing_library.h"
 #include "common_audio/signal_processing/include/spl_inl.h"
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
 #include "test/gtest.h"
 
 static const int16_t vector16[] = {1,
@@ -550,7 +554,7 @@ TEST(SplTest, CrossCorrelationTest) {
   const int32_t kExpected[kCrossCorrelationDimension] = {-266947903, -15579555,
                                                          -171282001};
   const int32_t* expected = kExpected;
-#if !defined(MIPS32_LE)
+#if defined(WEBRTC_HAS_NEON)
   const int32_t kExpectedNeon[kCrossCorrelationDimension] = {
       -266947901, -15579553, -171281999};
   if (WebRtcSpl_CrossCorrelation != WebRtcSpl_CrossCorrelationC) {
@@ -677,3 +681,141 @@ TEST(SplTest, Resample48WithSaturationTest) {
     EXPECT_EQ(kRefValue16kHz2, out_vector_w16[i]);
   }
 }
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+namespace {
+
+struct X86Kernels {
+  const char* name;
+  MaxAbsValueW16 max_abs_value_w16;
+  CrossCorrelation cross_correlation;
+  DownsampleFast downsample_fast;
+};
+
+// The x86 versions supported by the CPU running the test.
+std::vector<X86Kernels> SupportedX86Kernels() {
+  std::vector<X86Kernels> kernels;
+  if (webrtc::GetCPUInfo(webrtc::kSSE4_1) != 0) {
+    kernels.push_back({.name = "SSE4.1",
+                       .max_abs_value_w16 = WebRtcSpl_MaxAbsValueW16Sse41,
+                       .cross_correlation = WebRtcSpl_CrossCorrelationSse41,
+                       .downsample_fast = WebRtcSpl_DownsampleFastSse41});
+  }
+  if (webrtc::GetCPUInfo(webrtc::kAVX2) != 0) {
+    kernels.push_back({.name = "AVX2",
+                       .max_abs_value_w16 = WebRtcSpl_MaxAbsValueW16Avx2,
+                       .cross_correlation = WebRtcSpl_CrossCorrelationAvx2,
+                       .downsample_fast = WebRtcSpl_DownsampleFastAvx2});
+  }
+  return kernels;
+}
+
+std::vector<int16_t> RandomVector(webrtc::Random& random,
+                                  size_t length,
+                                  int amplitude) {
+  std::vector<int16_t> vector(length);
+  for (int16_t& sample : vector) {
+    sample = random.Rand(-amplitude, amplitude);
+  }
+  return vector;
+}
+
+}  // namespace
+
+// Unlike the NEON versions, the x86 versions are bit-exact with C.
+TEST(SplTest, MaxAbsValueW16X86IsBitExact) {
+  webrtc::Random random(42);
+  for (const X86Kernels& kernels : SupportedX86Kernels()) {
+    SCOPED_TRACE(kernels.name);
+    for (size_t length = 1; length < 100; ++length) {
+      std::vector<int16_t> vector =
+          RandomVector(random, length, random.Rand(1, 32767));
+      EXPECT_EQ(WebRtcSpl_MaxAbsValueW16C(vector.data(), length),
+                kernels.max_abs_value_w16(vector.data(), length));
+      // abs(-32768) is saturated.
+      vector[random.Rand(0, length - 1)] = WEBRTC_SPL_WORD16_MIN;
+      EXPECT_EQ(WEBRTC_SPL_WORD16_MAX,
+                kernels.max_abs_value_w16(vector.data(), length));
+    }
+  }
+}
+
+TEST(SplTest, CrossCorrelationX86IsBitExact) {
+  constexpr size_t kMaxSeqDimension = 160;
+  constexpr size_t kCrossCorrelationDimension = 20;
+  webrtc::Random random(42);
+  for (const X86Kernels& kernels : SupportedX86Kernels()) {
+    SCOPED_TRACE(kernels.name);
+    for (int right_shifts : {0, 1, 3, 6}) {
+      // Large enough for negative products, without overflowing the sum.
+      const int amplitude = 3000 << (right_shifts / 2);
+      const std::vector<int16_t> seq1 =
+          RandomVector(random, kMaxSeqDimension, amplitude);
+      const std::vector<int16_t> seq2 = RandomVector(
+          random, kMaxSeqDimension + kCrossCorrelationDimension, amplitude);
+      for (size_t dim_seq = 1; dim_seq <= kMaxSeqDimension; ++dim_seq) {
+        for (int step_seq2 : {-1, 1}) {
+          const int16_t* seq2_start =
+              step_seq2 > 0 ? seq2.data()
+                            : seq2.data() + kCrossCorrelationDimension - 1;
+          int32_t expected[kCrossCorrelationDimension];
+          int32_t actual[kCrossCorrelationDimension];
+          WebRtcSpl_CrossCorrelationC(expected, seq1.data(), seq2_start,
+                                      dim_seq, kCrossCorrelationDimension,
+                                      right_shifts, step_seq2);
+          kernels.cross_correlation(actual, seq1.data(), seq2_start, dim_seq,
+                                    kCrossCorrelationDimension, right_shifts,
+                                    step_seq2);
+          for (size_t i = 0; i < kCrossCorrelationDimension; ++i) {
+            ASSERT_EQ(expected[i], actual[i])
+                << "dim_seq=" << dim_seq << " right_shifts=" << right_shifts
+                << " step_seq2=" << step_seq2 << " i=" << i;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(SplTest, DownsampleFastX86IsBitExact) {
+  webrtc::Random random(42);
+  for (const X86Kernels& kernels : SupportedX86Kernels()) {
+    SCOPED_TRACE(kernels.name);
+    // Includes filters too long for the SIMD path.
+    for (size_t coefficients_length : {1, 3, 5, 7, 8, 9, 17, 32, 33}) {
+      // Saturates the output without overflowing the sum.
+      const std::vector<int16_t> coefficients = RandomVector(
+          random, coefficients_length, 32767 / coefficients_length);
+      for (int factor : {1, 2, 3, 4, 8, 12}) {
+        for (size_t data_out_length = 1; data_out_length < 40;
+             ++data_out_length) {
+          const size_t delay = coefficients_length - 1 + random.Rand(0, 3);
+          const size_t data_in_length =
+              delay + factor * (data_out_length - 1) + 1 + random.Rand(0, 20);
+          const std::vector<int16_t> data_in =
+              RandomVector(random, data_in_length, 32767);
+          std::vector<int16_t> expected(data_out_length);
+          std::vector<int16_t> actual(data_out_length);
+          ASSERT_EQ(0, WebRtcSpl_DownsampleFastC(
+                           data_in.data(), data_in_length, expected.data(),
+                           data_out_length, coefficients.data(),
+                           coefficients_length, factor, delay));
+          ASSERT_EQ(0, kernels.downsample_fast(
+                           data_in.data(), data_in_length, actual.data(),
+                           data_out_length, coefficients.data(),
+                           coefficients_length, factor, delay));
+          ASSERT_EQ(expected, actual)
+              << "coefficients_length=" << coefficients_length
+              << " factor=" << factor << " data_out_length=" << data_out_length;
+        }
+      }
+    }
+    // Too short input.
+    int16_t data_in[10] = {0};
+    int16_t data_out[4];
+    const int16_t coefficients[3] = {1024, 2048, 1024};
+    EXPECT_EQ(-1, kernels.downsample_fast(data_in, 10, data_out, 4,
+                                          coefficients, 3, 4, 2));
+  }
+}
+#endif  // defined(WEBRTC_ARCH_X86_FAMILY)
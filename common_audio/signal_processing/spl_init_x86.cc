@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Runtime dispatch of the SPL function pointers on x86, where, unlike NEON on
+// ARM, the SIMD extensions beyond SSE2 are not known at compile time.
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace {
+
+template <typename Function>
+Function Select(Function c, Function sse41, Function avx2) {
+  if (webrtc::GetCPUInfo(webrtc::kAVX2) != 0) {
+    return avx2;
+  }
+  if (webrtc::GetCPUInfo(webrtc::kSSE4_1) != 0) {
+    return sse41;
+  }
+  return c;
+}
+
+}  // namespace
+
+int16_t WebRtcSpl_MaxAbsValueW16X86(const int16_t* vector, size_t length) {
+  static const MaxAbsValueW16 implementation =
+      Select<MaxAbsValueW16>(WebRtcSpl_MaxAbsValueW16C,
+                             WebRtcSpl_MaxAbsValueW16Sse41,
+                             WebRtcSpl_MaxAbsValueW16Avx2);
+  return implementation(vector, length);
+}
+
+void WebRtcSpl_CrossCorrelationX86(int32_t* cross_correlation,
+                                   const int16_t* seq1,
+                                   const int16_t* seq2,
+                                   size_t dim_seq,
+                                   size_t dim_cross_correlation,
+                                   int right_shifts,
+                                   int step_seq2) {
+  static const CrossCorrelation implementation =
+      Select<CrossCorrelation>(WebRtcSpl_CrossCorrelationC,
+                               WebRtcSpl_CrossCorrelationSse41,
+                               WebRtcSpl_CrossCorrelationAvx2);
+  implementation(cross_correlation, seq1, seq2, dim_seq, dim_cross_correlation,
+                 right_shifts, step_seq2);
+}
+
+int WebRtcSpl_DownsampleFastX86(const int16_t* data_in,
+                                size_t data_in_length,
+                                int16_t* data_out,
+                                size_t data_out_length,
+                                const int16_t* __restrict coefficients,
+                                size_t coefficients_length,
+                                int factor,
+                                size_t delay) {
+  static const DownsampleFast implementation =
+      Select<DownsampleFast>(WebRtcSpl_DownsampleFastC,
+                             WebRtcSpl_DownsampleFastSse41,
+                             WebRtcSpl_DownsampleFastAvx2);
+  return implementation(data_in, data_in_length, data_out, data_out_length,
+                        coefficients, coefficients_length, factor, delay);
+}
@@ -0,0 +1,379 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/frame_quality_metrics.h"
+
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSsimWindowSize = 8;
+constexpr int kSsimWindowStep = 4;
+// (k1 * L)^2 and (k2 * L)^2 with k1 = 0.01, k2 = 0.03 and L = 255.
+constexpr double kSsimC1 = 6.5025;
+constexpr double kSsimC2 = 58.5225;
+
+constexpr double kLumaSsimWeight = 0.8;
+constexpr double kChromaSsimWeight = 0.1;
+
+// 64 bit, since regions too small for a window are summed as a whole and
+// may be arbitrarily tall or wide, e.g. 7x9500 samples.
+struct SsimSums {
+  uint64_t a = 0;
+  uint64_t b = 0;
+  uint64_t aa = 0;
+  uint64_t bb = 0;
+  uint64_t ab = 0;
+};
+
+// Sums over a window or region of `count` samples. The products of `count` and
+// the sums are exact in a double for up to ~3 * 10^5 samples.
+double SsimFromSums(const SsimSums& sums, int64_t count) {
+  const double n = count;
+  const double a = sums.a;
+  const double b = sums.b;
+  const double c1 = kSsimC1 * n * n;
+  const double c2 = kSsimC2 * n * n;
+  const double numerator =
+      (2 * a * b + c1) * (2 * n * sums.ab - 2 * a * b + c2);
+  const double denominator = (a * a + b * b + c1) *
+                             (n * sums.aa - a * a + n * sums.bb - b * b + c2);
+  return numerator / denominator;
+}
+
+#if defined(WEBRTC_HAS_NEON)
+// vaddvq_* are only available on AArch64.
+uint64_t HorizontalSum(uint32x4_t v) {
+  const uint64x2_t pairs = vpaddlq_u32(v);
+  return vgetq_lane_u64(pairs, 0) + vgetq_lane_u64(pairs, 1);
+}
+
+uint32_t HorizontalSum(uint16x8_t v) {
+  return static_cast<uint32_t>(HorizontalSum(vpaddlq_u16(v)));
+}
+#endif
+
+uint64_t SumSquaredErrorRow(const uint8_t* a, const uint8_t* b, int width) {
+  int x = 0;
+  uint64_t sum = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc = _mm_setzero_si128();
+  for (; x + 16 <= width; x += 16) {
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x));
+    const __m128i diff =
+        _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+    const __m128i lo = _mm_unpacklo_epi8(diff, zero);
+    const __m128i hi = _mm_unpackhi_epi8(diff, zero);
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(lo, lo));
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(hi, hi));
+  }
+  alignas(16) uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  sum = uint64_t{lanes[0]} + lanes[1] + lanes[2] + lanes[3];
+#elif defined(WEBRTC_HAS_NEON)
+  uint32x4_t acc = vdupq_n_u32(0);
+  for (; x + 16 <= width; x += 16) {
+    const uint8x16_t diff = vabdq_u8(vld1q_u8(a + x), vld1q_u8(b + x));
+    acc = vpadalq_u16(acc, vmull_u8(vget_low_u8(diff), vget_low_u8(diff)));
+    acc = vpadalq_u16(acc, vmull_u8(vget_high_u8(diff), vget_high_u8(diff)));
+  }
+  sum = HorizontalSum(acc);
+#endif
+  for (; x < width; ++x) {
+    const int diff = a[x] - b[x];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+SsimSums SsimSumsForWindow(const uint8_t* a,
+                           int stride_a,
+                           const uint8_t* b,
+                           int stride_b) {
+  SsimSums sums;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i sum_a = _mm_setzero_si128();
+  __m128i sum_b = _mm_setzero_si128();
+  __m128i sum_aa = _mm_setzero_si128();
+  __m128i sum_bb = _mm_setzero_si128();
+  __m128i sum_ab = _mm_setzero_si128();
+  for (int y = 0; y < kSsimWindowSize; ++y) {
+    const __m128i va = _mm_unpacklo_epi8(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + y * stride_a)),
+        zero);
+    const __m128i vb = _mm_unpacklo_epi8(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + y * stride_b)),
+        zero);
+    sum_a = _mm_add_epi16(sum_a, va);
+    sum_b = _mm_add_epi16(sum_b, vb);
+    sum_aa = _mm_add_epi32(sum_aa, _mm_madd_epi16(va, va));
+    sum_bb = _mm_add_epi32(sum_bb, _mm_madd_epi16(vb, vb));
+    sum_ab = _mm_add_epi32(sum_ab, _mm_madd_epi16(va, vb));
+  }
+  // Widen the 16 bit sums of `a` and `b` to 32 bits by pairs.
+  const __m128i ones = _mm_set1_epi16(1);
+  sum_a = _mm_madd_epi16(sum_a, ones);
+  sum_b = _mm_madd_epi16(sum_b, ones);
+  alignas(16) uint32_t lanes[5][4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), sum_a);
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), sum_b);
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes[2]), sum_aa);
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes[3]), sum_bb);
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes[4]), sum_ab);
+  uint32_t totals[5];
+  for (int i = 0; i < 5; ++i) {
+    totals[i] = lanes[i][0] + lanes[i][1] + lanes[i][2] + lanes[i][3];
+  }
+  sums = {.a = totals[0],
+          .b = totals[1],
+          .aa = totals[2],
+          .bb = totals[3],
+          .ab = totals[4]};
+#elif defined(WEBRTC_HAS_NEON)
+  uint16x8_t sum_a = vdupq_n_u16(0);
+  uint16x8_t sum_b = vdupq_n_u16(0);
+  uint32x4_t sum_aa = vdupq_n_u32(0);
+  uint32x4_t sum_bb = vdupq_n_u32(0);
+  uint32x4_t sum_ab = vdupq_n_u32(0);
+  for (int y = 0; y < kSsimWindowSize; ++y) {
+    const uint8x8_t va = vld1_u8(a + y * stride_a);
+    const uint8x8_t vb = vld1_u8(b + y * stride_b);
+    sum_a = vaddw_u8(sum_a, va);
+    sum_b = vaddw_u8(sum_b, vb);
+    sum_aa = vpadalq_u16(sum_aa, vmull_u8(va, va));
+    sum_bb = vpadalq_u16(sum_bb, vmull_u8(vb, vb));
+    sum_ab = vpadalq_u16(sum_ab, vmull_u8(va, vb));
+  }
+  sums = {.a = HorizontalSum(sum_a),
+          .b = HorizontalSum(sum_b),
+          .aa = static_cast<uint32_t>(HorizontalSum(sum_aa)),
+          .bb = static_cast<uint32_t>(HorizontalSum(sum_bb)),
+          .ab = static_cast<uint32_t>(HorizontalSum(sum_ab))};
+#else
+  for (int y = 0; y < kSsimWindowSize; ++y) {
+    for (int x = 0; x < kSsimWindowSize; ++x) {
+      const uint32_t va = a[y * stride_a + x];
+      const uint32_t vb = b[y * stride_b + x];
+      sums.a += va;
+      sums.b += vb;
+      sums.aa += va * va;
+      sums.bb += vb * vb;
+      sums.ab += va * vb;
+    }
+  }
+#endif
+  return sums;
+}
+
+// A `width` x `height` region of a plane in both frames.
+struct PlaneRegion {
+  const uint8_t* reference;
+  int reference_stride;
+  const uint8_t* test;
+  int test_stride;
+  int width;
+  int height;
+};
+
+// Accumulated squared error and SSIM of a plane, over one or more regions.
+class PlaneScore {
+ public:
+  void Add(const PlaneRegion& region) {
+    sse_ += SumSquaredError(region.reference, region.reference_stride,
+                            region.test, region.test_stride, region.width,
+                            region.height);
+    num_samples_ += int64_t{region.width} * region.height;
+    AddSsim(region);
+  }
+
+  uint64_t sse() const { return sse_; }
+  int64_t num_samples() const { return num_samples_; }
+  double ssim() const {
+    return num_windows_ > 0 ? ssim_sum_ / num_windows_ : 1.0;
+  }
+
+ private:
+  void AddSsim(const PlaneRegion& region) {
+    if (region.width < kSsimWindowSize || region.height < kSsimWindowSize) {
+      // Too small for a single window; use the whole region as one.
+      SsimSums sums;
+      for (int y = 0; y < region.height; ++y) {
+        for (int x = 0; x < region.width; ++x) {
+          const uint32_t va = region.reference[y * region.reference_stride + x];
+          const uint32_t vb = region.test[y * region.test_stride + x];
+          sums.a += va;
+          sums.b += vb;
+          sums.aa += va * va;
+          sums.bb += vb * vb;
+          sums.ab += va * vb;
+        }
+      }
+      ssim_sum_ += SsimFromSums(sums, int64_t{region.width} * region.height);
+      ++num_windows_;
+      return;
+    }
+    for (int y = 0; y + kSsimWindowSize <= region.height;
+         y += kSsimWindowStep) {
+      for (int x = 0; x + kSsimWindowSize <= region.width;
+           x += kSsimWindowStep) {
+        ssim_sum_ += SsimFromSums(
+            SsimSumsForWindow(
+                region.reference + y * region.reference_stride + x,
+                region.reference_stride,
+                region.test + y * region.test_stride + x, region.test_stride),
+            kSsimWindowSize * kSsimWindowSize);
+        ++num_windows_;
+      }
+    }
+  }
+
+  uint64_t sse_ = 0;
+  int64_t num_samples_ = 0;
+  double ssim_sum_ = 0.0;
+  int num_windows_ = 0;
+};
+
+FrameQuality ToFrameQuality(const PlaneScore& y,
+                            const PlaneScore& u,
+                            const PlaneScore& v) {
+  const uint64_t sse = y.sse() + u.sse() + v.sse();
+  const int64_t num_samples =
+      y.num_samples() + u.num_samples() + v.num_samples();
+  double psnr = kPerfectPSNR;
+  if (sse > 0) {
+    const double mse = static_cast<double>(sse) / num_samples;
+    psnr = std::min(kPerfectPSNR, 10.0 * std::log10(255.0 * 255.0 / mse));
+  }
+  return {.psnr = psnr,
+          .ssim = kLumaSsimWeight * y.ssim() +
+                  kChromaSsimWeight * (u.ssim() + v.ssim())};
+}
+
+PlaneRegion Region(const uint8_t* reference,
+                   int reference_stride,
+                   const uint8_t* test,
+                   int test_stride,
+                   int x,
+                   int y,
+                   int width,
+                   int height) {
+  return {.reference = reference + y * reference_stride + x,
+          .reference_stride = reference_stride,
+          .test = test + y * test_stride + x,
+          .test_stride = test_stride,
+          .width = width,
+          .height = height};
+}
+
+// Start of a block of `block_size` centered on `fraction` of `size`, moved
+// inside [0, size) if needed.
+int BlockStart(double fraction, int size, int block_size) {
+  const int center = static_cast<int>(fraction * size);
+  return std::clamp(center - block_size / 2, 0, std::max(0, size - block_size));
+}
+
+}  // namespace
+
+uint64_t SumSquaredError(const uint8_t* reference,
+                         int reference_stride,
+                         const uint8_t* test,
+                         int test_stride,
+                         int width,
+                         int height) {
+  uint64_t sse = 0;
+  for (int y = 0; y < height; ++y) {
+    sse += SumSquaredErrorRow(reference + y * reference_stride,
+                              test + y * test_stride, width);
+  }
+  return sse;
+}
+
+FrameQuality ComputeFrameQuality(const I420BufferInterface& reference,
+                                 const I420BufferInterface& test) {
+  RTC_DCHECK_EQ(reference.width(), test.width());
+  RTC_DCHECK_EQ(reference.height(), test.height());
+  PlaneScore y;
+  PlaneScore u;
+  PlaneScore v;
+  y.Add(Region(reference.DataY(), reference.StrideY(), test.DataY(),
+               test.StrideY(), 0, 0, test.width(), test.height()));
+  u.Add(Region(reference.DataU(), reference.StrideU(), test.DataU(),
+               test.StrideU(), 0, 0, test.ChromaWidth(), test.ChromaHeight()));
+  v.Add(Region(reference.DataV(), reference.StrideV(), test.DataV(),
+               test.StrideV(), 0, 0, test.ChromaWidth(), test.ChromaHeight()));
+  return ToFrameQuality(y, u, v);
+}
+
+FrameQuality ComputeSampledFrameQuality(
+    const I420BufferInterface& reference,
+    const I420BufferInterface& test,
+    ArrayView<const QualitySamplePosition> positions) {
+  RTC_DCHECK_EQ(reference.width(), test.width());
+  RTC_DCHECK_EQ(reference.height(), test.height());
+  const int width = test.width();
+  const int height = test.height();
+  const int luma_width = std::min(width, kQualitySampleBlockSize);
+  const int luma_height = std::min(height, kQualitySampleBlockSize);
+  const int chroma_width =
+      std::min(test.ChromaWidth(), kQualitySampleBlockSize / 2);
+  const int chroma_height =
+      std::min(test.ChromaHeight(), kQualitySampleBlockSize / 2);
+
+  PlaneScore y;
+  PlaneScore u;
+  PlaneScore v;
+  for (const QualitySamplePosition& position : positions) {
+    RTC_DCHECK_GE(position.row, 0.0);
+    RTC_DCHECK_LT(position.row, 1.0);
+    RTC_DCHECK_GE(position.column, 0.0);
+    RTC_DCHECK_LT(position.column, 1.0);
+    const int luma_x =
+        BlockStart(position.column, width, kQualitySampleBlockSize);
+    const int luma_y =
+        BlockStart(position.row, height, kQualitySampleBlockSize);
+    y.Add(Region(reference.DataY(), reference.StrideY(), test.DataY(),
+                 test.StrideY(), luma_x, luma_y, luma_width, luma_height));
+    // Co-located chroma; `luma_x` and `luma_y` may be odd.
+    const int chroma_x =
+        std::min(luma_x / 2, test.ChromaWidth() - chroma_width);
+    const int chroma_y =
+        std::min(luma_y / 2, test.ChromaHeight() - chroma_height);
+    u.Add(Region(reference.DataU(), reference.StrideU(), test.DataU(),
+                 test.StrideU(), chroma_x, chroma_y, chroma_width,
+                 chroma_height));
+    v.Add(Region(reference.DataV(), reference.StrideV(), test.DataV(),
+                 test.StrideV(), chroma_x, chroma_y, chroma_width,
+                 chroma_height));
+  }
+  return ToFrameQuality(y, u, v);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_FRAME_QUALITY_METRICS_H_
+#define COMMON_VIDEO_FRAME_QUALITY_METRICS_H_
+
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "api/video/video_frame_buffer.h"
+
+namespace webrtc {
+
+// Full reference quality of a frame, computed over all planes.
+struct FrameQuality {
+  // In decibel, to a maximum of kPerfectPSNR. Computed from the summed squared
+  // error of all samples, like I420PSNR().
+  double psnr = 0.0;
+  // Weighted 0.8 for luma and 0.1 for each chroma plane, like I420SSIM().
+  double ssim = 0.0;
+};
+
+// Position of the center of a sampled block, as a fraction in [0, 1) of the
+// frame height and width respectively. Matches the coordinates produced by
+// HaltonFrameSampler.
+struct QualitySamplePosition {
+  double row = 0.0;
+  double column = 0.0;
+};
+
+// Size in luma pixels of the square blocks used by
+// ComputeSampledFrameQuality(). Chroma blocks are half the size.
+inline constexpr int kQualitySampleBlockSize = 16;
+
+// Computes PSNR and SSIM of `test` against `reference`, which must have the
+// same resolution. Unlike I420PSNR() and I420SSIM() this is meant to run
+// outside of tests, e.g. to monitor encoder output, and uses SSE2 or NEON
+// when available. SSIM is computed over 8x8 windows at a step of 4 pixels.
+FrameQuality ComputeFrameQuality(const I420BufferInterface& reference,
+                                 const I420BufferInterface& test);
+
+// Same as ComputeFrameQuality(), but only over the blocks of
+// kQualitySampleBlockSize luma pixels, and the co-located chroma pixels,
+// centered on `positions`. Blocks are moved inside the frame if needed. The
+// cost is proportional to the number of positions and independent of the
+// resolution. Returns a perfect score if `positions` is empty.
+FrameQuality ComputeSampledFrameQuality(
+    const I420BufferInterface& reference,
+    const I420BufferInterface& test,
+    ArrayView<const QualitySamplePosition> positions);
+
+// Sum of squared differences between two `width` x `height` planes.
+uint64_t SumSquaredError(const uint8_t* reference,
+                         int reference_stride,
+                         const uint8_t* test,
+                         int test_stride,
+                         int width,
+                         int height);
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_FRAME_QUALITY_METRICS_H_
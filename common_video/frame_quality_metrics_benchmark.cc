@@ -0,0 +1,96 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "benchmark/benchmark.h"
+#include "common_video/frame_quality_metrics.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumSamples = 64;
+
+scoped_refptr<I420Buffer> CreateFrame(int width, int height, uint8_t seed) {
+  scoped_refptr<I420Buffer> frame = I420Buffer::Create(width, height);
+  uint8_t value = seed;
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      frame->MutableDataY()[y * frame->StrideY() + x] = value;
+      value += 7;
+    }
+  }
+  for (int y = 0; y < frame->ChromaHeight(); ++y) {
+    for (int x = 0; x < frame->ChromaWidth(); ++x) {
+      frame->MutableDataU()[y * frame->StrideU() + x] = value;
+      frame->MutableDataV()[y * frame->StrideV() + x] = value;
+      value += 3;
+    }
+  }
+  return frame;
+}
+
+// Spread the samples evenly over the frame, like the low discrepancy
+// positions of a Halton sequence would be.
+std::vector<QualitySamplePosition> CreatePositions() {
+  std::vector<QualitySamplePosition> positions;
+  for (int i = 0; i < kNumSamples; ++i) {
+    positions.push_back(
+        {.row = (i / 8 + 0.5) / 8, .column = (i % 8 + 0.5) / 8});
+  }
+  return positions;
+}
+
+// The existing libyuv based metrics, which each read the full frames.
+void BM_I420PsnrAndSsim(benchmark::State& state) {
+  scoped_refptr<I420Buffer> reference =
+      CreateFrame(state.range(0), state.range(1), 0);
+  scoped_refptr<I420Buffer> test =
+      CreateFrame(state.range(0), state.range(1), 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(I420PSNR(*reference, *test));
+    benchmark::DoNotOptimize(I420SSIM(*reference, *test));
+  }
+}
+
+void BM_ComputeFrameQuality(benchmark::State& state) {
+  scoped_refptr<I420Buffer> reference =
+      CreateFrame(state.range(0), state.range(1), 0);
+  scoped_refptr<I420Buffer> test =
+      CreateFrame(state.range(0), state.range(1), 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ComputeFrameQuality(*reference, *test));
+  }
+}
+
+void BM_ComputeSampledFrameQuality(benchmark::State& state) {
+  scoped_refptr<I420Buffer> reference =
+      CreateFrame(state.range(0), state.range(1), 0);
+  scoped_refptr<I420Buffer> test =
+      CreateFrame(state.range(0), state.range(1), 1);
+  const std::vector<QualitySamplePosition> positions = CreatePositions();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        ComputeSampledFrameQuality(*reference, *test, positions));
+  }
+}
+
+BENCHMARK(BM_I420PsnrAndSsim)->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_ComputeFrameQuality)->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_ComputeSampledFrameQuality)
+    ->Args({1280, 720})
+    ->Args({1920, 1080});
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/frame_quality_metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+scoped_refptr<I420Buffer> CreateFilledBuffer(int width,
+                                             int height,
+                                             uint8_t value) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  memset(buffer->MutableDataY(), value, buffer->StrideY() * height);
+  memset(buffer->MutableDataU(), value,
+         buffer->StrideU() * buffer->ChromaHeight());
+  memset(buffer->MutableDataV(), value,
+         buffer->StrideV() * buffer->ChromaHeight());
+  return buffer;
+}
+
+void FillRandom(Random& random, uint8_t* data, int stride, int height) {
+  for (int i = 0; i < stride * height; ++i) {
+    data[i] = random.Rand<uint8_t>();
+  }
+}
+
+scoped_refptr<I420Buffer> CreateRandomBuffer(Random& random,
+                                             int width,
+                                             int height) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  FillRandom(random, buffer->MutableDataY(), buffer->StrideY(), height);
+  FillRandom(random, buffer->MutableDataU(), buffer->StrideU(),
+             buffer->ChromaHeight());
+  FillRandom(random, buffer->MutableDataV(), buffer->StrideV(),
+             buffer->ChromaHeight());
+  return buffer;
+}
+
+// Straightforward implementation of the 8x8, step 4, windowed SSIM.
+double ReferencePlaneSsim(const uint8_t* a,
+                          int stride_a,
+                          const uint8_t* b,
+                          int stride_b,
+                          int width,
+                          int height) {
+  double total = 0;
+  int windows = 0;
+  for (int y = 0; y + 8 <= height; y += 4) {
+    for (int x = 0; x + 8 <= width; x += 4) {
+      double mean_a = 0, mean_b = 0;
+      for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+          mean_a += a[(y + i) * stride_a + x + j];
+          mean_b += b[(y + i) * stride_b + x + j];
+        }
+      }
+      mean_a /= 64;
+      mean_b /= 64;
+      double var_a = 0, var_b = 0, covar = 0;
+      for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+          double da = a[(y + i) * stride_a + x + j] - mean_a;
+          double db = b[(y + i) * stride_b + x + j] - mean_b;
+          var_a += da * da;
+          var_b += db * db;
+          covar += da * db;
+        }
+      }
+      var_a /= 64;
+      var_b /= 64;
+      covar /= 64;
+      const double c1 = 6.5025;
+      const double c2 = 58.5225;
+      total += (2 * mean_a * mean_b + c1) * (2 * covar + c2) /
+               ((mean_a * mean_a + mean_b * mean_b + c1) *
+                (var_a + var_b + c2));
+      ++windows;
+    }
+  }
+  return total / windows;
+}
+
+TEST(FrameQualityMetricsTest, IdenticalFramesArePerfect) {
+  Random random(1);
+  scoped_refptr<I420Buffer> buffer = CreateRandomBuffer(random, 64, 48);
+  FrameQuality quality = ComputeFrameQuality(*buffer, *buffer);
+  EXPECT_EQ(quality.psnr, kPerfectPSNR);
+  EXPECT_DOUBLE_EQ(quality.ssim, 1.0);
+}
+
+TEST(FrameQualityMetricsTest, ComputesPsnrOverAllPlanes) {
+  scoped_refptr<I420Buffer> reference = CreateFilledBuffer(64, 48, 100);
+  scoped_refptr<I420Buffer> test = CreateFilledBuffer(64, 48, 110);
+  // The mean squared error is 100 in all planes.
+  EXPECT_NEAR(ComputeFrameQuality(*reference, *test).psnr,
+              10 * std::log10(255.0 * 255.0 / 100), 1e-9);
+}
+
+TEST(FrameQualityMetricsTest, SumSquaredErrorHandlesUnalignedWidths) {
+  Random random(2);
+  // Widths that exercise both the vectorized part and the remainder.
+  for (int width : {1, 15, 16, 17, 33, 100}) {
+    scoped_refptr<I420Buffer> a = CreateRandomBuffer(random, width, 3);
+    scoped_refptr<I420Buffer> b = CreateRandomBuffer(random, width, 3);
+    uint64_t expected = 0;
+    for (int y = 0; y < 3; ++y) {
+      for (int x = 0; x < width; ++x) {
+        int diff = a->DataY()[y * a->StrideY() + x] -
+                   b->DataY()[y * b->StrideY() + x];
+        expected += diff * diff;
+      }
+    }
+    EXPECT_EQ(SumSquaredError(a->DataY(), a->StrideY(), b->DataY(),
+                              b->StrideY(), width, 3),
+              expected)
+        << "width " << width;
+  }
+}
+
+TEST(FrameQualityMetricsTest, SsimMatchesReferenceImplementation) {
+  Random random(3);
+  scoped_refptr<I420Buffer> reference = CreateRandomBuffer(random, 68, 36);
+  // Add bounded noise, so that the frames are correlated.
+  scoped_refptr<I420Buffer> test = I420Buffer::Copy(*reference);
+  for (int i = 0; i < test->StrideY() * test->height(); ++i) {
+    int noise = static_cast<int>(random.Rand(40)) - 20;
+    int value = test->MutableDataY()[i] + noise;
+    test->MutableDataY()[i] = std::clamp(value, 0, 255);
+  }
+
+  const double ssim_y = ReferencePlaneSsim(
+      reference->DataY(), reference->StrideY(), test->DataY(), test->StrideY(),
+      reference->width(), reference->height());
+  // Chroma planes are identical.
+  EXPECT_NEAR(ComputeFrameQuality(*reference, *test).ssim,
+              0.8 * ssim_y + 0.2, 1e-9);
+  EXPECT_LT(ssim_y, 0.99);
+}
+
+TEST(FrameQualityMetricsTest, SampledQualityOnlyCoversSampledBlocks) {
+  scoped_refptr<I420Buffer> reference = CreateFilledBuffer(320, 240, 128);
+  scoped_refptr<I420Buffer> test = CreateFilledBuffer(320, 240, 128);
+  // Distort the top left 32x32 pixels.
+  for (int y = 0; y < 32; ++y) {
+    memset(test->MutableDataY() + y * test->StrideY(), 0, 32);
+  }
+
+  const QualitySamplePosition kBottomRight[] = {{.row = 0.9, .column = 0.9}};
+  FrameQuality quality =
+      ComputeSampledFrameQuality(*reference, *test, kBottomRight);
+  EXPECT_EQ(quality.psnr, kPerfectPSNR);
+  EXPECT_DOUBLE_EQ(quality.ssim, 1.0);
+
+  // Centered on (3, 3); moved inside the frame.
+  const QualitySamplePosition kTopLeft[] = {{.row = 0.01, .column = 0.01}};
+  quality = ComputeSampledFrameQuality(*reference, *test, kTopLeft);
+  // Luma is 0 instead of 128 in all of the 16x16 block and chroma is intact,
+  // so the mean squared error is 128^2 * 256 / 384.
+  EXPECT_NEAR(quality.psnr,
+              10 * std::log10(255.0 * 255.0 * 384 / (128 * 128 * 256)), 1e-9);
+  EXPECT_LT(quality.ssim, 0.5);
+}
+
+TEST(FrameQualityMetricsTest, SampledQualityHandlesFramesSmallerThanBlocks) {
+  scoped_refptr<I420Buffer> reference = CreateFilledBuffer(6, 4, 50);
+  scoped_refptr<I420Buffer> test = CreateFilledBuffer(6, 4, 50);
+  const QualitySamplePosition kCenter[] = {{.row = 0.5, .column = 0.5}};
+  FrameQuality quality = ComputeSampledFrameQuality(*reference, *test, kCenter);
+  EXPECT_EQ(quality.psnr, kPerfectPSNR);
+  EXPECT_DOUBLE_EQ(quality.ssim, 1.0);
+}
+
+TEST(FrameQualityMetricsTest, SsimHandlesTallFramesNarrowerThanWindow) {
+  // Large enough for the sums of squares over the whole luma plane to exceed
+  // 32 bits.
+  scoped_refptr<I420Buffer> reference = CreateFilledBuffer(7, 9500, 255);
+  scoped_refptr<I420Buffer> test = I420Buffer::Copy(*reference);
+  memset(test->MutableDataY(), 254, test->StrideY() * test->height());
+  // Both luma planes are flat, so only the means differ. Chroma planes are
+  // identical.
+  const double ssim_y =
+      (2 * 255.0 * 254.0 + 6.5025) / (255.0 * 255.0 + 254.0 * 254.0 + 6.5025);
+  EXPECT_NEAR(ComputeFrameQuality(*reference, *test).ssim,
+              0.8 * ssim_y + 0.2, 1e-9);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -32,7 +32,9 @@ namespace webrtc {
 // Create(I420|NV12)Buffer. When the buffer is destructed, the memory is
 // returned to the pool for use by subsequent calls to Create(I420|NV12)Buffer.
 // If the resolution passed to Create(I420|NV12)Buffer changes or requested
-// pixel format changes, old buffers will be purged from the pool.
+// pixel format changes, old buffers will be purged from the pool. The memory
+// of purged I420 and NV12 buffers is returned to SizeClassAllocator::Global(),
+// which can recycle it for the new resolution if caching is enabled there.
 // Note that Create(I420|NV12)Buffer will crash if more than
 // kMaxNumberOfFramesBeforeCrash are created. This is to prevent memory leaks
 // where frames are not returned.
@@ -20,7 +20,9 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_frame_buffer.h"
 #include "rtc_base/system/rtc_export.h"
@@ -86,6 +88,17 @@ scoped_refptr<I420BufferInterface> ScaleVideoFrameBuffer(
     int dst_width,
     int dst_height);
 
+// Scales `source` into every buffer of `destinations` in a single pass over
+// `source`, e.g. to produce all simulcast layers of an input frame.
+// `destinations` must be ordered by decreasing resolution, and each one is
+// scaled from the preceding one (the first from `source`) rather than from
+// `source` directly. Layers that are exactly half the size of the preceding
+// layer are produced in bands of rows interleaved with the larger layers, so
+// that intermediate rows are still in cache when they are read again. Other
+// layers are scaled as whole planes once the preceding layer is complete.
+void ScaleI420Pyramid(const I420BufferInterface& source,
+                      ArrayView<const scoped_refptr<I420Buffer>> destinations);
+
 double I420SSE(const I420BufferInterface& ref_buffer,
                const I420BufferInterface& test_buffer);
 
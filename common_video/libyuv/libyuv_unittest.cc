@@ -371,6 +371,27 @@ TEST_F(TestLibYuv, NV12Scale4x4to2x2) {
               ::testing::ElementsAre(Average(0, 2, 4, 6), Average(1, 3, 5, 7)));
 }
 
+TEST_F(TestLibYuv, ScaleI420PyramidMatchesCascadedScaling) {
+  scoped_refptr<I420BufferInterface> source =
+      orig_frame_->video_frame_buffer()->ToI420();
+  // Two exact 2:1 layers followed by a layer with an arbitrary ratio.
+  const std::vector<scoped_refptr<I420Buffer>> pyramid = {
+      I420Buffer::Create(width_ / 2, height_ / 2),
+      I420Buffer::Create(width_ / 4, height_ / 4),
+      I420Buffer::Create(60, 50)};
+  ScaleI420Pyramid(*source, pyramid);
+
+  const I420BufferInterface* previous = source.get();
+  for (const scoped_refptr<I420Buffer>& layer : pyramid) {
+    scoped_refptr<I420Buffer> expected =
+        I420Buffer::Create(layer->width(), layer->height());
+    expected->ScaleFrom(*previous);
+    EXPECT_EQ(I420SSE(*expected, *layer), 0.0)
+        << layer->width() << "x" << layer->height();
+    previous = layer.get();
+  }
+}
+
 TEST(I420WeightedPSNRTest, SmokeTest) {
   uint8_t ref_y[] = {0, 0, 0, 0};
   uint8_t ref_uv[] = {0};
@@ -10,8 +10,12 @@
 
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
 #include "api/video/i420_buffer.h"
 #include "common_video/include/video_frame_buffer.h"
 #include "rtc_base/checks.h"
@@ -19,6 +23,69 @@
 
 namespace webrtc {
 
+namespace {
+
+// Number of rows of the first scaled layer produced per band. Together with
+// the rows of the source and of the smaller layers that depend on them, a band
+// of a 1080p frame fits in a typical L2 cache.
+constexpr int kPyramidBandRows = 16;
+
+struct PlaneLevel {
+  // `mutable_data` is null for the source plane and equal to `data` for the
+  // scaled planes.
+  const uint8_t* data;
+  uint8_t* mutable_data;
+  int stride;
+  int width;
+  int height;
+  // Number of rows of the plane that are complete.
+  int rows_done;
+};
+
+// Scales one plane of every level of the pyramid. `levels[0]` describes the
+// source plane.
+void ScalePlanePyramid(std::vector<PlaneLevel>& levels) {
+  RTC_DCHECK_GE(levels.size(), 2);
+  levels[0].rows_done = levels[0].height;
+  while (levels.back().rows_done < levels.back().height) {
+    for (size_t i = 1; i < levels.size(); ++i) {
+      const PlaneLevel& src = levels[i - 1];
+      PlaneLevel& dst = levels[i];
+      if (dst.rows_done == dst.height) {
+        continue;
+      }
+      if (dst.width * 2 != src.width || dst.height * 2 != src.height) {
+        // Arbitrary ratios may read any source row, so wait for the whole
+        // source plane.
+        if (src.rows_done == src.height) {
+          libyuv::ScalePlane(src.data, src.stride, src.width, src.height,
+                             dst.mutable_data, dst.stride, dst.width,
+                             dst.height, libyuv::kFilterBox);
+          dst.rows_done = dst.height;
+        }
+        continue;
+      }
+      // Each row of a 2:1 downscale depends only on two source rows, so the
+      // plane can be produced incrementally as source rows become available.
+      int target_rows = std::min(dst.height, src.rows_done / 2);
+      if (i == 1) {
+        target_rows = std::min(target_rows, dst.rows_done + kPyramidBandRows);
+      }
+      int rows = target_rows - dst.rows_done;
+      if (rows <= 0) {
+        continue;
+      }
+      libyuv::ScalePlane(src.data + 2 * dst.rows_done * src.stride, src.stride,
+                         src.width, 2 * rows,
+                         dst.mutable_data + dst.rows_done * dst.stride,
+                         dst.stride, dst.width, rows, libyuv::kFilterBox);
+      dst.rows_done = target_rows;
+    }
+  }
+}
+
+}  // namespace
+
 size_t CalcBufferSize(VideoType type, int width, int height) {
   RTC_DCHECK_GE(width, 0);
   RTC_DCHECK_GE(height, 0);
@@ -161,6 +228,38 @@ scoped_refptr<I420BufferInterface> ScaleVideoFrameBuffer(
   return scaled_buffer;
 }
 
+void ScaleI420Pyramid(const I420BufferInterface& source,
+                      ArrayView<const scoped_refptr<I420Buffer>> destinations) {
+  if (destinations.empty()) {
+    return;
+  }
+  std::vector<PlaneLevel> y_levels = {{source.DataY(), nullptr,
+                                       source.StrideY(), source.width(),
+                                       source.height(), 0}};
+  std::vector<PlaneLevel> u_levels = {{source.DataU(), nullptr,
+                                       source.StrideU(), source.ChromaWidth(),
+                                       source.ChromaHeight(), 0}};
+  std::vector<PlaneLevel> v_levels = {{source.DataV(), nullptr,
+                                       source.StrideV(), source.ChromaWidth(),
+                                       source.ChromaHeight(), 0}};
+  for (const scoped_refptr<I420Buffer>& destination : destinations) {
+    RTC_DCHECK_LE(destination->width(), y_levels.back().width);
+    RTC_DCHECK_LE(destination->height(), y_levels.back().height);
+    y_levels.push_back({destination->DataY(), destination->MutableDataY(),
+                        destination->StrideY(), destination->width(),
+                        destination->height(), 0});
+    u_levels.push_back({destination->DataU(), destination->MutableDataU(),
+                        destination->StrideU(), destination->ChromaWidth(),
+                        destination->ChromaHeight(), 0});
+    v_levels.push_back({destination->DataV(), destination->MutableDataV(),
+                        destination->StrideV(), destination->ChromaWidth(),
+                        destination->ChromaHeight(), 0});
+  }
+  ScalePlanePyramid(y_levels);
+  ScalePlanePyramid(u_levels);
+  ScalePlanePyramid(v_levels);
+}
+
 double I420SSE(const I420BufferInterface& ref_buffer,
                const I420BufferInterface& test_buffer) {
   RTC_DCHECK_EQ(ref_buffer.width(), test_buffer.width());
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "benchmark/benchmark.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kWidth = 1920;
+constexpr int kHeight = 1080;
+constexpr int kNumLayers = 3;
+
+scoped_refptr<I420Buffer> CreateInput() {
+  scoped_refptr<I420Buffer> input = I420Buffer::Create(kWidth, kHeight);
+  uint8_t value = 0;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      input->MutableDataY()[y * input->StrideY() + x] = value++;
+    }
+  }
+  for (int y = 0; y < input->ChromaHeight(); ++y) {
+    for (int x = 0; x < input->ChromaWidth(); ++x) {
+      input->MutableDataU()[y * input->StrideU() + x] = value;
+      input->MutableDataV()[y * input->StrideV() + x] = value++;
+    }
+  }
+  return input;
+}
+
+// Scales the input once per lower simulcast layer, each time reading the full
+// resolution input.
+void BM_SimulcastScaleFromInput(benchmark::State& state) {
+  scoped_refptr<I420Buffer> input = CreateInput();
+  for (auto _ : state) {
+    for (int layer = 1; layer < kNumLayers; ++layer) {
+      scoped_refptr<I420Buffer> scaled =
+          I420Buffer::Create(kWidth >> layer, kHeight >> layer);
+      scaled->ScaleFrom(*input);
+      benchmark::DoNotOptimize(scaled->DataY());
+    }
+  }
+}
+
+void BM_SimulcastScalePyramid(benchmark::State& state) {
+  scoped_refptr<I420Buffer> input = CreateInput();
+  for (auto _ : state) {
+    std::vector<scoped_refptr<I420Buffer>> pyramid;
+    for (int layer = 1; layer < kNumLayers; ++layer) {
+      pyramid.push_back(I420Buffer::Create(kWidth >> layer, kHeight >> layer));
+    }
+    ScaleI420Pyramid(*input, pyramid);
+    benchmark::DoNotOptimize(pyramid.back()->DataY());
+  }
+}
+
+BENCHMARK(BM_SimulcastScaleFromInput);
+BENCHMARK(BM_SimulcastScalePyramid);
+
+}  // namespace
+}  // namespace webrtc
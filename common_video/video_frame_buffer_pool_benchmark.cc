@@ -0,0 +1,97 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "benchmark/benchmark.h"
+#include "common_video/include/video_frame_buffer_pool.h"
+#include "rtc_base/memory/size_class_allocator.h"
+
+namespace webrtc {
+namespace {
+
+struct Resolution {
+  int width;
+  int height;
+};
+
+// Resolutions visited by a 720p stream that is adapted up and down, as seen by
+// a decoder whose pool is purged on every resolution change.
+constexpr Resolution kChurn[] = {{1280, 720}, {960, 540}, {640, 360},
+                                 {480, 270},  {640, 360}, {960, 540}};
+constexpr int kFramesPerResolution = 4;
+
+void SetCaching(const benchmark::State& state) {
+  SizeClassAllocator::Global().SetMaxCachedBytes(
+      state.range(0) ? SizeClassAllocator::kDefaultGlobalMaxCachedBytes : 0);
+}
+
+void ReportCounters(benchmark::State& state,
+                    const SizeClassAllocator::Stats& before) {
+  SizeClassAllocator::Stats after = SizeClassAllocator::Global().GetStats();
+  double allocations = after.num_allocations - before.num_allocations;
+  state.counters["system_allocs_per_frame"] =
+      (after.num_system_allocations - before.num_system_allocations) /
+      allocations;
+  state.counters["reuse_ratio"] =
+      (after.num_reused - before.num_reused) / allocations;
+  SizeClassAllocator::Global().SetMaxCachedBytes(
+      SizeClassAllocator::kDefaultGlobalMaxCachedBytes);
+}
+
+void BM_VideoFrameBufferPoolResolutionChurn(benchmark::State& state) {
+  SetCaching(state);
+  SizeClassAllocator::Stats before = SizeClassAllocator::Global().GetStats();
+  VideoFrameBufferPool pool;
+  // Frames kept alive by the jitter buffer / renderer.
+  std::vector<scoped_refptr<I420Buffer>> in_flight(2);
+  size_t frame = 0;
+  for (auto _ : state) {
+    const Resolution& resolution =
+        kChurn[(frame / kFramesPerResolution) % std::size(kChurn)];
+    scoped_refptr<I420Buffer> buffer =
+        pool.CreateI420Buffer(resolution.width, resolution.height);
+    benchmark::DoNotOptimize(buffer->MutableDataY());
+    in_flight[frame % in_flight.size()] = std::move(buffer);
+    ++frame;
+  }
+  in_flight.clear();
+  pool.Release();
+  ReportCounters(state, before);
+}
+
+void BM_I420BufferCreateSimulcast(benchmark::State& state) {
+  SetCaching(state);
+  SizeClassAllocator::Stats before = SizeClassAllocator::Global().GetStats();
+  // One scaled buffer per simulcast layer per frame, as done when scaling the
+  // input for each layer.
+  for (auto _ : state) {
+    for (int layer = 0; layer < 3; ++layer) {
+      scoped_refptr<I420Buffer> buffer =
+          I420Buffer::Create(1920 >> layer, 1080 >> layer);
+      benchmark::DoNotOptimize(buffer->MutableDataY());
+    }
+  }
+  ReportCounters(state, before);
+}
+
+BENCHMARK(BM_VideoFrameBufferPoolResolutionChurn)
+    ->ArgName("pooled")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK(BM_I420BufferCreateSimulcast)->ArgName("pooled")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
@@ -74,6 +74,9 @@ ACTIVE_FIELD_TRIALS: FrozenSet[FieldTrial] = frozenset([
     FieldTrial('WebRTC-DataChannelMessageInterleaving',
                41481008,
                date(2024, 10, 1)),
+    FieldTrial('WebRTC-DataChannelZeroChecksum',
+               41481008,
+               date(2027, 10, 1)),
     FieldTrial('WebRTC-Dav1dDecoder-CropToRenderResolution',
                405341160,
                date(2026, 3, 21)),
@@ -92,6 +95,9 @@ ACTIVE_FIELD_TRIALS: FrozenSet[FieldTrial] = frozenset([
     FieldTrial('WebRTC-EnableDtlsPqc',
                404763475,
                date(2026,6,1)),
+    FieldTrial('WebRTC-FrameCadenceAdapter-ContentAware',
+               42226256,
+               date(2027, 10, 1)),
     FieldTrial('WebRTC-FrameCadenceAdapter-UseVideoFrameTimestamp',
                42226256,
                date(2024, 10, 1)),
@@ -182,6 +188,9 @@ ACTIVE_FIELD_TRIALS: FrozenSet[FieldTrial] = frozenset([
     FieldTrial('WebRTC-VP9-SvcForSimulcast',
                347737882,
                date(2024, 10, 1)),
+    FieldTrial('WebRTC-Video-AsyncEncode',
+               42225879,
+               date(2027, 10, 1)),
     FieldTrial('WebRTC-Video-EnableRetransmitAllLayers',
                42225262,
                date(2024, 4, 1)),
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "logging/rtc_event_log/rtc_event_buffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+#include "api/rtc_event_log/rtc_event.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+uint64_t RoundUpToPowerOfTwo(size_t value) {
+  uint64_t power_of_two = 1;
+  while (power_of_two < value) {
+    power_of_two <<= 1;
+  }
+  return power_of_two;
+}
+
+}  // namespace
+
+RtcEventBuffer::RtcEventBuffer(size_t capacity)
+    : mask_(RoundUpToPowerOfTwo(capacity) - 1),
+      slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+  RTC_DCHECK_GT(capacity, 0);
+  for (uint64_t i = 0; i <= mask_; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+RtcEventBuffer::~RtcEventBuffer() {
+  while (Pop()) {
+  }
+}
+
+uint64_t RtcEventBuffer::Push(std::unique_ptr<RtcEvent>& event) {
+  RTC_DCHECK(event);
+  uint64_t index = pushed_.load(std::memory_order_relaxed);
+  Slot* slot;
+  while (true) {
+    slot = &slots_[index & mask_];
+    uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+    if (sequence == index) {
+      // The slot is empty. Claim it, unless another thread did first.
+      if (pushed_.compare_exchange_weak(index, index + 1,
+                                        std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (sequence < index) {
+      // The slot still holds the event pushed one lap before, that hasn't been
+      // popped yet.
+      return 0;
+    } else {
+      // Another thread has pushed to the slot since `index` was loaded.
+      index = pushed_.load(std::memory_order_relaxed);
+    }
+  }
+  slot->event = event.release();
+  slot->sequence.store(index + 1, std::memory_order_release);
+  return index + 1;
+}
+
+void RtcEventBuffer::PopUntil(uint64_t end,
+                              std::deque<std::unique_ptr<RtcEvent>>& events) {
+  uint64_t index = popped_.load(std::memory_order_relaxed);
+  while (index < end) {
+    Slot& slot = slots_[index & mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+      break;
+    }
+    events.emplace_back(slot.event);
+    slot.event = nullptr;
+    // Make the slot available to the event pushed one lap after.
+    slot.sequence.store(index + mask_ + 1, std::memory_order_release);
+    ++index;
+  }
+  popped_.store(index, std::memory_order_release);
+}
+
+std::unique_ptr<RtcEvent> RtcEventBuffer::Pop() {
+  uint64_t index = popped_.load(std::memory_order_relaxed);
+  Slot& slot = slots_[index & mask_];
+  if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+    return nullptr;
+  }
+  std::unique_ptr<RtcEvent> event(slot.event);
+  slot.event = nullptr;
+  slot.sequence.store(index + mask_ + 1, std::memory_order_release);
+  popped_.store(index + 1, std::memory_order_release);
+  return event;
+}
+
+size_t RtcEventBuffer::size() const {
+  // Loaded first, so that it can't be more than the number of events pushed.
+  uint64_t popped = popped_.load(std::memory_order_acquire);
+  return pushed() - popped;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef LOGGING_RTC_EVENT_LOG_RTC_EVENT_BUFFER_H_
+#define LOGGING_RTC_EVENT_LOG_RTC_EVENT_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+#include "api/rtc_event_log/rtc_event.h"
+
+namespace webrtc {
+
+// A bounded queue of events, that any number of threads can push events to
+// without locking, and that one thread at a time pops them from. It is a ring
+// of slots, each with a sequence number that tells whether it has been
+// written or read for a given position in the queue.
+//
+// Events are identified by their position, i.e. the number of events pushed
+// before and including them since the buffer was created.
+class RtcEventBuffer {
+ public:
+  // `capacity` is rounded up to a power of two.
+  explicit RtcEventBuffer(size_t capacity);
+  RtcEventBuffer(const RtcEventBuffer&) = delete;
+  RtcEventBuffer& operator=(const RtcEventBuffer&) = delete;
+  ~RtcEventBuffer();
+
+  size_t capacity() const { return mask_ + 1; }
+
+  // Takes `event` and returns its position, unless the buffer is full, in
+  // which case `event` is left as is and 0 is returned.
+  uint64_t Push(std::unique_ptr<RtcEvent>& event);
+
+  // Pops the events up to and including the one at position `end`, in order,
+  // and appends them to `events`. Stops at the first event that is still
+  // being pushed, if any. Must not be called concurrently with other calls to
+  // `Pop` or `PopUntil`.
+  void PopUntil(uint64_t end, std::deque<std::unique_ptr<RtcEvent>>& events);
+  // Pops the oldest event, or returns null if the buffer is empty or the
+  // oldest event is still being pushed.
+  std::unique_ptr<RtcEvent> Pop();
+
+  // The position of the most recently pushed event.
+  uint64_t pushed() const { return pushed_.load(std::memory_order_relaxed); }
+  // The number of events in the buffer, which may already have changed when
+  // called concurrently with `Push` or `Pop`.
+  size_t size() const;
+
+ private:
+  struct Slot {
+    // The position of the next event to be pushed to the slot, minus one,
+    // while the slot is empty, and the position of its event once pushed.
+    std::atomic<uint64_t> sequence;
+    RtcEvent* event = nullptr;
+  };
+
+  const uint64_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> pushed_{0};
+  std::atomic<uint64_t> popped_{0};
+};
+
+}  // namespace webrtc
+
+#endif  // LOGGING_RTC_EVENT_LOG_RTC_EVENT_BUFFER_H_
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "logging/rtc_event_log/rtc_event_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "api/rtc_event_log/rtc_event.h"
+#include "rtc_base/platform_thread.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+class FakeEvent : public RtcEvent {
+ public:
+  explicit FakeEvent(int id) : id_(id) {}
+  Type GetType() const override { return RtcEvent::Type::FakeEvent; }
+  bool IsConfigEvent() const override { return false; }
+  int id() const { return id_; }
+
+ private:
+  const int id_;
+};
+
+int IdOf(const std::unique_ptr<RtcEvent>& event) {
+  return static_cast<const FakeEvent&>(*event).id();
+}
+
+TEST(RtcEventBufferTest, RoundsUpCapacityToPowerOfTwo) {
+  EXPECT_EQ(RtcEventBuffer(1).capacity(), 1u);
+  EXPECT_EQ(RtcEventBuffer(5).capacity(), 8u);
+  EXPECT_EQ(RtcEventBuffer(16).capacity(), 16u);
+}
+
+TEST(RtcEventBufferTest, PopsEventsInOrder) {
+  RtcEventBuffer buffer(4);
+  for (int i = 1; i <= 3; ++i) {
+    std::unique_ptr<RtcEvent> event = std::make_unique<FakeEvent>(i);
+    EXPECT_EQ(buffer.Push(event), static_cast<uint64_t>(i));
+    EXPECT_FALSE(event);
+  }
+  EXPECT_EQ(buffer.size(), 3u);
+  EXPECT_EQ(IdOf(buffer.Pop()), 1);
+
+  std::deque<std::unique_ptr<RtcEvent>> events;
+  buffer.PopUntil(/*end=*/2, events);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(IdOf(events[0]), 2);
+  buffer.PopUntil(/*end=*/10, events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(IdOf(events[1]), 3);
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_FALSE(buffer.Pop());
+}
+
+TEST(RtcEventBufferTest, DoesNotPushToFullBuffer) {
+  RtcEventBuffer buffer(2);
+  std::unique_ptr<RtcEvent> event = std::make_unique<FakeEvent>(1);
+  EXPECT_EQ(buffer.Push(event), 1u);
+  event = std::make_unique<FakeEvent>(2);
+  EXPECT_EQ(buffer.Push(event), 2u);
+  event = std::make_unique<FakeEvent>(3);
+  EXPECT_EQ(buffer.Push(event), 0u);
+  ASSERT_TRUE(event);
+
+  // Popping makes room for one more event.
+  EXPECT_EQ(IdOf(buffer.Pop()), 1);
+  EXPECT_EQ(buffer.Push(event), 3u);
+  EXPECT_EQ(IdOf(buffer.Pop()), 2);
+  EXPECT_EQ(IdOf(buffer.Pop()), 3);
+}
+
+TEST(RtcEventBufferTest, KeepsEventsPushedConcurrently) {
+  constexpr int kNumThreads = 4;
+  constexpr int kEventsPerThread = 10000;
+  RtcEventBuffer buffer(kNumThreads * kEventsPerThread);
+  std::vector<PlatformThread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(PlatformThread::SpawnJoinable(
+        [&buffer, i] {
+          for (int j = 0; j < kEventsPerThread; ++j) {
+            std::unique_ptr<RtcEvent> event =
+                std::make_unique<FakeEvent>(i * kEventsPerThread + j);
+            buffer.Push(event);
+          }
+        },
+        "RtcEventBufferTest"));
+  }
+  threads.clear();
+
+  std::deque<std::unique_ptr<RtcEvent>> events;
+  buffer.PopUntil(buffer.pushed(), events);
+  ASSERT_EQ(events.size(), static_cast<size_t>(kNumThreads * kEventsPerThread));
+  // The events of each thread are in the order that they were pushed.
+  std::vector<int> last_ids(kNumThreads, -1);
+  for (const std::unique_ptr<RtcEvent>& event : events) {
+    int thread = IdOf(event) / kEventsPerThread;
+    EXPECT_GT(IdOf(event), last_ids[thread]);
+    last_ids[thread] = IdOf(event);
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -58,22 +58,22 @@ RtcEventLogImpl::RtcEventLogImpl(const Environment& env)
 RtcEventLogImpl::RtcEventLogImpl(std::unique_ptr<RtcEventLogEncoder> encoder,
                                  TaskQueueFactory* task_queue_factory,
                                  size_t max_events_in_history,
-                                 size_t max_config_events_in_history)
+                                 size_t max_config_events_in_history,
+                                 size_t max_events_in_buffer)
     : max_events_in_history_(max_events_in_history),
       max_config_events_in_history_(max_config_events_in_history),
+      buffer_(max_events_in_buffer),
       event_encoder_(std::move(encoder)),
       last_output_ms_(TimeMillis()),
       task_queue_(task_queue_factory->CreateTaskQueue(
           "rtc_event_log",
-          TaskQueueFactory::Priority::NORMAL)) {}
+          TaskQueueFactory::Priority::NORMAL)) {
+  RTC_DCHECK_GE(max_events_in_buffer, max_events_in_history);
+}
 
 RtcEventLogImpl::~RtcEventLogImpl() {
   // If we're logging to the output, this will stop that. Blocking function.
-  mutex_.Lock();
-  bool started = logging_state_started_;
-  mutex_.Unlock();
-
-  if (started) {
+  if (logging_state_started_) {
     logging_state_checker_.Detach();
     StopLogging();
   }
@@ -112,7 +112,8 @@ bool RtcEventLogImpl::StartLogging(std::unique_ptr<RtcEventLogOutput> output,
   // Binding to `this` is safe because `this` outlives the `task_queue_`.
   task_queue_->PostTask([this, output_period_ms, timestamp_us, utc_time_us,
                          output = std::move(output),
-                         histories = ExtractRecentHistories()]() mutable {
+                         histories = ExtractRecentHistories(
+                             buffer_.pushed())]() mutable {
     RTC_DCHECK_RUN_ON(task_queue_.get());
     RTC_DCHECK(output);
     RTC_DCHECK(output->IsActive());
@@ -159,7 +160,8 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
   MutexLock lock(&mutex_);
   logging_state_started_ = false;
   task_queue_->PostTask(
-      [this, callback, histories = ExtractRecentHistories()]() mutable {
+      [this, callback,
+       histories = ExtractRecentHistories(buffer_.pushed())]() mutable {
         RTC_DCHECK_RUN_ON(task_queue_.get());
         if (event_output_) {
           RTC_DCHECK(event_output_->IsActive());
@@ -170,50 +172,93 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
       });
 }
 
-RtcEventLogImpl::EventHistories RtcEventLogImpl::ExtractRecentHistories() {
+RtcEventLogImpl::EventHistories RtcEventLogImpl::ExtractRecentHistories(
+    uint64_t end) {
   EventHistories histories;
-  std::swap(histories, recent_);
+  std::swap(histories.config_history, recent_config_history_);
+  buffer_.PopUntil(end, histories.history);
+
+  // The extracted events no longer count towards requesting output.
+  uint64_t requested = output_requested_position_.load();
+  while (requested < end &&
+         !output_requested_position_.compare_exchange_weak(requested, end)) {
+  }
+
+  if (uint64_t dropped_events = dropped_events_.exchange(0)) {
+    RTC_LOG(LS_WARNING) << "Dropped " << dropped_events
+                        << " events: the buffer of " << buffer_.capacity()
+                        << " events was full.";
+  }
   return histories;
 }
 
 void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
   RTC_CHECK(event);
-  MutexLock lock(&mutex_);
+  uint64_t position;
+  if (event->IsConfigEvent()) {
+    MutexLock lock(&mutex_);
+    LogConfigToMemory(std::move(event));
+    position = buffer_.pushed();
+  } else {
+    position = LogToBuffer(std::move(event));
+    if (position == 0) {
+      return;
+    }
+  }
 
-  LogToMemory(std::move(event));
-  if (logging_state_started_) {
-    if (ShouldOutputImmediately()) {
-      // Binding to `this` is safe because `this` outlives the `task_queue_`.
-      task_queue_->PostTask(
-          [this, histories = ExtractRecentHistories()]() mutable {
-            RTC_DCHECK_RUN_ON(task_queue_.get());
-            if (event_output_) {
-              RTC_DCHECK(event_output_->IsActive());
-              LogEventsToOutput(std::move(histories));
-            }
-          });
-    } else if (need_schedule_output_) {
-      need_schedule_output_ = false;
-      // Binding to `this` is safe because `this` outlives the `task_queue_`.
-      task_queue_->PostTask([this]() mutable {
-        RTC_DCHECK_RUN_ON(task_queue_.get());
-        if (event_output_) {
-          RTC_DCHECK(event_output_->IsActive());
-          ScheduleOutput();
-        }
-      });
+  if (!logging_state_started_) {
+    return;
+  }
+  // Output is only posted with `mutex_` held and logging started, like
+  // `StopLogging()` changes the state, so that no output is posted after it.
+  // Such output would take the events logged after `StopLogging()` from the
+  // history that is kept for the next log.
+  if (ShouldOutputImmediately(position)) {
+    MutexLock lock(&mutex_);
+    if (!logging_state_started_) {
+      return;
+    }
+    // Binding to `this` is safe because `this` outlives the `task_queue_`.
+    task_queue_->PostTask([this, position]() {
+      RTC_DCHECK_RUN_ON(task_queue_.get());
+      mutex_.Lock();
+      EventHistories histories = ExtractRecentHistories(position);
+      mutex_.Unlock();
+      if (event_output_) {
+        RTC_DCHECK(event_output_->IsActive());
+        LogEventsToOutput(std::move(histories));
+      }
+    });
+  } else if (need_schedule_output_) {
+    MutexLock lock(&mutex_);
+    if (!logging_state_started_ || !need_schedule_output_.exchange(false)) {
+      return;
     }
+    // Binding to `this` is safe because `this` outlives the `task_queue_`.
+    task_queue_->PostTask([this]() mutable {
+      RTC_DCHECK_RUN_ON(task_queue_.get());
+      if (event_output_) {
+        RTC_DCHECK(event_output_->IsActive());
+        ScheduleOutput();
+      }
+    });
   }
 }
 
-bool RtcEventLogImpl::ShouldOutputImmediately() {
-  if (recent_.history.size() >= max_events_in_history_) {
-    // We have to emergency drain the buffer. We can't wait for the scheduled
-    // output task because there might be other event incoming before that.
+bool RtcEventLogImpl::ShouldOutputImmediately(uint64_t position) {
+  if (immediately_output_mode_) {
     return true;
   }
 
-  return immediately_output_mode_;
+  // We have to emergency drain the buffer once it holds
+  // `max_events_in_history_` events that haven't been requested to be output
+  // yet. We can't wait for the scheduled output task because there might be
+  // other event incoming before that. Only one of the threads that log events
+  // concurrently requests the output.
+  uint64_t requested = output_requested_position_.load();
+  return position >= requested + max_events_in_history_ &&
+         output_requested_position_.compare_exchange_strong(requested,
+                                                            position);
 }
 
 void RtcEventLogImpl::ScheduleOutput() {
@@ -228,7 +273,7 @@ void RtcEventLogImpl::ScheduleOutput() {
       RTC_DCHECK(!need_schedule_output_);
       // Let the next `Log()` to schedule output.
       need_schedule_output_ = true;
-      EventHistories histories = ExtractRecentHistories();
+      EventHistories histories = ExtractRecentHistories(buffer_.pushed());
       mutex_.Unlock();
       LogEventsToOutput(std::move(histories));
     }
@@ -241,18 +286,38 @@ void RtcEventLogImpl::ScheduleOutput() {
                                TimeDelta::Millis(delay));
 }
 
-void RtcEventLogImpl::LogToMemory(std::unique_ptr<RtcEvent> event) {
-  EventDeque& container =
-      event->IsConfigEvent() ? recent_.config_history : recent_.history;
-  const size_t container_max_size = event->IsConfigEvent()
-                                        ? max_config_events_in_history_
-                                        : max_events_in_history_;
-
+void RtcEventLogImpl::LogConfigToMemory(std::unique_ptr<RtcEvent> event) {
   // Shouldn't lose events if started.
-  if (container.size() >= container_max_size && !logging_state_started_) {
-    container.pop_front();
+  if (recent_config_history_.size() >= max_config_events_in_history_ &&
+      !logging_state_started_) {
+    recent_config_history_.pop_front();
+  }
+  recent_config_history_.push_back(std::move(event));
+}
+
+uint64_t RtcEventLogImpl::LogToBuffer(std::unique_ptr<RtcEvent> event) {
+  uint64_t position = buffer_.Push(event);
+  if (!logging_state_started_ &&
+      (position == 0 || buffer_.size() > max_events_in_history_)) {
+    // Only the most recent events are kept until logging is started, so drop
+    // the oldest ones, also to make room for `event` if the buffer was full.
+    MutexLock lock(&mutex_);
+    if (!logging_state_started_) {
+      const size_t max_size = max_events_in_history_ - (position == 0 ? 1 : 0);
+      while (buffer_.size() > max_size && buffer_.Pop()) {
+      }
+      if (position == 0) {
+        position = buffer_.Push(event);
+      }
+    }
+  }
+  if (position == 0) {
+    // The buffer was full, as the output can't keep up with the logged events,
+    // or, before logging is started, as the room that was made for `event` was
+    // taken by other threads.
+    ++dropped_events_;
   }
-  container.push_back(std::move(event));
+  return position;
 }
 
 void RtcEventLogImpl::LogEventsToOutput(EventHistories histories) {
@@ -11,6 +11,7 @@
 #ifndef LOGGING_RTC_EVENT_LOG_RTC_EVENT_LOG_IMPL_H_
 #define LOGGING_RTC_EVENT_LOG_RTC_EVENT_LOG_IMPL_H_
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -26,6 +27,7 @@
 #include "api/task_queue/task_queue_base.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "logging/rtc_event_log/encoder/rtc_event_log_encoder.h"
+#include "logging/rtc_event_log/rtc_event_buffer.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/system/no_unique_address.h"
 #include "rtc_base/thread_annotations.h"
@@ -40,13 +42,18 @@ class RtcEventLogImpl final : public RtcEventLog {
   // The config-history is supposed to be unbounded, but needs to have some
   // bound to prevent an attack via unreasonable memory use.
   static constexpr size_t kMaxEventsInConfigHistory = 1000;
+  // The max number of events that are buffered until they are output, once
+  // logging has started. Events that are logged while the buffer is full,
+  // because the output can't keep up, are dropped.
+  static constexpr size_t kMaxEventsInBuffer = 16384;
 
   explicit RtcEventLogImpl(const Environment& env);
   RtcEventLogImpl(
       std::unique_ptr<RtcEventLogEncoder> encoder,
       TaskQueueFactory* task_queue_factory,
       size_t max_events_in_history = kMaxEventsInHistory,
-      size_t max_config_events_in_history = kMaxEventsInConfigHistory);
+      size_t max_config_events_in_history = kMaxEventsInConfigHistory,
+      size_t max_events_in_buffer = kMaxEventsInBuffer);
   RtcEventLogImpl(const RtcEventLogImpl&) = delete;
   RtcEventLogImpl& operator=(const RtcEventLogImpl&) = delete;
 
@@ -59,8 +66,9 @@ class RtcEventLogImpl final : public RtcEventLog {
   void StopLogging() override;
   void StopLogging(std::function<void()> callback) override;
 
-  // Records event into `recent_` on current thread, and schedules the output on
-  // task queue if the buffers are full or `output_period_ms_` is expired.
+  // Records event into `recent_config_history_`, or without locking into
+  // `buffer_`, on current thread, and schedules the output on task queue if
+  // the buffers are full or `output_period_ms_` is expired.
   void Log(std::unique_ptr<RtcEvent> event) override;
 
  private:
@@ -71,10 +79,14 @@ class RtcEventLogImpl final : public RtcEventLog {
     EventDeque history;
   };
 
-  // Helper to extract and clear `recent_`.
-  EventHistories ExtractRecentHistories() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
-  void LogToMemory(std::unique_ptr<RtcEvent> event)
+  // Helper to extract and clear `recent_config_history_`, and the events in
+  // `buffer_` up to position `end`.
+  EventHistories ExtractRecentHistories(uint64_t end)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void LogConfigToMemory(std::unique_ptr<RtcEvent> event)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Returns the position of `event` in `buffer_`, or 0 if it was dropped.
+  uint64_t LogToBuffer(std::unique_ptr<RtcEvent> event);
   void LogEventsToOutput(EventHistories histories) RTC_RUN_ON(task_queue_);
 
   void StopOutput() RTC_RUN_ON(task_queue_);
@@ -86,7 +98,7 @@ class RtcEventLogImpl final : public RtcEventLog {
 
   void StopLoggingInternal() RTC_RUN_ON(task_queue_);
 
-  bool ShouldOutputImmediately() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  bool ShouldOutputImmediately(uint64_t position);
   void ScheduleOutput() RTC_RUN_ON(task_queue_);
 
   // Max size of event history.
@@ -98,9 +110,17 @@ class RtcEventLogImpl final : public RtcEventLog {
   // History containing all past configuration events.
   EventDeque all_config_history_ RTC_GUARDED_BY(task_queue_);
 
-  // `config_history` containing the most recent configuration events.
-  // `history` containing the most recent (non-configuration) events (~10s).
-  EventHistories recent_ RTC_GUARDED_BY(mutex_);
+  // The most recent configuration events.
+  EventDeque recent_config_history_ RTC_GUARDED_BY(mutex_);
+
+  // The most recent (non-configuration) events (~10s). Events are pushed
+  // without locking, and popped with `mutex_` held.
+  RtcEventBuffer buffer_;
+  // The position in `buffer_` of the last event that has been, or is about to
+  // be, output. Output is requested when `max_events_in_history_` more events
+  // have been logged.
+  std::atomic<uint64_t> output_requested_position_{0};
+  std::atomic<uint64_t> dropped_events_{0};
 
   std::unique_ptr<RtcEventLogEncoder> event_encoder_
       RTC_GUARDED_BY(task_queue_);
@@ -110,9 +130,11 @@ class RtcEventLogImpl final : public RtcEventLog {
   int64_t last_output_ms_ RTC_GUARDED_BY(task_queue_);
 
   RTC_NO_UNIQUE_ADDRESS SequenceChecker logging_state_checker_;
-  bool logging_state_started_ RTC_GUARDED_BY(mutex_) = false;
-  bool immediately_output_mode_ RTC_GUARDED_BY(mutex_) = false;
-  bool need_schedule_output_ RTC_GUARDED_BY(mutex_) = false;
+  // Written with `mutex_` held. Read without locking by `Log()`, which reads
+  // it again with `mutex_` held before it posts output.
+  std::atomic<bool> logging_state_started_{false};
+  std::atomic<bool> immediately_output_mode_{false};
+  std::atomic<bool> need_schedule_output_{false};
 
   std::unique_ptr<TaskQueueBase, TaskQueueDeleter> task_queue_;
 
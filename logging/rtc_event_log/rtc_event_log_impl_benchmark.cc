@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "api/rtc_event_log/rtc_event.h"
+#include "api/rtc_event_log_output.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "benchmark/benchmark.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder.h"
+#include "logging/rtc_event_log/rtc_event_log_impl.h"
+
+namespace webrtc {
+namespace {
+
+class NullEncoder : public RtcEventLogEncoder {
+ public:
+  std::string EncodeLogStart(int64_t /* timestamp_us */,
+                             int64_t /* utc_time_us */) override {
+    return "";
+  }
+  std::string EncodeLogEnd(int64_t /* timestamp_us */) override { return ""; }
+  std::string EncodeBatch(
+      std::deque<std::unique_ptr<RtcEvent>>::const_iterator /* begin */,
+      std::deque<std::unique_ptr<RtcEvent>>::const_iterator /* end */)
+      override {
+    return "";
+  }
+};
+
+class NullOutput : public RtcEventLogOutput {
+ public:
+  bool IsActive() const override { return true; }
+  bool Write(absl::string_view /* output */) override { return true; }
+};
+
+class FakeEvent : public RtcEvent {
+ public:
+  Type GetType() const override { return RtcEvent::Type::FakeEvent; }
+  bool IsConfigEvent() const override { return false; }
+};
+
+std::unique_ptr<TaskQueueFactory> task_queue_factory;
+std::unique_ptr<RtcEventLogImpl> event_log;
+
+// Measures the cost of `Log()` for the threads that log events, e.g. the
+// network and worker threads, while the events are output in the background.
+void BM_RtcEventLogLog(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    task_queue_factory = CreateDefaultTaskQueueFactory();
+    event_log = std::make_unique<RtcEventLogImpl>(
+        std::make_unique<NullEncoder>(), task_queue_factory.get());
+    event_log->StartLogging(std::make_unique<NullOutput>(),
+                            /*output_period_ms=*/100);
+  }
+  for (auto _ : state) {
+    event_log->Log(std::make_unique<FakeEvent>());
+  }
+  if (state.thread_index() == 0) {
+    event_log->StopLogging();
+    event_log = nullptr;
+    task_queue_factory = nullptr;
+  }
+}
+
+BENCHMARK(BM_RtcEventLogLog)->Threads(1)->Threads(4);
+
+}  // namespace
+}  // namespace webrtc
@@ -155,6 +155,33 @@ TEST_F(RtcEventLogImplTest, KeepsMostRecentEventsOnStart) {
   Mock::VerifyAndClearExpectations(encoder_ptr_);
 }
 
+TEST_F(RtcEventLogImplTest, KeepsEventsLoggedAfterStopForNextLog) {
+  auto e1 = std::make_unique<FakeEvent>();
+  RtcEvent* e1_ptr = e1.get();
+  auto c2 = std::make_unique<FakeConfigEvent>();
+  RtcEvent* c2_ptr = c2.get();
+  auto e3 = std::make_unique<FakeEvent>();
+  RtcEvent* e3_ptr = e3.get();
+  InSequence s;
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e1_ptr)));
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*c2_ptr)));
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e3_ptr)));
+
+  event_log_.StartLogging(std::move(output_), RtcEventLog::kImmediateOutput);
+  event_log_.Log(std::move(e1));
+  event_log_.StopLogging();
+  event_log_.Log(std::move(c2));
+  event_log_.Log(std::move(e3));
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+
+  std::string written_data;
+  event_log_.StartLogging(std::make_unique<FakeOutput>(written_data),
+                          RtcEventLog::kImmediateOutput);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  event_log_.StopLogging();
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+}
+
 TEST_F(RtcEventLogImplTest, KeepsConfigEventsOnStart) {
   // The config-history is supposed to be unbounded and never overflow.
   auto c1 = std::make_unique<FakeConfigEvent>();
@@ -303,5 +330,29 @@ TEST_F(RtcEventLogImplTest, StopOutputOnWriteFailure) {
   Mock::VerifyAndClearExpectations(encoder_ptr_);
 }
 
+TEST_F(RtcEventLogImplTest, DropsEventsIfBufferFullAfterStarted) {
+  constexpr size_t kMaxEventsInBuffer = 4;
+  auto encoder = std::make_unique<MockEventEncoder>();
+  MockEventEncoder* encoder_ptr = encoder.get();
+  RtcEventLogImpl event_log(std::move(encoder),
+                            time_controller_.GetTaskQueueFactory(),
+                            kMaxEventsInHistory, kMaxEventsInConfigHistory,
+                            kMaxEventsInBuffer);
+
+  event_log.StartLogging(std::move(output_), kOutputPeriod.ms());
+  for (size_t i = 0; i < 10 * kMaxEventsInBuffer; i++) {
+    event_log.Log(std::make_unique<FakeEvent>());
+  }
+  EXPECT_CALL(*encoder_ptr, OnEncode).Times(kMaxEventsInBuffer);
+  time_controller_.AdvanceTime(kOutputPeriod);
+  Mock::VerifyAndClearExpectations(encoder_ptr);
+
+  // Events are kept again once the buffer has been output.
+  event_log.Log(std::make_unique<FakeEvent>());
+  EXPECT_CALL(*encoder_ptr, OnEncode);
+  time_controller_.AdvanceTime(kOutputPeriod);
+  Mock::VerifyAndClearExpectations(encoder_ptr);
+}
+
 }  // namespace
 }  // namespace webrtc
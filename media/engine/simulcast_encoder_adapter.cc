@@ -35,6 +35,8 @@
 #include "api/units/data_rate.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/resolution.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_bitrate_allocator.h"
 #include "api/video/video_codec_constants.h"
@@ -51,6 +53,7 @@
 #include "api/video_codecs/video_encoder_factory.h"
 #include "api/video_codecs/video_encoder_software_fallback_wrapper.h"
 #include "common_video/framerate_controller.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "media/base/sdp_video_format_utils.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "modules/video_coding/include/video_error_codes_utils.h"
@@ -100,6 +103,50 @@ int CountActiveStreams(const VideoCodec& codec) {
   return active_streams_count;
 }
 
+// Scales an I420 `source` to every resolution in `resolutions` with a single
+// pass over `source`, each layer being scaled from the next larger one.
+// Returns one buffer per entry in `resolutions`, null for entries that are
+// nullopt. Returns an empty vector if `source` isn't I420 or if there are fewer
+// than two layers to scale, in which case the caller scales each layer itself.
+std::vector<scoped_refptr<VideoFrameBuffer>> ScaleToResolutionsInOnePass(
+    VideoFrameBuffer& source,
+    const std::vector<std::optional<Resolution>>& resolutions) {
+  if (source.type() != VideoFrameBuffer::Type::kI420) {
+    return {};
+  }
+  std::vector<size_t> order;
+  for (size_t i = 0; i < resolutions.size(); ++i) {
+    if (resolutions[i]) {
+      order.push_back(i);
+    }
+  }
+  if (order.size() < 2) {
+    return {};
+  }
+  absl::c_stable_sort(order, [&](size_t a, size_t b) {
+    return resolutions[a]->PixelCount() > resolutions[b]->PixelCount();
+  });
+  // Each layer must fit in the preceding one; upscaling is left to Scale().
+  Resolution previous{source.width(), source.height()};
+  std::vector<scoped_refptr<I420Buffer>> pyramid;
+  for (size_t index : order) {
+    const Resolution& resolution = *resolutions[index];
+    if (resolution.width > previous.width ||
+        resolution.height > previous.height) {
+      return {};
+    }
+    pyramid.push_back(I420Buffer::Create(resolution.width, resolution.height));
+    previous = resolution;
+  }
+  ScaleI420Pyramid(*source.GetI420(), pyramid);
+
+  std::vector<scoped_refptr<VideoFrameBuffer>> scaled(resolutions.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    scaled[order[i]] = pyramid[i];
+  }
+  return scaled;
+}
+
 int VerifyCodec(const VideoCodec* codec_settings) {
   if (codec_settings == nullptr) {
     return WEBRTC_VIDEO_CODEC_ERR_PARAMETER;
@@ -230,11 +277,21 @@ void SimulcastEncoderAdapter::StreamContext::OnKeyframe(Timestamp timestamp) {
 }
 
 bool SimulcastEncoderAdapter::StreamContext::ShouldDropFrame(
-    Timestamp timestamp) {
+    Timestamp timestamp) const {
   if (!framerate_controller_) {
     return false;
   }
-  return framerate_controller_->ShouldDropFrame(timestamp.us() * 1000);
+  // FramerateController advances its next frame time when keeping a frame, so
+  // ask a copy of it.
+  FramerateController framerate_controller = *framerate_controller_;
+  return framerate_controller.ShouldDropFrame(timestamp.us() * 1000);
+}
+
+void SimulcastEncoderAdapter::StreamContext::OnDeltaFrame(
+    Timestamp timestamp) {
+  if (framerate_controller_) {
+    framerate_controller_->ShouldDropFrame(timestamp.us() * 1000);
+  }
 }
 
 EncodedImageCallback::Result
@@ -501,21 +558,30 @@ int SimulcastEncoderAdapter::Encode(
     }
   }
 
-  // Temporary thay may hold the result of texture to i420 buffer conversion.
-  scoped_refptr<VideoFrameBuffer> src_buffer;
+  // Decide which layers to encode this frame, and with which frame types,
+  // before any scaling is done so that all scaled layers can be produced in a
+  // single pass over the input. The keyframe and framerate state of a layer
+  // is only updated once its frame has been encoded.
+  struct LayerToEncode {
+    StreamContext* layer;
+    std::vector<VideoFrameType> frame_types;
+    bool keyframe_requested;
+    bool needs_scaling;
+  };
+  std::vector<LayerToEncode> layers_to_encode;
   int src_width = input_image.width();
   int src_height = input_image.height();
 
+  // Convert timestamp from RTP 90kHz clock.
+  const Timestamp frame_timestamp =
+      Timestamp::Micros((1000 * input_image.rtp_timestamp()) / 90);
+
   for (auto& layer : stream_contexts_) {
     // Don't encode frames in resolutions that we don't intend to send.
     if (layer.is_paused()) {
       continue;
     }
 
-    // Convert timestamp from RTP 90kHz clock.
-    const Timestamp frame_timestamp =
-        Timestamp::Micros((1000 * input_image.rtp_timestamp()) / 90);
-
     // If adapter is passed through and only one sw encoder does simulcast,
     // frame types for all streams should be passed to the encoder unchanged.
     // Otherwise a single per-encoder frame type is passed.
@@ -548,9 +614,7 @@ int SimulcastEncoderAdapter::Encode(
         }
       }
     }
-    if (keyframe_requested) {
-      layer.OnKeyframe(frame_timestamp);
-    } else if (layer.ShouldDropFrame(frame_timestamp)) {
+    if (!keyframe_requested && layer.ShouldDropFrame(frame_timestamp)) {
       continue;
     }
 
@@ -564,20 +628,48 @@ int SimulcastEncoderAdapter::Encode(
     // correctly sample/scale the source texture.
     // TODO(perkj): ensure that works going forward, and figure out how this
     // affects webrtc:5683.
-    if ((layer.width() == src_width && layer.height() == src_height) ||
-        (input_image.video_frame_buffer()->type() ==
-             VideoFrameBuffer::Type::kNative &&
-         layer.encoder().GetEncoderInfo().supports_native_handle)) {
+    bool needs_scaling =
+        !((layer.width() == src_width && layer.height() == src_height) ||
+          (input_image.video_frame_buffer()->type() ==
+               VideoFrameBuffer::Type::kNative &&
+           layer.encoder().GetEncoderInfo().supports_native_handle));
+    layers_to_encode.push_back({&layer, std::move(stream_frame_types),
+                                keyframe_requested, needs_scaling});
+  }
+
+  std::vector<std::optional<Resolution>> resolutions_to_scale;
+  for (const LayerToEncode& layer_to_encode : layers_to_encode) {
+    resolutions_to_scale.push_back(
+        layer_to_encode.needs_scaling
+            ? std::make_optional(Resolution{layer_to_encode.layer->width(),
+                                            layer_to_encode.layer->height()})
+            : std::nullopt);
+  }
+  std::vector<scoped_refptr<VideoFrameBuffer>> scaled_buffers =
+      ScaleToResolutionsInOnePass(*input_image.video_frame_buffer(),
+                                  resolutions_to_scale);
+
+  // Temporary thay may hold the result of texture to i420 buffer conversion.
+  scoped_refptr<VideoFrameBuffer> src_buffer;
+
+  for (size_t i = 0; i < layers_to_encode.size(); ++i) {
+    StreamContext& layer = *layers_to_encode[i].layer;
+    std::vector<VideoFrameType>& stream_frame_types =
+        layers_to_encode[i].frame_types;
+    if (!layers_to_encode[i].needs_scaling) {
       int ret = layer.encoder().Encode(input_image, &stream_frame_types);
       if (ret != WEBRTC_VIDEO_CODEC_OK) {
         return ret;
       }
     } else {
-      if (src_buffer == nullptr) {
-        src_buffer = input_image.video_frame_buffer();
-      }
       scoped_refptr<VideoFrameBuffer> dst_buffer =
-          src_buffer->Scale(layer.width(), layer.height());
+          scaled_buffers.empty() ? nullptr : scaled_buffers[i];
+      if (!dst_buffer) {
+        if (src_buffer == nullptr) {
+          src_buffer = input_image.video_frame_buffer();
+        }
+        dst_buffer = src_buffer->Scale(layer.width(), layer.height());
+      }
       if (!dst_buffer) {
         RTC_LOG(LS_ERROR) << "Failed to scale video frame";
         return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
@@ -595,6 +687,11 @@ int SimulcastEncoderAdapter::Encode(
         return ret;
       }
     }
+    if (layers_to_encode[i].keyframe_requested) {
+      layer.OnKeyframe(frame_timestamp);
+    } else {
+      layer.OnDeltaFrame(frame_timestamp);
+    }
   }
 
   return WEBRTC_VIDEO_CODEC_OK;
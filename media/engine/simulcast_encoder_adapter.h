@@ -136,8 +136,12 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
     }
 
     std::unique_ptr<EncoderContext> ReleaseEncoderContext() &&;
+    // Whether the frame at `timestamp` would be dropped to stay within the
+    // max framerate of the layer. Doesn't change any state; call
+    // `OnKeyframe()` or `OnDeltaFrame()` once the frame has been encoded.
+    bool ShouldDropFrame(Timestamp timestamp) const;
     void OnKeyframe(Timestamp timestamp);
-    bool ShouldDropFrame(Timestamp timestamp);
+    void OnDeltaFrame(Timestamp timestamp);
 
    private:
     SimulcastEncoderAdapter* const parent_;
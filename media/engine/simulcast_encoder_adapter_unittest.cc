@@ -1335,6 +1335,51 @@ TEST_F(TestSimulcastEncoderAdapterFake, TestFailureReturnCodesFromEncodeCalls) {
             adapter_->Encode(input_frame, &frame_types));
 }
 
+TEST_F(TestSimulcastEncoderAdapterFake,
+       DoesNotUpdateFramerateOfLayersNotEncodedOnFailure) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.numberOfSimulcastStreams = 3;
+  for (int i = 0; i < 3; ++i) {
+    codec_.simulcastStream[i].maxFramerate = 10;
+  }
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, kSettings));
+  adapter_->RegisterEncodeCompleteCallback(this);
+  std::vector<MockVideoEncoder*> encoders = helper_->factory()->encoders();
+  ASSERT_EQ(3u, encoders.size());
+
+  scoped_refptr<I420Buffer> input_buffer =
+      I420Buffer::Create(kDefaultWidth, kDefaultHeight);
+  input_buffer->InitializeData();
+  std::vector<VideoFrameType> frame_types(3, VideoFrameType::kVideoFrameDelta);
+
+  // The first layer fails to encode the first frame, so no layer encodes it.
+  EXPECT_CALL(*encoders[0], Encode)
+      .WillOnce(Return(WEBRTC_VIDEO_CODEC_ERROR));
+  EXPECT_CALL(*encoders[1], Encode).Times(0);
+  EXPECT_CALL(*encoders[2], Encode).Times(0);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_ERROR,
+            adapter_->Encode(VideoFrame::Builder()
+                                 .set_video_frame_buffer(input_buffer)
+                                 .set_rtp_timestamp(0)
+                                 .build(),
+                             &frame_types));
+
+  // Every layer encodes a frame 40 ms later, which would have been too soon
+  // at 10 fps had the first frame been encoded.
+  for (MockVideoEncoder* encoder : encoders) {
+    ::testing::Mock::VerifyAndClearExpectations(encoder);
+    EXPECT_CALL(*encoder, Encode).WillOnce(Return(WEBRTC_VIDEO_CODEC_OK));
+  }
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+            adapter_->Encode(VideoFrame::Builder()
+                                 .set_video_frame_buffer(input_buffer)
+                                 .set_rtp_timestamp(40 * 90)
+                                 .build(),
+                             &frame_types));
+}
+
 TEST_F(TestSimulcastEncoderAdapterFake, TestInitFailureCleansUpEncoders) {
   SimulcastTestFixtureImpl::DefaultSettings(
       &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
@@ -10,6 +10,7 @@
 
 #include "media/sctp/dcsctp_transport.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -38,6 +39,7 @@
 #include "net/dcsctp/public/dcsctp_socket.h"
 #include "net/dcsctp/public/dcsctp_socket_factory.h"
 #include "net/dcsctp/public/packet_observer.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "net/dcsctp/public/text_pcap_packet_observer.h"
 #include "net/dcsctp/public/timeout.h"
 #include "net/dcsctp/public/types.h"
@@ -213,6 +215,14 @@ bool DcSctpTransport::Start(const SctpOptions& options) {
     dcsctp_options.max_send_buffer_size = std::numeric_limits<size_t>::max();
     dcsctp_options.enable_message_interleaving =
         env_.field_trials().IsEnabled("WebRTC-DataChannelMessageInterleaving");
+    // DTLS already protects the integrity of the SCTP packets, so offer the
+    // peer to skip the CRC32c checksum, which otherwise has to be calculated
+    // for every sent and received packet. It's only used if the peer agrees.
+    if (env_.field_trials().IsEnabled("WebRTC-DataChannelZeroChecksum") &&
+        transport_ && transport_->IsDtlsActive()) {
+      dcsctp_options.zero_checksum_alternate_error_detection_method =
+          dcsctp::ZeroChecksumAlternateErrorDetectionMethod::LowerLayerDtls();
+    }
 
     std::unique_ptr<dcsctp::PacketObserver> packet_observer;
     if (RTC_LOG_CHECK_LEVEL(LS_VERBOSE)) {
@@ -336,15 +346,20 @@ RTCError DcSctpTransport::SendData(int sid,
     return RTCError(RTCErrorType::INVALID_RANGE);
   }
 
-  std::vector<uint8_t> message_payload(payload.cdata(),
-                                       payload.cdata() + payload.size());
-  if (message_payload.empty()) {
+  dcsctp::PayloadSlice message_payload;
+  if (payload.empty()) {
     // https://www.rfc-editor.org/rfc/rfc8831.html#section-6.6
     // SCTP does not support the sending of empty user messages. Therefore, if
     // an empty message has to be sent, the appropriate PPID (WebRTC String
     // Empty or WebRTC Binary Empty) is used, and the SCTP user message of one
     // zero byte is sent.
-    message_payload.push_back('\0');
+    message_payload = std::vector<uint8_t>{'\0'};
+  } else {
+    // The message shares the buffer with `payload` instead of copying it. It
+    // stays unmodified while shared, as CopyOnWriteBuffer copies on writes.
+    auto buffer = std::make_shared<const CopyOnWriteBuffer>(payload);
+    message_payload = dcsctp::PayloadSlice(
+        buffer, ArrayView<const uint8_t>(buffer->cdata(), buffer->size()));
   }
 
   dcsctp::DcSctpMessage message(
@@ -467,6 +482,49 @@ SendPacketStatus DcSctpTransport::SendPacketWithStatus(
   return SendPacketStatus::kSuccess;
 }
 
+void DcSctpTransport::SendPacketsWithStatus(
+    ArrayView<const ArrayView<const uint8_t>> packets,
+    ArrayView<SendPacketStatus> statuses) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  RTC_DCHECK(socket_);
+  RTC_DCHECK_EQ(packets.size(), statuses.size());
+
+  for (ArrayView<const uint8_t> packet : packets) {
+    if (packet.size() > socket_->options().mtu) {
+      // Let the single packet path report, and drop, the oversized packets.
+      for (size_t i = 0; i < packets.size(); ++i) {
+        statuses[i] = SendPacketWithStatus(packets[i]);
+      }
+      return;
+    }
+  }
+  TRACE_EVENT0("webrtc", "DcSctpTransport::SendPackets");
+
+  if (!transport_ || !transport_->writable()) {
+    std::fill(statuses.begin(), statuses.end(), SendPacketStatus::kError);
+    return;
+  }
+
+  RTC_DLOG(LS_VERBOSE) << debug_name_ << "->SendPackets(count="
+                       << packets.size() << ")";
+
+  size_t sent = transport_->SendPackets(packets, AsyncSocketPacketOptions());
+  std::fill(statuses.begin(), statuses.begin() + sent,
+            SendPacketStatus::kSuccess);
+  if (sent < packets.size()) {
+    RTC_LOG(LS_WARNING) << debug_name_ << "->SendPackets(count="
+                        << packets.size() << ") failed after " << sent
+                        << " packets with error: " << transport_->GetError()
+                        << ".";
+    // The packets after the one that failed weren't attempted, and are
+    // reported as failing for the same reason.
+    std::fill(statuses.begin() + sent, statuses.end(),
+              IsBlockingError(transport_->GetError())
+                  ? SendPacketStatus::kTemporaryFailure
+                  : SendPacketStatus::kError);
+  }
+}
+
 std::unique_ptr<dcsctp::Timeout> DcSctpTransport::CreateTimeout(
     TaskQueueBase::DelayPrecision precision) {
   return task_queue_timeout_factory_.CreateTimeout(precision);
@@ -82,6 +82,9 @@ class DcSctpTransport : public SctpTransportInternal,
   // dcsctp::DcSctpSocketCallbacks
   dcsctp::SendPacketStatus SendPacketWithStatus(
       ArrayView<const uint8_t> data) override;
+  void SendPacketsWithStatus(
+      ArrayView<const ArrayView<const uint8_t>> packets,
+      ArrayView<dcsctp::SendPacketStatus> statuses) override;
   std::unique_ptr<dcsctp::Timeout> CreateTimeout(
       TaskQueueBase::DelayPrecision precision) override;
   dcsctp::TimeMs TimeMillis() override;
@@ -10,12 +10,17 @@
 
 #include "media/sctp/dcsctp_transport.h"
 
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
 #include "api/environment/environment.h"
 #include "api/environment/environment_factory.h"
+#include "api/field_trials.h"
 #include "api/priority.h"
 #include "api/rtc_error.h"
 #include "api/transport/data_channel_transport_interface.h"
@@ -34,12 +39,15 @@
 
 using ::testing::_;
 using ::testing::ByMove;
+using ::testing::DoAll;
 using ::testing::ElementsAre;
 using ::testing::InSequence;
 using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnPointee;
+using ::testing::ReturnRef;
+using ::testing::SaveArg;
 
 namespace webrtc {
 
@@ -69,10 +77,11 @@ static_assert(!std::is_abstract_v<MockDataChannelSink>);
 
 class Peer {
  public:
-  Peer()
+  explicit Peer(absl::string_view field_trials = "")
       : fake_dtls_transport_(kTransportName, kComponent),
         simulated_clock_(1000),
-        env_(CreateEnvironment(&simulated_clock_)) {
+        env_(CreateEnvironment(&simulated_clock_,
+                               FieldTrials::CreateNoGlobal(field_trials))) {
     auto socket_ptr = std::make_unique<dcsctp::MockDcSctpSocket>();
     socket_ = socket_ptr.get();
 
@@ -80,7 +89,8 @@ class Peer {
         std::make_unique<dcsctp::MockDcSctpSocketFactory>();
     EXPECT_CALL(*mock_dcsctp_socket_factory, Create)
         .Times(1)
-        .WillOnce(Return(ByMove(std::move(socket_ptr))));
+        .WillOnce(DoAll(SaveArg<3>(&socket_options_),
+                        Return(ByMove(std::move(socket_ptr)))));
 
     sctp_transport_ = std::make_unique<webrtc::DcSctpTransport>(
         env_, Thread::Current(), &fake_dtls_transport_,
@@ -93,6 +103,7 @@ class Peer {
   webrtc::SimulatedClock simulated_clock_;
   Environment env_;
   dcsctp::MockDcSctpSocket* socket_;
+  dcsctp::DcSctpOptions socket_options_;
   std::unique_ptr<webrtc::DcSctpTransport> sctp_transport_;
   NiceMock<MockDataChannelSink> sink_;
 };
@@ -319,4 +330,87 @@ TEST(DcSctpTransportTest, DropMessageWithUnknownPpid) {
       ->OnMessageReceived(
           dcsctp::DcSctpMessage(dcsctp::StreamID(1), dcsctp::PPID(1337), {0}));
 }
+
+TEST(DcSctpTransportTest, OffersZeroChecksumOverDtls) {
+  AutoThread main_thread;
+  Peer peer_a("WebRTC-DataChannelZeroChecksum/Enabled/");
+  peer_a.fake_dtls_transport_.SetLocalCertificate(nullptr);
+  peer_a.sctp_transport_->Start({.local_port = 5000,
+                                 .remote_port = 5000,
+                                 .max_message_size = 256 * 1024});
+  EXPECT_EQ(
+      peer_a.socket_options_.zero_checksum_alternate_error_detection_method,
+      dcsctp::ZeroChecksumAlternateErrorDetectionMethod::LowerLayerDtls());
+}
+
+TEST(DcSctpTransportTest, DoesNotOfferZeroChecksumByDefault) {
+  AutoThread main_thread;
+  Peer peer_a;
+  peer_a.fake_dtls_transport_.SetLocalCertificate(nullptr);
+  peer_a.sctp_transport_->Start({.local_port = 5000,
+                                 .remote_port = 5000,
+                                 .max_message_size = 256 * 1024});
+  EXPECT_EQ(
+      peer_a.socket_options_.zero_checksum_alternate_error_detection_method,
+      dcsctp::ZeroChecksumAlternateErrorDetectionMethod::None());
+}
+
+TEST(DcSctpTransportTest, DoesNotOfferZeroChecksumWithoutDtls) {
+  AutoThread main_thread;
+  Peer peer_a("WebRTC-DataChannelZeroChecksum/Enabled/");
+  peer_a.sctp_transport_->Start({.local_port = 5000,
+                                 .remote_port = 5000,
+                                 .max_message_size = 256 * 1024});
+  EXPECT_EQ(
+      peer_a.socket_options_.zero_checksum_alternate_error_detection_method,
+      dcsctp::ZeroChecksumAlternateErrorDetectionMethod::None());
+}
+
+TEST(DcSctpTransportTest, SendsBatchOfPackets) {
+  AutoThread main_thread;
+  Peer peer_a;
+  Peer peer_b;
+  peer_a.fake_dtls_transport_.SetDestination(&peer_b.fake_dtls_transport_,
+                                             false);
+  dcsctp::DcSctpOptions options;
+  EXPECT_CALL(*peer_a.socket_, options()).WillRepeatedly(ReturnRef(options));
+  peer_a.sctp_transport_->Start({.local_port = 5000,
+                                 .remote_port = 5000,
+                                 .max_message_size = 256 * 1024});
+
+  const std::vector<uint8_t> packet1(100, 1);
+  const std::vector<uint8_t> packet2(200, 2);
+  const ArrayView<const uint8_t> packets[] = {packet1, packet2};
+  dcsctp::SendPacketStatus statuses[2] = {dcsctp::SendPacketStatus::kError,
+                                          dcsctp::SendPacketStatus::kError};
+  static_cast<dcsctp::DcSctpSocketCallbacks*>(peer_a.sctp_transport_.get())
+      ->SendPacketsWithStatus(packets, statuses);
+
+  EXPECT_THAT(statuses, ElementsAre(dcsctp::SendPacketStatus::kSuccess,
+                                    dcsctp::SendPacketStatus::kSuccess));
+  EXPECT_EQ(peer_a.fake_dtls_transport_.fake_ice_transport()
+                ->last_sent_packet()
+                .size(),
+            packet2.size());
+}
+
+TEST(DcSctpTransportTest, FailsBatchOfPacketsWhenNotWritable) {
+  AutoThread main_thread;
+  Peer peer_a;
+  dcsctp::DcSctpOptions options;
+  EXPECT_CALL(*peer_a.socket_, options()).WillRepeatedly(ReturnRef(options));
+  peer_a.sctp_transport_->Start({.local_port = 5000,
+                                 .remote_port = 5000,
+                                 .max_message_size = 256 * 1024});
+
+  const std::vector<uint8_t> packet(100);
+  const ArrayView<const uint8_t> packets[] = {packet, packet};
+  dcsctp::SendPacketStatus statuses[2] = {dcsctp::SendPacketStatus::kSuccess,
+                                          dcsctp::SendPacketStatus::kSuccess};
+  static_cast<dcsctp::DcSctpSocketCallbacks*>(peer_a.sctp_transport_.get())
+      ->SendPacketsWithStatus(packets, statuses);
+
+  EXPECT_THAT(statuses, ElementsAre(dcsctp::SendPacketStatus::kError,
+                                    dcsctp::SendPacketStatus::kError));
+}
 }  // namespace webrtc
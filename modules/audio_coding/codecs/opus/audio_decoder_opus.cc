@@ -24,19 +24,39 @@ namespace webrtc {
 AudioDecoderOpusImpl::AudioDecoderOpusImpl(const FieldTrialsView& field_trials,
                                            size_t num_channels,
                                            int sample_rate_hz)
-    : channels_(num_channels),
+    : AudioDecoderOpusImpl(field_trials,
+                           num_channels,
+                           sample_rate_hz,
+                           &OpusDecoderStatePool::Shared()) {}
+
+AudioDecoderOpusImpl::AudioDecoderOpusImpl(const FieldTrialsView& field_trials,
+                                           size_t num_channels,
+                                           int sample_rate_hz,
+                                           OpusDecoderStatePool* state_pool)
+    : state_pool_(state_pool),
+      dec_state_(nullptr),
+      channels_(num_channels),
       sample_rate_hz_(sample_rate_hz),
       generate_plc_(field_trials.IsEnabled("WebRTC-Audio-OpusGeneratePlc")) {
   RTC_DCHECK(num_channels == 1 || num_channels == 2);
   RTC_DCHECK(sample_rate_hz == 16000 || sample_rate_hz == 48000);
-  const int error =
-      WebRtcOpus_DecoderCreate(&dec_state_, channels_, sample_rate_hz_);
-  RTC_DCHECK(error == 0);
-  WebRtcOpus_DecoderInit(dec_state_);
+  if (state_pool_) {
+    dec_state_ = state_pool_->Acquire(channels_, sample_rate_hz_);
+    RTC_DCHECK(dec_state_);
+  } else {
+    const int error =
+        WebRtcOpus_DecoderCreate(&dec_state_, channels_, sample_rate_hz_);
+    RTC_DCHECK(error == 0);
+    WebRtcOpus_DecoderInit(dec_state_);
+  }
 }
 
 AudioDecoderOpusImpl::~AudioDecoderOpusImpl() {
-  WebRtcOpus_DecoderFree(dec_state_);
+  if (state_pool_) {
+    state_pool_->Release(dec_state_);
+  } else {
+    WebRtcOpus_DecoderFree(dec_state_);
+  }
 }
 
 std::vector<AudioDecoder::ParseResult> AudioDecoderOpusImpl::ParsePayload(
@@ -18,6 +18,7 @@
 
 #include "api/audio_codecs/audio_decoder.h"
 #include "api/field_trials_view.h"
+#include "modules/audio_coding/codecs/opus/opus_decoder_state_pool.h"
 #include "modules/audio_coding/codecs/opus/opus_interface.h"
 #include "rtc_base/buffer.h"
 
@@ -25,9 +26,16 @@ namespace webrtc {
 
 class AudioDecoderOpusImpl final : public AudioDecoder {
  public:
+  // Takes the decoder state from OpusDecoderStatePool::Shared().
   explicit AudioDecoderOpusImpl(const FieldTrialsView& field_trails,
                                 size_t num_channels,
                                 int sample_rate_hz);
+  // Takes the decoder state from `state_pool`, which must outlive the decoder,
+  // or creates its own state if `state_pool` is null.
+  AudioDecoderOpusImpl(const FieldTrialsView& field_trails,
+                       size_t num_channels,
+                       int sample_rate_hz,
+                       OpusDecoderStatePool* state_pool);
 
   ~AudioDecoderOpusImpl() override;
 
@@ -59,6 +67,7 @@ class AudioDecoderOpusImpl final : public AudioDecoder {
                               SpeechType* speech_type) override;
 
  private:
+  OpusDecoderStatePool* const state_pool_;
   OpusDecInst* dec_state_;
   const size_t channels_;
   const int sample_rate_hz_;
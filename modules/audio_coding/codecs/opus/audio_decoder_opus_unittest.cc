@@ -23,6 +23,7 @@
 #include "api/environment/environment.h"
 #include "api/environment/environment_factory.h"
 #include "modules/audio_coding/codecs/opus/audio_encoder_opus.h"
+#include "modules/audio_coding/codecs/opus/opus_decoder_state_pool.h"
 #include "modules/audio_coding/test/PCMFile.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
@@ -435,4 +436,52 @@ TEST(AudioDecoderOpusTest,
   EXPECT_FALSE(IsTrivialStereo(decoded_view));
 }
 
+TEST(AudioDecoderOpusTest, PooledStateDecodesLikeNewState) {
+  const Environment env = EnvironmentFactory().Create();
+  OpusDecoderStatePool pool(/*max_idle_states=*/1);
+  uint32_t rtp_timestamp = 0xFFFu;
+  uint32_t timestamp = 0;
+  {
+    // Leave a used decoder state in the pool.
+    AudioEncoderOpusImpl encoder(
+        env, GetEncoderConfig(/*num_channels=*/2, /*dtx_enabled=*/false),
+        kPayloadType);
+    AudioDecoderOpusImpl decoder(env.field_trials(), /*num_channels=*/2,
+                                 kSampleRateHz, &pool);
+    EncodeDecodeSpeech(encoder, decoder, rtp_timestamp, timestamp,
+                       /*max_frames=*/50);
+  }
+  ASSERT_EQ(pool.num_idle_states(), 1u);
+
+  AudioEncoderOpusImpl encoder(
+      env, GetEncoderConfig(/*num_channels=*/2, /*dtx_enabled=*/false),
+      kPayloadType);
+  AudioDecoderOpusImpl pooled_decoder(env.field_trials(), /*num_channels=*/2,
+                                      kSampleRateHz, &pool);
+  EXPECT_EQ(pool.num_idle_states(), 0u);
+  AudioDecoderOpusImpl new_decoder(env.field_trials(), /*num_channels=*/2,
+                                   kSampleRateHz, /*state_pool=*/nullptr);
+
+  WhiteNoiseGenerator generator(/*amplitude_dbfs=*/-20.0);
+  std::vector<int16_t> input_frame(kInputFrameLength * 2);
+  std::vector<int16_t> pooled_output(kEncoderFrameLength * 2);
+  std::vector<int16_t> new_output(kEncoderFrameLength * 2);
+  for (int i = 0; i < 20; ++i) {
+    generator.GenerateNextFrame(input_frame);
+    Buffer payload;
+    encoder.Encode(rtp_timestamp++, input_frame, &payload);
+    if (payload.size() == 0) {
+      continue;
+    }
+    AudioDecoder::SpeechType speech_type;
+    ASSERT_EQ(pooled_decoder.Decode(payload.data(), payload.size(),
+                                    kSampleRateHz, pooled_output.size(),
+                                    pooled_output.data(), &speech_type),
+              new_decoder.Decode(payload.data(), payload.size(),
+                                 kSampleRateHz, new_output.size(),
+                                 new_output.data(), &speech_type));
+    EXPECT_EQ(pooled_output, new_output);
+  }
+}
+
 }  // namespace webrtc
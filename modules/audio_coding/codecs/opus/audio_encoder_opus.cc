@@ -650,23 +650,35 @@ size_t AudioEncoderOpusImpl::SufficientOutputBufferSize() const {
 
 // If the given config is OK, recreate the Opus encoder instance with those
 // settings, save the config, and return true. Otherwise, do nothing and return
-// false.
+// false. The instance is reset rather than recreated if the new settings can
+// all be applied to it, which gives the same result at a fraction of the cost.
 bool AudioEncoderOpusImpl::RecreateEncoderInstance(
     const AudioEncoderOpusConfig& config) {
   if (!config.IsOk())
     return false;
+  const bool reuse_instance = inst_ &&
+                              config.num_channels == config_.num_channels &&
+                              config.sample_rate_hz == config_.sample_rate_hz &&
+                              config.application == config_.application;
   config_ = config;
-  if (inst_)
-    RTC_CHECK_EQ(0, WebRtcOpus_EncoderFree(inst_));
   input_buffer_.clear();
   input_buffer_.reserve(Num10msFramesPerPacket() * SamplesPer10msFrame());
-  RTC_CHECK_EQ(0, WebRtcOpus_EncoderCreate(
-                      &inst_, config.num_channels,
-                      config.application ==
-                              AudioEncoderOpusConfig::ApplicationMode::kVoip
-                          ? 0
-                          : 1,
-                      config.sample_rate_hz));
+  if (reuse_instance) {
+    RTC_CHECK_EQ(0, WebRtcOpus_EncoderInit(inst_));
+    // Undo the settings that are not applied below.
+    RTC_CHECK_EQ(0, WebRtcOpus_SetBandwidth(inst_, OPUS_AUTO));
+    RTC_CHECK_EQ(0, WebRtcOpus_SetForceChannels(inst_, 0));
+  } else {
+    if (inst_)
+      RTC_CHECK_EQ(0, WebRtcOpus_EncoderFree(inst_));
+    RTC_CHECK_EQ(0, WebRtcOpus_EncoderCreate(
+                        &inst_, config.num_channels,
+                        config.application ==
+                                AudioEncoderOpusConfig::ApplicationMode::kVoip
+                            ? 0
+                            : 1,
+                        config.sample_rate_hz));
+  }
   const int bitrate = GetBitrateBps(config);
   RTC_CHECK_EQ(0, WebRtcOpus_SetBitRate(inst_, bitrate));
   RTC_LOG(LS_VERBOSE) << "Set Opus bitrate to " << bitrate << " bps.";
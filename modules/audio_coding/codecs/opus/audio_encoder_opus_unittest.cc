@@ -546,6 +546,52 @@ TEST_P(AudioEncoderOpusTest, EncodeAtMinBitrate) {
   }
 }
 
+// Reset() reuses the Opus encoder instance, which must give the same output
+// as a new encoder, whatever settings were applied to the instance before.
+TEST_P(AudioEncoderOpusTest, ResetEncodesLikeNewEncoder) {
+  auto used_states = CreateCodec(sample_rate_hz_, 2);
+  auto new_states = CreateCodec(sample_rate_hz_, 2);
+  constexpr int kNumPacketsToEncode = 10;
+  uint32_t rtp_timestamp = 12345;
+  Buffer encoded;
+
+  auto audio_frames =
+      Create10msAudioBlocks(used_states->encoder, kNumPacketsToEncode * 20);
+  ASSERT_TRUE(audio_frames);
+  // Have the audio network adaptor force mono encoding.
+  used_states->encoder->EnableAudioNetworkAdaptor("", nullptr);
+  AudioEncoderRuntimeConfig runtime_config;
+  runtime_config.num_channels = 1;
+  EXPECT_CALL(*used_states->mock_audio_network_adaptor,
+              GetEncoderRuntimeConfig())
+      .WillOnce(Return(runtime_config));
+  used_states->encoder->OnReceivedUplinkPacketLossFraction(0.0f);
+  used_states->encoder->DisableAudioNetworkAdaptor();
+  ASSERT_EQ(used_states->encoder->num_channels_to_encode(), 1u);
+  for (int i = 0; i < 2 * kNumPacketsToEncode; ++i) {
+    used_states->encoder->Encode(rtp_timestamp++, audio_frames->GetNextBlock(),
+                                 &encoded);
+  }
+  used_states->encoder->Reset();
+
+  auto used_audio_frames =
+      Create10msAudioBlocks(used_states->encoder, kNumPacketsToEncode * 20);
+  auto new_audio_frames =
+      Create10msAudioBlocks(new_states->encoder, kNumPacketsToEncode * 20);
+  ASSERT_TRUE(used_audio_frames);
+  ASSERT_TRUE(new_audio_frames);
+  for (int i = 0; i < 2 * kNumPacketsToEncode; ++i) {
+    Buffer used_encoded;
+    Buffer new_encoded;
+    used_states->encoder->Encode(
+        rtp_timestamp, used_audio_frames->GetNextBlock(), &used_encoded);
+    new_states->encoder->Encode(rtp_timestamp, new_audio_frames->GetNextBlock(),
+                                &new_encoded);
+    ++rtp_timestamp;
+    EXPECT_EQ(used_encoded, new_encoded);
+  }
+}
+
 TEST(AudioEncoderOpusTest, TestConfigDefaults) {
   const auto config_opt = AudioEncoderOpus::SdpToConfig({"opus", 48000, 2});
   ASSERT_TRUE(config_opt);
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/codecs/opus/opus_decoder_state_pool.h"
+
+#include <stddef.h>
+
+#include <utility>
+
+#include "modules/audio_coding/codecs/opus/opus_inst.h"
+#include "modules/audio_coding/codecs/opus/opus_interface.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+
+namespace {
+// A stereo 48 kHz state takes about 26 kB, so the shared pool holds at most a
+// few MB of idle states.
+constexpr size_t kMaxSharedIdleStates = 128;
+}  // namespace
+
+OpusDecoderStatePool& OpusDecoderStatePool::Shared() {
+  static OpusDecoderStatePool* const pool =
+      new OpusDecoderStatePool(kMaxSharedIdleStates);
+  return *pool;
+}
+
+OpusDecoderStatePool::OpusDecoderStatePool(size_t max_idle_states)
+    : max_idle_states_(max_idle_states) {}
+
+OpusDecoderStatePool::~OpusDecoderStatePool() {
+  for (OpusDecInst* state : idle_states_) {
+    WebRtcOpus_DecoderFree(state);
+  }
+}
+
+OpusDecInst* OpusDecoderStatePool::Acquire(size_t channels,
+                                           int sample_rate_hz) {
+  OpusDecInst* state = nullptr;
+  {
+    MutexLock lock(&mutex_);
+    // Prefer the most recently released state, which is the most likely to
+    // still be in the cache.
+    for (size_t i = idle_states_.size(); i > 0; --i) {
+      OpusDecInst* idle_state = idle_states_[i - 1];
+      if (idle_state->channels == channels &&
+          idle_state->sample_rate_hz == sample_rate_hz) {
+        state = idle_state;
+        std::swap(idle_states_[i - 1], idle_states_.back());
+        idle_states_.pop_back();
+        break;
+      }
+    }
+  }
+  if (!state) {
+    if (WebRtcOpus_DecoderCreate(&state, channels, sample_rate_hz) != 0) {
+      return nullptr;
+    }
+  }
+  WebRtcOpus_DecoderInit(state);
+  state->last_packet_num_channels = static_cast<int>(channels);
+  return state;
+}
+
+void OpusDecoderStatePool::Release(OpusDecInst* state) {
+  if (!state)
+    return;
+  RTC_DCHECK(state->decoder) << "Multistream decoders are not pooled.";
+  {
+    MutexLock lock(&mutex_);
+    if (idle_states_.size() < max_idle_states_) {
+      idle_states_.push_back(state);
+      return;
+    }
+  }
+  WebRtcOpus_DecoderFree(state);
+}
+
+size_t OpusDecoderStatePool::num_idle_states() const {
+  MutexLock lock(&mutex_);
+  return idle_states_.size();
+}
+
+}  // namespace webrtc
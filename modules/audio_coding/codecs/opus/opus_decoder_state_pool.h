@@ -0,0 +1,59 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_CODECS_OPUS_OPUS_DECODER_STATE_POOL_H_
+#define MODULES_AUDIO_CODING_CODECS_OPUS_OPUS_DECODER_STATE_POOL_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "modules/audio_coding/codecs/opus/opus_interface.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Keeps the Opus states of destroyed decoders, so that a new decoder with the
+// same number of channels and sample rate resets one instead of allocating and
+// initializing a new state. This makes creating and destroying decoders cheap
+// when streams come and go, e.g. on a conference server. At most
+// `max_idle_states` unused states are kept; beyond that they are freed.
+// Thread-safe.
+class OpusDecoderStatePool {
+ public:
+  // The pool used by AudioDecoderOpusImpl by default, shared by all decoders
+  // in the process.
+  static OpusDecoderStatePool& Shared();
+
+  explicit OpusDecoderStatePool(size_t max_idle_states);
+  ~OpusDecoderStatePool();
+
+  OpusDecoderStatePool(const OpusDecoderStatePool&) = delete;
+  OpusDecoderStatePool& operator=(const OpusDecoderStatePool&) = delete;
+
+  // Returns a decoder state in its initial state, or null if a new state is
+  // needed and can't be created. The state must be returned with Release().
+  OpusDecInst* Acquire(size_t channels, int sample_rate_hz);
+
+  // Takes back a state returned by Acquire(). Null is ignored.
+  void Release(OpusDecInst* state);
+
+  size_t num_idle_states() const;
+
+ private:
+  const size_t max_idle_states_;
+  mutable Mutex mutex_;
+  std::vector<OpusDecInst*> idle_states_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_CODECS_OPUS_OPUS_DECODER_STATE_POOL_H_
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/codecs/opus/opus_decoder_state_pool.h"
+
+#include "modules/audio_coding/codecs/opus/opus_interface.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(OpusDecoderStatePoolTest, ReusesReleasedState) {
+  OpusDecoderStatePool pool(/*max_idle_states=*/4);
+  OpusDecInst* state = pool.Acquire(/*channels=*/2, /*sample_rate_hz=*/48000);
+  ASSERT_NE(state, nullptr);
+  EXPECT_EQ(WebRtcOpus_DecoderChannels(state), 2u);
+  pool.Release(state);
+  EXPECT_EQ(pool.num_idle_states(), 1u);
+
+  EXPECT_EQ(pool.Acquire(/*channels=*/2, /*sample_rate_hz=*/48000), state);
+  EXPECT_EQ(pool.num_idle_states(), 0u);
+  pool.Release(state);
+}
+
+TEST(OpusDecoderStatePoolTest, DoesNotReuseStateWithOtherFormat) {
+  OpusDecoderStatePool pool(/*max_idle_states=*/4);
+  OpusDecInst* stereo = pool.Acquire(/*channels=*/2, /*sample_rate_hz=*/48000);
+  pool.Release(stereo);
+
+  OpusDecInst* mono = pool.Acquire(/*channels=*/1, /*sample_rate_hz=*/48000);
+  ASSERT_NE(mono, nullptr);
+  EXPECT_NE(mono, stereo);
+  EXPECT_EQ(WebRtcOpus_DecoderChannels(mono), 1u);
+  OpusDecInst* wideband =
+      pool.Acquire(/*channels=*/2, /*sample_rate_hz=*/16000);
+  ASSERT_NE(wideband, nullptr);
+  EXPECT_NE(wideband, stereo);
+  EXPECT_EQ(pool.num_idle_states(), 1u);
+
+  pool.Release(mono);
+  pool.Release(wideband);
+  EXPECT_EQ(pool.num_idle_states(), 3u);
+}
+
+TEST(OpusDecoderStatePoolTest, KeepsAtMostMaxIdleStates) {
+  OpusDecoderStatePool pool(/*max_idle_states=*/2);
+  OpusDecInst* states[3];
+  for (OpusDecInst*& state : states) {
+    state = pool.Acquire(/*channels=*/1, /*sample_rate_hz=*/16000);
+    ASSERT_NE(state, nullptr);
+  }
+  for (OpusDecInst* state : states) {
+    pool.Release(state);
+  }
+  EXPECT_EQ(pool.num_idle_states(), 2u);
+}
+
+}  // namespace webrtc
@@ -146,6 +146,20 @@ int16_t WebRtcOpus_EncoderFree(OpusEncInst* inst) {
   }
 }
 
+int16_t WebRtcOpus_EncoderInit(OpusEncInst* inst) {
+  if (!inst)
+    return -1;
+  const int error =
+      inst->encoder
+          ? opus_encoder_ctl(inst->encoder, OPUS_RESET_STATE)
+          : opus_multistream_encoder_ctl(inst->multistream_encoder,
+                                         OPUS_RESET_STATE);
+  if (error != OPUS_OK)
+    return -1;
+  inst->in_dtx_mode = 0;
+  return 0;
+}
+
 int WebRtcOpus_Encode(OpusEncInst* inst,
                       const int16_t* audio_in,
                       size_t samples,
@@ -83,6 +83,21 @@ int16_t WebRtcOpus_MultistreamEncoderCreate(
 
 int16_t WebRtcOpus_EncoderFree(OpusEncInst* inst);
 
+/****************************************************************************
+ * WebRtcOpus_EncoderInit(...)
+ *
+ * This function resets state of the encoder, as if it had just been created,
+ * but keeps its settings. Cheaper than freeing the encoder and creating a new
+ * one.
+ *
+ * Input:
+ *      - inst               : Encoder context
+ *
+ * Return value              : 0 - Success
+ *                            -1 - Error
+ */
+int16_t WebRtcOpus_EncoderInit(OpusEncInst* inst);
+
 /****************************************************************************
  * WebRtcOpus_Encode(...)
  *
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "api/audio_codecs/audio_encoder.h"
+#include "api/audio_codecs/opus/audio_encoder_opus_config.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_coding/codecs/opus/audio_decoder_opus.h"
+#include "modules/audio_coding/codecs/opus/audio_encoder_opus.h"
+#include "modules/audio_coding/codecs/opus/opus_decoder_state_pool.h"
+#include "modules/audio_coding/codecs/opus/opus_inst.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr int kPayloadType = 111;
+
+// Cost of creating and destroying a decoder, as when receive streams come and
+// go on a conference server, with and without reusing pooled Opus states. The
+// memory counter is what each active stream holds, which pooling does not
+// change; the pool adds at most its idle states on top.
+void BM_OpusDecoderCreateDestroy(benchmark::State& state) {
+  const bool pooled = state.range(0) != 0;
+  const size_t num_channels = state.range(1);
+  const Environment env = CreateEnvironment();
+  OpusDecoderStatePool pool(/*max_idle_states=*/1);
+  for (auto _ : state) {
+    auto decoder = std::make_unique<AudioDecoderOpusImpl>(
+        env.field_trials(), num_channels, kSampleRateHz,
+        pooled ? &pool : nullptr);
+    benchmark::DoNotOptimize(decoder.get());
+  }
+  state.counters["bytes_per_stream"] = static_cast<double>(
+      sizeof(AudioDecoderOpusImpl) + sizeof(WebRtcOpusDecInst) +
+      opus_decoder_get_size(static_cast<int>(num_channels)));
+}
+
+BENCHMARK(BM_OpusDecoderCreateDestroy)
+    ->ArgNames({"pooled", "channels"})
+    ->ArgsProduct({{0, 1}, {1, 2}});
+
+// Cost of an encoder reconfiguration that keeps the Opus instance and resets
+// it (a new maximum playback rate) versus one that has to recreate it (a new
+// application mode).
+void BM_OpusEncoderReconfigure(benchmark::State& state) {
+  const bool recreate = state.range(0) != 0;
+  const Environment env = CreateEnvironment();
+  AudioEncoderOpusConfig config;
+  config.num_channels = 2;
+  config.bitrate_bps = 64000;
+  AudioEncoderOpusImpl encoder(env, config, kPayloadType);
+  bool toggle = false;
+  for (auto _ : state) {
+    toggle = !toggle;
+    if (recreate) {
+      encoder.SetApplication(toggle ? AudioEncoder::Application::kSpeech
+                                    : AudioEncoder::Application::kAudio);
+    } else {
+      encoder.SetMaxPlaybackRate(toggle ? 16000 : kSampleRateHz);
+    }
+  }
+  state.counters["bytes_per_stream"] = static_cast<double>(
+      sizeof(AudioEncoderOpusImpl) + sizeof(WebRtcOpusEncInst) +
+      opus_encoder_get_size(config.num_channels));
+}
+
+BENCHMARK(BM_OpusEncoderReconfigure)->ArgName("recreate")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/neteq_batch_driver.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "api/audio/audio_frame.h"
+#include "api/neteq/neteq.h"
+#include "api/sequence_checker.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+
+namespace webrtc {
+namespace {
+
+// Number of consecutive streams a thread claims at a time. Large enough to
+// keep the contention on the claim counter low, small enough to balance the
+// load when some streams are more expensive than others.
+constexpr size_t kStreamsPerClaim = 8;
+
+}  // namespace
+
+NetEqBatchDriver::NetEqBatchDriver(const Config& config)
+    : measure_cpu_time_(config.measure_cpu_time) {
+  RTC_DCHECK_GE(config.num_threads, 1);
+  for (int i = 0; i < config.num_threads; ++i) {
+    frames_.push_back(std::make_unique<AudioFrame>());
+  }
+  for (int i = 1; i < config.num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->thread = PlatformThread::SpawnJoinable(
+        [this, i] { RunWorker(i); }, "NetEqBatchWorker");
+  }
+}
+
+NetEqBatchDriver::~NetEqBatchDriver() {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  quit_ = true;
+  for (auto& worker : workers_) {
+    worker->start.Set();
+  }
+  for (auto& worker : workers_) {
+    worker->thread.Finalize();
+  }
+}
+
+int NetEqBatchDriver::AddStream(std::unique_ptr<NetEq> neteq) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK(neteq);
+  int stream_id;
+  if (free_stream_ids_.empty()) {
+    stream_id = static_cast<int>(streams_.size());
+    streams_.emplace_back();
+  } else {
+    stream_id = free_stream_ids_.back();
+    free_stream_ids_.pop_back();
+  }
+  streams_[stream_id] = {.neteq = std::move(neteq)};
+  return stream_id;
+}
+
+void NetEqBatchDriver::RemoveStream(int stream_id) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK(GetNetEq(stream_id));
+  streams_[stream_id] = Stream();
+  free_stream_ids_.push_back(stream_id);
+}
+
+int NetEqBatchDriver::num_streams() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return static_cast<int>(streams_.size() - free_stream_ids_.size());
+}
+
+NetEq* NetEqBatchDriver::GetNetEq(int stream_id) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK_GE(stream_id, 0);
+  RTC_DCHECK_LT(stream_id, streams_.size());
+  return streams_[stream_id].neteq.get();
+}
+
+NetEqBatchDriver::StreamStats NetEqBatchDriver::GetStreamStats(
+    int stream_id) const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK_GE(stream_id, 0);
+  RTC_DCHECK_LT(stream_id, streams_.size());
+  const Stream& stream = streams_[stream_id];
+  return {.num_ticks = stream.num_ticks,
+          .num_errors = stream.num_errors,
+          .cpu_time = TimeDelta::Micros(stream.cpu_time_ns / 1000)};
+}
+
+void NetEqBatchDriver::Tick(AudioCallback on_audio) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  on_audio_ = &on_audio;
+  next_stream_.store(0, std::memory_order_relaxed);
+
+  // Only wake up the workers that have streams to claim.
+  const size_t num_claims =
+      (streams_.size() + kStreamsPerClaim - 1) / kStreamsPerClaim;
+  const size_t num_active_workers =
+      std::min(workers_.size(), num_claims > 0 ? num_claims - 1 : 0);
+  num_pending_workers_.store(num_active_workers);
+  for (size_t i = 0; i < num_active_workers; ++i) {
+    workers_[i]->start.Set();
+  }
+  RunStreams(/*thread_index=*/0);
+  if (num_active_workers > 0) {
+    done_.Wait(Event::kForever);
+  }
+  on_audio_ = nullptr;
+}
+
+void NetEqBatchDriver::RunWorker(size_t worker_index) {
+  Worker& worker = *workers_[worker_index];
+  while (true) {
+    worker.start.Wait(Event::kForever);
+    if (quit_) {
+      return;
+    }
+    RunStreams(/*thread_index=*/worker_index + 1);
+    if (num_pending_workers_.fetch_sub(1) == 1) {
+      done_.Set();
+    }
+  }
+}
+
+void NetEqBatchDriver::RunStreams(size_t thread_index) {
+  AudioFrame& frame = *frames_[thread_index];
+  const size_t num_slots = streams_.size();
+  while (true) {
+    const size_t begin =
+        next_stream_.fetch_add(kStreamsPerClaim, std::memory_order_relaxed);
+    if (begin >= num_slots) {
+      return;
+    }
+    const size_t end = std::min(begin + kStreamsPerClaim, num_slots);
+    for (size_t i = begin; i < end; ++i) {
+      Stream& stream = streams_[i];
+      if (!stream.neteq) {
+        continue;
+      }
+      const int64_t start_time_ns =
+          measure_cpu_time_ ? GetThreadCpuTimeNanos() : 0;
+      bool muted = false;
+      const int result = stream.neteq->GetAudio(&frame, &muted);
+      if (measure_cpu_time_) {
+        stream.cpu_time_ns += GetThreadCpuTimeNanos() - start_time_ns;
+      }
+      ++stream.num_ticks;
+      if (result != NetEq::kOK) {
+        ++stream.num_errors;
+        continue;
+      }
+      (*on_audio_)(static_cast<int>(i), frame, muted);
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_NETEQ_BATCH_DRIVER_H_
+#define MODULES_AUDIO_CODING_NETEQ_NETEQ_BATCH_DRIVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/function_view.h"
+#include "api/neteq/neteq.h"
+#include "api/sequence_checker.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/system/no_unique_address.h"
+
+namespace webrtc {
+
+// Pulls audio from many independent NetEq instances once per 10 ms tick,
+// spreading the instances over a pool of threads. The output of each instance
+// is handed to a callback as soon as it is produced, so that one output frame
+// per thread is reused across all instances instead of one per instance.
+//
+// Streams are added, removed and ticked on one sequence. Packets may be
+// inserted into the NetEq instances from any thread.
+class NetEqBatchDriver {
+ public:
+  struct Config {
+    // Number of threads pulling audio, the thread calling Tick() included.
+    int num_threads = 1;
+    // Whether to measure the thread CPU time spent in each instance.
+    bool measure_cpu_time = true;
+  };
+
+  struct StreamStats {
+    int64_t num_ticks = 0;
+    // Number of calls to NetEq::GetAudio() that returned an error.
+    int64_t num_errors = 0;
+    TimeDelta cpu_time = TimeDelta::Zero();
+  };
+
+  // Receives the 10 ms of audio of one stream. `frame` is only valid during
+  // the call, which may happen concurrently with the calls for other streams.
+  using AudioCallback =
+      FunctionView<void(int stream_id, const AudioFrame& frame, bool muted)>;
+
+  explicit NetEqBatchDriver(const Config& config);
+  ~NetEqBatchDriver();
+  NetEqBatchDriver(const NetEqBatchDriver&) = delete;
+  NetEqBatchDriver& operator=(const NetEqBatchDriver&) = delete;
+
+  // Adds `neteq` to the streams pulled from, and returns the id of the stream.
+  // Ids of removed streams are reused.
+  int AddStream(std::unique_ptr<NetEq> neteq);
+  void RemoveStream(int stream_id);
+
+  int num_streams() const;
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Returns the instance of a stream, for inserting packets.
+  NetEq* GetNetEq(int stream_id);
+  StreamStats GetStreamStats(int stream_id) const;
+
+  // Pulls 10 ms of audio from every stream and returns when all have been
+  // handed to `on_audio`. Streams for which NetEq::GetAudio() fails are counted
+  // in their stats and skipped.
+  void Tick(AudioCallback on_audio);
+
+ private:
+  struct Stream {
+    std::unique_ptr<NetEq> neteq;
+    int64_t num_ticks = 0;
+    int64_t num_errors = 0;
+    int64_t cpu_time_ns = 0;
+  };
+  struct Worker {
+    Event start;
+    PlatformThread thread;
+  };
+
+  void RunWorker(size_t worker_index);
+  void RunStreams(size_t thread_index);
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+  const bool measure_cpu_time_;
+  // Slots of the streams, indexed by stream id. Removed streams leave an empty
+  // slot that is reused by the next added stream. Modified on
+  // `sequence_checker_` only, and read by the workers during Tick().
+  std::vector<Stream> streams_;
+  std::vector<int> free_stream_ids_;
+  // One output frame per thread.
+  std::vector<std::unique_ptr<AudioFrame>> frames_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // State of the ongoing tick, set before the workers are started.
+  AudioCallback* on_audio_ = nullptr;
+  std::atomic<size_t> next_stream_{0};
+  std::atomic<size_t> num_pending_workers_{0};
+  bool quit_ = false;
+  Event done_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_NETEQ_BATCH_DRIVER_H_
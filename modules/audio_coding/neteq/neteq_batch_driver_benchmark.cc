@@ -0,0 +1,164 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/L16/audio_decoder_L16.h"
+#include "api/audio_codecs/audio_decoder_factory_template.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/default_neteq_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_coding/neteq/neteq_batch_driver.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kPayloadType = 96;
+constexpr int kSampleRateHz = 16000;
+constexpr size_t kSamplesPerPacket = kSampleRateHz / 50;
+constexpr int kNumPayloads = 50;
+
+std::unique_ptr<NetEq> CreateNetEq(const Environment& env) {
+  std::unique_ptr<NetEq> neteq = DefaultNetEqFactory().Create(
+      env, NetEq::Config(), CreateAudioDecoderFactory<AudioDecoderL16>());
+  RTC_CHECK(neteq->RegisterPayloadType(
+      kPayloadType, SdpAudioFormat("L16", kSampleRateHz, /*num_channels=*/1)));
+  return neteq;
+}
+
+// 20 ms L16 packets of noise for a set of streams, one packet per stream every
+// second 10 ms tick.
+class StreamPackets {
+ public:
+  explicit StreamPackets(size_t num_streams) : headers_(num_streams) {
+    Random random(42);
+    payloads_.resize(kNumPayloads);
+    for (std::vector<uint8_t>& payload : payloads_) {
+      payload.resize(2 * kSamplesPerPacket);
+      for (uint8_t& byte : payload) {
+        byte = random.Rand<uint8_t>();
+      }
+    }
+    for (size_t i = 0; i < num_streams; ++i) {
+      headers_[i].payloadType = kPayloadType;
+      headers_[i].ssrc = i + 1;
+    }
+  }
+
+  // Inserts the packets due at the current tick into the instances, given by
+  // `get_neteq(stream_index)`, and advances to the next tick.
+  template <typename GetNetEq>
+  void InsertAndAdvance(GetNetEq get_neteq) {
+    if (tick_++ % 2 != 0) {
+      return;
+    }
+    for (size_t i = 0; i < headers_.size(); ++i) {
+      RTPHeader& header = headers_[i];
+      get_neteq(i)->InsertPacket(
+          header, payloads_[(header.sequenceNumber + i) % kNumPayloads]);
+      ++header.sequenceNumber;
+      header.timestamp += kSamplesPerPacket;
+    }
+  }
+
+ private:
+  std::vector<RTPHeader> headers_;
+  std::vector<std::vector<uint8_t>> payloads_;
+  int64_t tick_ = 0;
+};
+
+// One 10 ms tick of every stream, pulling each instance into its own output
+// frame on the calling thread.
+void BM_NetEqPerStreamGetAudio(benchmark::State& state) {
+  const size_t num_streams = state.range(0);
+  const Environment env = CreateEnvironment();
+  std::vector<std::unique_ptr<NetEq>> neteqs;
+  std::vector<std::unique_ptr<AudioFrame>> frames;
+  for (size_t i = 0; i < num_streams; ++i) {
+    neteqs.push_back(CreateNetEq(env));
+    frames.push_back(std::make_unique<AudioFrame>());
+  }
+  StreamPackets packets(num_streams);
+  for (auto _ : state) {
+    state.PauseTiming();
+    packets.InsertAndAdvance([&](size_t i) { return neteqs[i].get(); });
+    state.ResumeTiming();
+    for (size_t i = 0; i < num_streams; ++i) {
+      bool muted;
+      neteqs[i]->GetAudio(frames[i].get(), &muted);
+      benchmark::DoNotOptimize(frames[i]->data());
+    }
+  }
+  state.counters["streams"] = benchmark::Counter(
+      num_streams, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// One 10 ms tick of every stream through NetEqBatchDriver.
+void BM_NetEqBatchDriverTick(benchmark::State& state) {
+  const size_t num_streams = state.range(0);
+  const int num_threads = state.range(1);
+  const Environment env = CreateEnvironment();
+  NetEqBatchDriver driver({.num_threads = num_threads});
+  std::vector<int> stream_ids;
+  for (size_t i = 0; i < num_streams; ++i) {
+    stream_ids.push_back(driver.AddStream(CreateNetEq(env)));
+  }
+  StreamPackets packets(num_streams);
+  for (auto _ : state) {
+    state.PauseTiming();
+    packets.InsertAndAdvance(
+        [&](size_t i) { return driver.GetNetEq(stream_ids[i]); });
+    state.ResumeTiming();
+    driver.Tick(
+        [](int /* stream_id */, const AudioFrame& frame, bool /* muted */) {
+          benchmark::DoNotOptimize(frame.data());
+        });
+  }
+  state.counters["streams"] = benchmark::Counter(
+      num_streams, benchmark::Counter::kIsIterationInvariantRate);
+
+  TimeDelta cpu_time = TimeDelta::Zero();
+  int64_t num_ticks = 0;
+  for (int stream_id : stream_ids) {
+    const NetEqBatchDriver::StreamStats stats =
+        driver.GetStreamStats(stream_id);
+    cpu_time += stats.cpu_time;
+    num_ticks += stats.num_ticks;
+  }
+  if (num_ticks > 0) {
+    state.counters["cpu_us_per_stream_tick"] =
+        cpu_time.us<double>() / num_ticks;
+  }
+}
+
+BENCHMARK(BM_NetEqPerStreamGetAudio)
+    ->ArgName("streams")
+    ->Arg(100)
+    ->Arg(1000)
+    ->UseRealTime();
+BENCHMARK(BM_NetEqBatchDriverTick)
+    ->ArgNames({"streams", "threads"})
+    ->ArgsProduct({{100, 1000}, {1, 2, 4, 8}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace webrtc
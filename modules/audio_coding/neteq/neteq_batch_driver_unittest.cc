@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/neteq_batch_driver.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/L16/audio_decoder_L16.h"
+#include "api/audio_codecs/audio_decoder_factory_template.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/default_neteq_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+
+constexpr int kPayloadType = 96;
+constexpr int kSampleRateHz = 16000;
+constexpr size_t kSamplesPerPacket = kSampleRateHz / 50;
+
+std::unique_ptr<NetEq> CreateNetEq(const Environment& env) {
+  std::unique_ptr<NetEq> neteq = DefaultNetEqFactory().Create(
+      env, NetEq::Config(), CreateAudioDecoderFactory<AudioDecoderL16>());
+  EXPECT_TRUE(neteq->RegisterPayloadType(kPayloadType,
+                                         SdpAudioFormat("L16", kSampleRateHz,
+                                                        /*num_channels=*/1)));
+  return neteq;
+}
+
+// Generates a stream of 20 ms L16 packets of noise.
+class PacketGenerator {
+ public:
+  explicit PacketGenerator(int seed) : random_(seed) {
+    header_.payloadType = kPayloadType;
+    header_.ssrc = seed;
+  }
+
+  // Inserts the next packet into both `neteq` and `reference_neteq`.
+  void InsertNextPacket(NetEq& neteq, NetEq& reference_neteq) {
+    std::vector<uint8_t> payload(2 * kSamplesPerPacket);
+    for (uint8_t& byte : payload) {
+      byte = random_.Rand<uint8_t>();
+    }
+    EXPECT_EQ(neteq.InsertPacket(header_, payload), NetEq::kOK);
+    EXPECT_EQ(reference_neteq.InsertPacket(header_, payload), NetEq::kOK);
+    ++header_.sequenceNumber;
+    header_.timestamp += kSamplesPerPacket;
+  }
+
+ private:
+  Random random_;
+  RTPHeader header_;
+};
+
+TEST(NetEqBatchDriverTest, OutputMatchesPullingEachInstance) {
+  constexpr int kNumStreams = 21;
+  SimulatedClock clock(1000000);
+  const Environment env = CreateEnvironment(&clock);
+  NetEqBatchDriver driver({.num_threads = 3});
+  std::vector<std::unique_ptr<NetEq>> reference_neteqs;
+  std::vector<std::unique_ptr<PacketGenerator>> generators;
+  for (int i = 0; i < kNumStreams; ++i) {
+    EXPECT_EQ(driver.AddStream(CreateNetEq(env)), i);
+    reference_neteqs.push_back(CreateNetEq(env));
+    generators.push_back(std::make_unique<PacketGenerator>(/*seed=*/i + 1));
+  }
+  EXPECT_EQ(driver.num_streams(), kNumStreams);
+  EXPECT_EQ(driver.num_threads(), 3);
+
+  std::vector<AudioFrame> frames(kNumStreams);
+  std::vector<int> num_calls(kNumStreams, 0);
+  AudioFrame reference_frame;
+  for (int tick = 0; tick < 200; ++tick) {
+    if (tick % 2 == 0) {
+      for (int i = 0; i < kNumStreams; ++i) {
+        // Drop some packets, for NetEq to expand.
+        if ((tick + i) % 38 != 0) {
+          generators[i]->InsertNextPacket(*driver.GetNetEq(i),
+                                          *reference_neteqs[i]);
+        }
+      }
+    }
+    driver.Tick([&](int stream_id, const AudioFrame& frame, bool /* muted */) {
+      frames[stream_id].CopyFrom(frame);
+      ++num_calls[stream_id];
+    });
+    for (int i = 0; i < kNumStreams; ++i) {
+      ASSERT_EQ(num_calls[i], tick + 1);
+      bool muted;
+      ASSERT_EQ(reference_neteqs[i]->GetAudio(&reference_frame, &muted),
+                NetEq::kOK);
+      ASSERT_EQ(frames[i].samples_per_channel(),
+                reference_frame.samples_per_channel());
+      EXPECT_EQ(frames[i].speech_type_, reference_frame.speech_type_);
+      EXPECT_EQ(frames[i].timestamp_, reference_frame.timestamp_);
+      EXPECT_THAT(MakeArrayView(frames[i].data(),
+                                frames[i].samples_per_channel()),
+                  ElementsAreArray(reference_frame.data(),
+                                   reference_frame.samples_per_channel()));
+    }
+    clock.AdvanceTime(TimeDelta::Millis(10));
+  }
+}
+
+TEST(NetEqBatchDriverTest, ReusesIdsOfRemovedStreams) {
+  const Environment env = CreateEnvironment();
+  NetEqBatchDriver driver({.num_threads = 2});
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(driver.AddStream(CreateNetEq(env)), i);
+  }
+  driver.RemoveStream(1);
+  driver.RemoveStream(2);
+  EXPECT_EQ(driver.num_streams(), 2);
+  EXPECT_EQ(driver.GetNetEq(1), nullptr);
+
+  std::vector<int> num_calls(4, 0);
+  driver.Tick([&](int stream_id, const AudioFrame& /* frame */,
+                  bool /* muted */) { ++num_calls[stream_id]; });
+  EXPECT_THAT(num_calls, ElementsAre(1, 0, 0, 1));
+
+  const int stream_id = driver.AddStream(CreateNetEq(env));
+  EXPECT_TRUE(stream_id == 1 || stream_id == 2);
+  EXPECT_EQ(driver.num_streams(), 3);
+  EXPECT_EQ(driver.GetStreamStats(stream_id).num_ticks, 0);
+}
+
+TEST(NetEqBatchDriverTest, ReportsPerStreamStats) {
+  const Environment env = CreateEnvironment();
+  for (bool measure_cpu_time : {false, true}) {
+    NetEqBatchDriver driver(
+        {.num_threads = 2, .measure_cpu_time = measure_cpu_time});
+    for (int i = 0; i < 20; ++i) {
+      driver.AddStream(CreateNetEq(env));
+    }
+    for (int tick = 0; tick < 100; ++tick) {
+      driver.Tick([](int /* stream_id */, const AudioFrame& /* frame */,
+                     bool /* muted */) {});
+    }
+    for (int i = 0; i < 20; ++i) {
+      const NetEqBatchDriver::StreamStats stats = driver.GetStreamStats(i);
+      EXPECT_EQ(stats.num_ticks, 100);
+      EXPECT_EQ(stats.num_errors, 0);
+      if (measure_cpu_time) {
+        EXPECT_GE(stats.cpu_time, TimeDelta::Zero());
+      } else {
+        EXPECT_EQ(stats.cpu_time, TimeDelta::Zero());
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
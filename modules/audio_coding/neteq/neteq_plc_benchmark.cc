@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/L16/audio_decoder_L16.h"
+#include "api/audio_codecs/audio_decoder_factory_template.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/default_neteq_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kPayloadType = 96;
+constexpr int kPacketDurationMs = 20;
+constexpr int kNumPayloads = 1000 / kPacketDurationMs;
+// Packets are lost in bursts, at the start of every period of this many.
+constexpr int kLossPeriodPackets = 20;
+
+// One second of a voiced, speech-like signal in 20 ms L16 packets, so that the
+// expansion during losses finds a pitch period.
+std::vector<std::vector<uint8_t>> VoicedPayloads(int sample_rate_hz) {
+  constexpr double kPi = 3.14159265358979323846;
+  constexpr double kPitchHz = 150.0;
+  const size_t samples_per_packet = sample_rate_hz * kPacketDurationMs / 1000;
+  std::vector<std::vector<uint8_t>> payloads(kNumPayloads);
+  size_t n = 0;
+  for (std::vector<uint8_t>& payload : payloads) {
+    payload.resize(2 * samples_per_packet);
+    for (size_t i = 0; i < samples_per_packet; ++i, ++n) {
+      const double t = static_cast<double>(n) / sample_rate_hz;
+      double sample = 0.0;
+      for (int harmonic = 1; harmonic <= 4; ++harmonic) {
+        sample += 4000.0 / harmonic *
+                  std::sin(2 * kPi * kPitchHz * harmonic * t);
+      }
+      const int16_t value = static_cast<int16_t>(sample);
+      payload[2 * i] = static_cast<uint16_t>(value) >> 8;
+      payload[2 * i + 1] = static_cast<uint16_t>(value) & 0xFF;
+    }
+  }
+  return payloads;
+}
+
+// CPU usage of GetAudio() for a single stream, losing the given percentage of
+// packets in bursts, which NetEq conceals with expand, merge and
+// preemptive-expand/accelerate operations.
+void BM_NetEqPacketLossConcealment(benchmark::State& state) {
+  const int sample_rate_hz = state.range(0);
+  const int loss_percent = state.range(1);
+  const int burst_packets = kLossPeriodPackets * loss_percent / 100;
+  const uint32_t samples_per_packet =
+      sample_rate_hz * kPacketDurationMs / 1000;
+
+  std::unique_ptr<NetEq> neteq = DefaultNetEqFactory().Create(
+      CreateEnvironment(), NetEq::Config(),
+      CreateAudioDecoderFactory<AudioDecoderL16>());
+  RTC_CHECK(neteq->RegisterPayloadType(
+      kPayloadType, SdpAudioFormat("L16", sample_rate_hz, /*num_channels=*/1)));
+  const std::vector<std::vector<uint8_t>> payloads =
+      VoicedPayloads(sample_rate_hz);
+  RTPHeader header;
+  header.payloadType = kPayloadType;
+  header.ssrc = 4711;
+  AudioFrame frame;
+  int64_t tick = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    if (tick++ % 2 == 0) {
+      if (header.sequenceNumber % kLossPeriodPackets >= burst_packets) {
+        neteq->InsertPacket(header,
+                            payloads[header.sequenceNumber % kNumPayloads]);
+      }
+      ++header.sequenceNumber;
+      header.timestamp += samples_per_packet;
+    }
+    state.ResumeTiming();
+    bool muted;
+    neteq->GetAudio(&frame, &muted);
+    benchmark::DoNotOptimize(frame.data());
+  }
+
+  const NetEqLifetimeStatistics stats = neteq->GetLifetimeStatistics();
+  if (stats.total_samples_received > 0) {
+    state.counters["concealed_fraction"] =
+        static_cast<double>(stats.concealed_samples) /
+        stats.total_samples_received;
+  }
+}
+
+BENCHMARK(BM_NetEqPacketLossConcealment)
+    ->ArgNames({"rate_hz", "loss_percent"})
+    ->ArgsProduct({{16000, 48000}, {0, 10, 30}});
+
+}  // namespace
+}  // namespace webrtc
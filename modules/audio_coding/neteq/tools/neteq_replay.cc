@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/tools/neteq_replay.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "api/array_view.h"
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/audio_decoder_factory.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/default_neteq_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/scoped_refptr.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/audio_coding/neteq/tools/neteq_input.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace test {
+
+double NetEqReplay::Stats::RealtimeFactor() const {
+  return processing_time > TimeDelta::Zero() ? audio_duration / processing_time
+                                             : 0.0;
+}
+
+NetEqReplay::NetEqReplay(const Environment& env,
+                         const Config& config,
+                         scoped_refptr<AudioDecoderFactory> decoder_factory,
+                         std::unique_ptr<NetEqInput> input)
+    : env_(env),
+      block_duration_ms_(config.block_duration_ms),
+      input_(std::move(input)),
+      clock_(Timestamp::Millis(input_->NextEventTime().value_or(0))) {
+  RTC_DCHECK_GE(config.block_duration_ms, 10);
+  EnvironmentFactory neteq_env(env_);
+  neteq_env.Set(&clock_);
+  neteq_ = DefaultNetEqFactory().Create(
+      neteq_env.Create(), config.neteq_config, std::move(decoder_factory));
+  for (const auto& [payload_type, format] : config.codecs) {
+    RTC_CHECK(neteq_->RegisterPayloadType(payload_type, format))
+        << "Cannot register " << format.name << " to payload type "
+        << payload_type;
+  }
+}
+
+NetEqReplay::~NetEqReplay() = default;
+
+bool NetEqReplay::Replay(TimeDelta max_duration, AudioCallback on_audio) {
+  const Timestamp start_time = env_.clock().CurrentTime();
+  TimeDelta duration = TimeDelta::Zero();
+  while (!finished_ && duration < max_duration) {
+    if (!RunToNextOutputEvent()) {
+      finished_ = true;
+      break;
+    }
+    if (neteq_->GetAudio(&frame_) == NetEq::kOK) {
+      duration += TimeDelta::Micros(frame_.samples_per_channel_ * 1'000'000 /
+                                    frame_.sample_rate_hz_);
+      AppendToBlock(on_audio);
+    } else {
+      ++stats_.num_get_audio_errors;
+    }
+
+    // Like NetEqTest, finish once nothing is left to decode.
+    if (input_->ended() ||
+        (!input_->NextPacketTime() &&
+         !neteq_->GetOperationsAndState().next_packet_available)) {
+      finished_ = true;
+    }
+  }
+  FlushBlock(on_audio);
+  stats_.audio_duration += duration;
+  stats_.processing_time += env_.clock().CurrentTime() - start_time;
+  return !finished_;
+}
+
+bool NetEqReplay::RunToNextOutputEvent() {
+  while (!input_->ended()) {
+    const std::optional<int64_t> next_event_time_ms = input_->NextEventTime();
+    RTC_DCHECK(next_event_time_ms);
+    const int64_t time_now_ms = clock_.TimeInMilliseconds();
+    if (*next_event_time_ms > time_now_ms) {
+      clock_.AdvanceTimeMilliseconds(*next_event_time_ms - time_now_ms);
+    }
+
+    if (input_->NextPacketTime() &&
+        *next_event_time_ms >= *input_->NextPacketTime()) {
+      std::unique_ptr<NetEqInput::PacketData> packet = input_->PopPacket();
+      RTC_CHECK(packet);
+      ++stats_.num_packets;
+      if (packet->payload.size() > packet->header.paddingLength) {
+        if (neteq_->InsertPacket(packet->header, packet->payload,
+                                 clock_.CurrentTime()) != NetEq::kOK) {
+          ++stats_.num_insert_packet_errors;
+        }
+      } else {
+        neteq_->InsertEmptyPacket(packet->header);
+      }
+    }
+
+    const std::optional<NetEqInput::SetMinimumDelayInfo> min_delay =
+        input_->NextSetMinimumDelayInfo();
+    if (min_delay && *next_event_time_ms >= min_delay->timestamp_ms) {
+      neteq_->SetBaseMinimumDelayMs(min_delay->delay_ms);
+      input_->AdvanceSetMinimumDelay();
+    }
+
+    if (input_->NextOutputEventTime() &&
+        *next_event_time_ms >= *input_->NextOutputEventTime()) {
+      input_->AdvanceOutputEvent();
+      return true;
+    }
+  }
+  return false;
+}
+
+void NetEqReplay::AppendToBlock(AudioCallback on_audio) {
+  if (frame_.sample_rate_hz_ != block_sample_rate_hz_ ||
+      frame_.num_channels_ != block_num_channels_) {
+    FlushBlock(on_audio);
+    block_sample_rate_hz_ = frame_.sample_rate_hz_;
+    block_num_channels_ = frame_.num_channels_;
+    block_size_ = block_duration_ms_ * block_sample_rate_hz_ / 1000 *
+                  block_num_channels_;
+    block_.reserve(block_size_);
+  }
+  const int16_t* data = frame_.data();
+  block_.insert(block_.end(), data,
+                data + frame_.samples_per_channel_ * frame_.num_channels_);
+  if (block_.size() >= block_size_) {
+    FlushBlock(on_audio);
+  }
+}
+
+void NetEqReplay::FlushBlock(AudioCallback on_audio) {
+  if (block_.empty()) {
+    return;
+  }
+  on_audio(block_, block_sample_rate_hz_, block_num_channels_);
+  block_.clear();
+}
+
+}  // namespace test
+}  // namespace webrtc
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_REPLAY_H_
+#define MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_REPLAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/audio_decoder_factory.h"
+#include "api/environment/environment.h"
+#include "api/function_view.h"
+#include "api/neteq/neteq.h"
+#include "api/scoped_refptr.h"
+#include "api/units/time_delta.h"
+#include "modules/audio_coding/neteq/tools/neteq_input.h"
+#include "modules/audio_coding/neteq/tools/neteq_test.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace test {
+
+// Replays recorded packets, e.g. from an RTP dump or an RTC event log, through
+// NetEq as fast as possible, and streams out the decoded audio. The packets are
+// inserted at their recorded arrival times on a simulated clock, and NetEq's
+// TickTimer advances with each GetAudio() call, so that the jitter buffer makes
+// the same decisions as in a real-time playout.
+//
+// Unlike NetEqTest, no per-frame state or statistics are collected, and the
+// output is delivered in blocks of several 10 ms frames.
+class NetEqReplay {
+ public:
+  struct Config {
+    NetEq::Config neteq_config;
+    NetEqTest::DecoderMap codecs = NetEqTest::StandardDecoderMap();
+    // Duration of the audio delivered per callback. Blocks are cut short when
+    // the output format changes and when Replay() returns.
+    int block_duration_ms = 100;
+  };
+
+  struct Stats {
+    // Replay speed, in seconds of audio per second of processing time.
+    double RealtimeFactor() const;
+
+    TimeDelta audio_duration = TimeDelta::Zero();
+    TimeDelta processing_time = TimeDelta::Zero();
+    int64_t num_packets = 0;
+    int64_t num_insert_packet_errors = 0;
+    int64_t num_get_audio_errors = 0;
+  };
+
+  // Receives a block of interleaved output audio.
+  using AudioCallback = FunctionView<void(ArrayView<const int16_t> audio,
+                                          int sample_rate_hz,
+                                          size_t num_channels)>;
+
+  // The field trials of `env` are used by NetEq, and its clock measures the
+  // processing time.
+  NetEqReplay(const Environment& env,
+              const Config& config,
+              scoped_refptr<AudioDecoderFactory> decoder_factory,
+              std::unique_ptr<NetEqInput> input);
+  ~NetEqReplay();
+  NetEqReplay(const NetEqReplay&) = delete;
+  NetEqReplay& operator=(const NetEqReplay&) = delete;
+
+  // Replays until `max_duration` of audio has been produced or the input is
+  // exhausted, and delivers all of the produced audio to `on_audio` before
+  // returning. May be called repeatedly to stream the output in chunks.
+  // Returns false once the replay has finished.
+  bool Replay(TimeDelta max_duration, AudioCallback on_audio);
+
+  bool finished() const { return finished_; }
+  const Stats& stats() const { return stats_; }
+  NetEq* neteq() { return neteq_.get(); }
+
+ private:
+  // Inserts the packets due until the next output event. Returns false if the
+  // input has ended instead.
+  bool RunToNextOutputEvent();
+  void AppendToBlock(AudioCallback on_audio);
+  void FlushBlock(AudioCallback on_audio);
+
+  const Environment env_;
+  const size_t block_duration_ms_;
+  std::unique_ptr<NetEqInput> input_;
+  SimulatedClock clock_;
+  std::unique_ptr<NetEq> neteq_;
+  AudioFrame frame_;
+  // Output audio not yet delivered, holding up to `block_size_` samples.
+  std::vector<int16_t> block_;
+  size_t block_size_ = 0;
+  int block_sample_rate_hz_ = 0;
+  size_t block_num_channels_ = 0;
+  bool finished_ = false;
+  Stats stats_;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_REPLAY_H_
@@ -0,0 +1,188 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio_codecs/L16/audio_decoder_L16.h"
+#include "api/audio_codecs/audio_decoder_factory_template.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_coding/neteq/tools/audio_sink.h"
+#include "modules/audio_coding/neteq/tools/neteq_input.h"
+#include "modules/audio_coding/neteq/tools/neteq_replay.h"
+#include "modules/audio_coding/neteq/tools/neteq_test.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+constexpr int kPayloadType = 94;
+constexpr int kSampleRateHz = 16000;
+constexpr int kPacketDurationMs = 20;
+constexpr int kRecordingDurationMs = 60'000;
+
+struct RecordedPacket {
+  int64_t arrival_time_ms;
+  RTPHeader header;
+  std::vector<uint8_t> payload;
+};
+
+// 20 ms L16 packets of noise, arriving with up to 100 ms of jitter and 2%
+// loss.
+std::vector<RecordedPacket> RecordPackets() {
+  Random random(42);
+  std::vector<RecordedPacket> packets;
+  int64_t arrival_time_ms = 0;
+  for (int i = 0; i < kRecordingDurationMs / kPacketDurationMs; ++i) {
+    if (random.Rand(0, 99) < 2) {
+      continue;
+    }
+    RecordedPacket packet;
+    arrival_time_ms = std::max<int64_t>(
+        arrival_time_ms, i * kPacketDurationMs + random.Rand(0, 100));
+    packet.arrival_time_ms = arrival_time_ms;
+    packet.header.payloadType = kPayloadType;
+    packet.header.sequenceNumber = i;
+    packet.header.timestamp = i * kPacketDurationMs * kSampleRateHz / 1000;
+    packet.header.ssrc = 4711;
+    packet.payload.resize(2 * kPacketDurationMs * kSampleRateHz / 1000);
+    for (uint8_t& byte : packet.payload) {
+      byte = random.Rand<uint8_t>();
+    }
+    packets.push_back(std::move(packet));
+  }
+  return packets;
+}
+
+// Plays back recorded packets, with an output event every 10 ms.
+class RecordedInput : public NetEqInput {
+ public:
+  explicit RecordedInput(const std::vector<RecordedPacket>& packets)
+      : packets_(packets) {}
+
+  std::optional<int64_t> NextPacketTime() const override {
+    if (next_packet_ == packets_.size()) {
+      return std::nullopt;
+    }
+    return packets_[next_packet_].arrival_time_ms;
+  }
+  std::optional<int64_t> NextOutputEventTime() const override {
+    if (ended()) {
+      return std::nullopt;
+    }
+    return next_output_event_ms_;
+  }
+  std::optional<SetMinimumDelayInfo> NextSetMinimumDelayInfo() const override {
+    return std::nullopt;
+  }
+  std::unique_ptr<PacketData> PopPacket() override {
+    if (next_packet_ == packets_.size()) {
+      return nullptr;
+    }
+    const RecordedPacket& packet = packets_[next_packet_++];
+    auto packet_data = std::make_unique<PacketData>();
+    packet_data->header = packet.header;
+    packet_data->payload.SetData(packet.payload);
+    packet_data->time_ms = packet.arrival_time_ms;
+    return packet_data;
+  }
+  void AdvanceOutputEvent() override { next_output_event_ms_ += 10; }
+  void AdvanceSetMinimumDelay() override {}
+  bool ended() const override {
+    return next_output_event_ms_ > kRecordingDurationMs + 1000;
+  }
+  std::optional<RTPHeader> NextHeader() const override {
+    if (next_packet_ == packets_.size()) {
+      return std::nullopt;
+    }
+    return packets_[next_packet_].header;
+  }
+
+ private:
+  const std::vector<RecordedPacket>& packets_;
+  size_t next_packet_ = 0;
+  int64_t next_output_event_ms_ = 0;
+};
+
+const std::vector<RecordedPacket>& GetRecordedPackets() {
+  static const std::vector<RecordedPacket>* const packets =
+      new std::vector<RecordedPacket>(RecordPackets());
+  return *packets;
+}
+
+NetEqTest::DecoderMap DecoderMap() {
+  return {{kPayloadType, SdpAudioFormat("l16", kSampleRateHz, 1)}};
+}
+
+// Replays the recording through NetEqTest, the loop behind neteq_rtpplay.
+void BM_NetEqTestRun(benchmark::State& state) {
+  int64_t audio_duration_ms = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    NetEqTest neteq_test(NetEq::Config(),
+                         CreateAudioDecoderFactory<AudioDecoderL16>(),
+                         DecoderMap(), /*text_log=*/nullptr,
+                         /*neteq_factory=*/nullptr,
+                         std::make_unique<RecordedInput>(GetRecordedPackets()),
+                         std::make_unique<VoidAudioSink>(), /*callbacks=*/{});
+    state.ResumeTiming();
+    audio_duration_ms += neteq_test.Run();
+  }
+  state.counters["x_realtime"] = benchmark::Counter(
+      audio_duration_ms / 1000.0, benchmark::Counter::kIsRate);
+}
+
+void BM_NetEqReplay(benchmark::State& state) {
+  NetEqReplay::Config config;
+  config.codecs = DecoderMap();
+  config.block_duration_ms = state.range(0);
+  TimeDelta audio_duration = TimeDelta::Zero();
+  for (auto _ : state) {
+    state.PauseTiming();
+    NetEqReplay replay(CreateEnvironment(), config,
+                       CreateAudioDecoderFactory<AudioDecoderL16>(),
+                       std::make_unique<RecordedInput>(GetRecordedPackets()));
+    state.ResumeTiming();
+    replay.Replay(TimeDelta::PlusInfinity(),
+                  [](ArrayView<const int16_t> audio, int /* sample_rate_hz */,
+                     size_t /* num_channels */) {
+                    benchmark::DoNotOptimize(audio.data());
+                  });
+    audio_duration += replay.stats().audio_duration;
+  }
+  state.counters["x_realtime"] = benchmark::Counter(
+      audio_duration.seconds<double>(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_NetEqTestRun)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_NetEqReplay)
+    ->ArgName("block_ms")
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
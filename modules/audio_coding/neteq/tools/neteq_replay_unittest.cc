@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/tools/neteq_replay.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio_codecs/L16/audio_decoder_L16.h"
+#include "api/audio_codecs/audio_decoder_factory_template.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "api/units/time_delta.h"
+#include "modules/audio_coding/codecs/pcm16b/audio_encoder_pcm16b.h"
+#include "modules/audio_coding/neteq/tools/audio_sink.h"
+#include "modules/audio_coding/neteq/tools/encode_neteq_input.h"
+#include "modules/audio_coding/neteq/tools/neteq_input.h"
+#include "modules/audio_coding/neteq/tools/neteq_test.h"
+#include "rtc_base/random.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+using ::testing::Each;
+using ::testing::ElementsAreArray;
+using ::testing::Le;
+
+constexpr int kPayloadType = 94;
+constexpr int kSampleRateHz = 16000;
+constexpr int kInputDurationMs = 5000;
+
+class NoiseGenerator : public EncodeNetEqInput::Generator {
+ public:
+  ArrayView<const int16_t> Generate(size_t num_samples) override {
+    samples_.resize(num_samples);
+    for (int16_t& sample : samples_) {
+      sample = random_.Rand(-10000, 10000);
+    }
+    return samples_;
+  }
+
+ private:
+  Random random_{42};
+  std::vector<int16_t> samples_;
+};
+
+// Delays the arrival of the packets of another input by a varying amount,
+// keeping the arrival times in order.
+class JitteryInput : public NetEqInput {
+ public:
+  explicit JitteryInput(std::unique_ptr<NetEqInput> input)
+      : input_(std::move(input)) {}
+
+  std::optional<int64_t> NextPacketTime() const override {
+    const std::optional<int64_t> send_time_ms = input_->NextPacketTime();
+    if (!send_time_ms) {
+      return std::nullopt;
+    }
+    return std::max(last_arrival_time_ms_,
+                    *send_time_ms + (num_packets_ % 7) * 25);
+  }
+  std::optional<int64_t> NextOutputEventTime() const override {
+    return input_->NextOutputEventTime();
+  }
+  std::optional<SetMinimumDelayInfo> NextSetMinimumDelayInfo() const override {
+    return input_->NextSetMinimumDelayInfo();
+  }
+  std::unique_ptr<PacketData> PopPacket() override {
+    last_arrival_time_ms_ = NextPacketTime().value_or(last_arrival_time_ms_);
+    ++num_packets_;
+    return input_->PopPacket();
+  }
+  void AdvanceOutputEvent() override { input_->AdvanceOutputEvent(); }
+  void AdvanceSetMinimumDelay() override { input_->AdvanceSetMinimumDelay(); }
+  bool ended() const override { return input_->ended(); }
+  std::optional<RTPHeader> NextHeader() const override {
+    return input_->NextHeader();
+  }
+
+ private:
+  const std::unique_ptr<NetEqInput> input_;
+  int64_t last_arrival_time_ms_ = 0;
+  int num_packets_ = 0;
+};
+
+class VectorAudioSink : public AudioSink {
+ public:
+  explicit VectorAudioSink(std::vector<int16_t>& samples)
+      : samples_(samples) {}
+
+  bool WriteArray(const int16_t* audio, size_t num_samples) override {
+    samples_.insert(samples_.end(), audio, audio + num_samples);
+    return true;
+  }
+
+ private:
+  std::vector<int16_t>& samples_;
+};
+
+std::unique_ptr<NetEqInput> CreateInput() {
+  AudioEncoderPcm16B::Config encoder_config;
+  encoder_config.sample_rate_hz = kSampleRateHz;
+  encoder_config.payload_type = kPayloadType;
+  encoder_config.frame_size_ms = 20;
+  return std::make_unique<JitteryInput>(std::make_unique<EncodeNetEqInput>(
+      std::make_unique<NoiseGenerator>(),
+      std::make_unique<AudioEncoderPcm16B>(encoder_config), kInputDurationMs));
+}
+
+NetEqReplay::Config CreateConfig() {
+  return {.codecs = {{kPayloadType, SdpAudioFormat("l16", kSampleRateHz, 1)}}};
+}
+
+TEST(NetEqReplayTest, OutputMatchesNetEqTest) {
+  const NetEqReplay::Config config = CreateConfig();
+  std::vector<int16_t> reference_output;
+  NetEqTest neteq_test(config.neteq_config,
+                       CreateAudioDecoderFactory<AudioDecoderL16>(),
+                       config.codecs, /*text_log=*/nullptr,
+                       /*neteq_factory=*/nullptr, CreateInput(),
+                       std::make_unique<VectorAudioSink>(reference_output),
+                       /*callbacks=*/{});
+  neteq_test.Run();
+
+  NetEqReplay replay(CreateEnvironment(), config,
+                     CreateAudioDecoderFactory<AudioDecoderL16>(),
+                     CreateInput());
+  std::vector<int16_t> output;
+  EXPECT_FALSE(replay.Replay(
+      TimeDelta::PlusInfinity(),
+      [&](ArrayView<const int16_t> audio, int /* sample_rate_hz */,
+          size_t num_channels) {
+        EXPECT_EQ(num_channels, 1u);
+        output.insert(output.end(), audio.begin(), audio.end());
+      }));
+  EXPECT_TRUE(replay.finished());
+  EXPECT_THAT(output, ElementsAreArray(reference_output));
+  EXPECT_EQ(replay.neteq()->GetLifetimeStatistics().concealment_events,
+            neteq_test.LifetimeStats().concealment_events);
+  EXPECT_GT(replay.neteq()->GetLifetimeStatistics().jitter_buffer_delay_ms,
+            0u);
+}
+
+TEST(NetEqReplayTest, StreamsOutputInBlocks) {
+  NetEqReplay::Config config = CreateConfig();
+  config.block_duration_ms = 50;
+  NetEqReplay replay(CreateEnvironment(), config,
+                     CreateAudioDecoderFactory<AudioDecoderL16>(),
+                     CreateInput());
+  std::vector<TimeDelta> block_durations;
+  auto on_audio = [&](ArrayView<const int16_t> audio, int sample_rate_hz,
+                      size_t num_channels) {
+    block_durations.push_back(TimeDelta::Micros(
+        audio.size() / num_channels * 1'000'000 / sample_rate_hz));
+  };
+
+  int num_chunks = 0;
+  while (replay.Replay(TimeDelta::Seconds(1), on_audio)) {
+    ++num_chunks;
+    EXPECT_EQ(replay.stats().audio_duration, TimeDelta::Seconds(num_chunks));
+  }
+  EXPECT_GE(num_chunks, kInputDurationMs / 1000 - 1);
+  EXPECT_THAT(block_durations, Each(Le(TimeDelta::Millis(50))));
+
+  TimeDelta total_duration = TimeDelta::Zero();
+  for (TimeDelta duration : block_durations) {
+    total_duration += duration;
+  }
+  const NetEqReplay::Stats& stats = replay.stats();
+  EXPECT_EQ(total_duration, stats.audio_duration);
+  EXPECT_GE(stats.audio_duration, TimeDelta::Millis(kInputDurationMs));
+  // The input ends before the last, delayed, packets arrive.
+  EXPECT_GT(stats.num_packets, 0);
+  EXPECT_LE(stats.num_packets, kInputDurationMs / 20);
+  EXPECT_EQ(stats.num_insert_packet_errors, 0);
+  EXPECT_EQ(stats.num_get_audio_errors, 0);
+
+  // Once finished, nothing more is produced.
+  EXPECT_FALSE(replay.Replay(TimeDelta::Seconds(1), on_audio));
+  EXPECT_EQ(replay.stats().audio_duration, stats.audio_duration);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
@@ -14,9 +14,11 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
+#include "api/rtp_headers.h"
 #include "modules/audio_mixer/audio_frame_manipulator.h"
 #include "modules/audio_mixer/default_output_rate_calculator.h"
 #include "rtc_base/checks.h"
@@ -32,10 +34,19 @@ struct AudioMixerImpl::SourceStatus {
 
   // A frame that will be passed to audio_source->GetAudioFrameWithInfo.
   AudioFrame audio_frame;
+
+  // Whether the source is pulled for the next mix. Always true unless the
+  // number of mixed sources is limited.
+  bool is_selected = true;
+  // Loudness used to rank the source, including the hysteresis.
+  int selection_score = 0;
 };
 
 namespace {
 
+// The audio level in -dBov that represents digital silence, see RFC 6464.
+constexpr int kDigitalSilenceLevel = 127;
+
 std::vector<std::unique_ptr<AudioMixerImpl::SourceStatus>>::const_iterator
 FindSourceInList(
     AudioMixerImpl::Source const* audio_source,
@@ -53,16 +64,20 @@ struct AudioMixerImpl::HelperContainers {
   void resize(size_t size) {
     audio_to_mix.resize(size);
     preferred_rates.resize(size);
+    selection_candidates.reserve(size);
   }
 
   std::vector<AudioFrame*> audio_to_mix;
   std::vector<int> preferred_rates;
+  std::vector<SourceStatus*> selection_candidates;
 };
 
 AudioMixerImpl::AudioMixerImpl(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-    bool use_limiter)
+    bool use_limiter,
+    size_t max_mixed_sources)
     : output_rate_calculator_(std::move(output_rate_calculator)),
+      max_mixed_sources_(max_mixed_sources),
       audio_source_list_(),
       helper_containers_(std::make_unique<HelperContainers>()),
       frame_combiner_(use_limiter) {}
@@ -82,6 +97,14 @@ scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
                                           use_limiter);
 }
 
+scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter,
+    size_t max_mixed_sources) {
+  return make_ref_counted<AudioMixerImpl>(std::move(output_rate_calculator),
+                                          use_limiter, max_mixed_sources);
+}
+
 void AudioMixerImpl::Mix(size_t number_of_channels,
                          AudioFrame* audio_frame_for_mixing) {
   TRACE_EVENT0("webrtc", "AudioMixerImpl::Mix");
@@ -127,8 +150,15 @@ void AudioMixerImpl::RemoveSource(Source* audio_source) {
 
 ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromSources(
     int output_frequency) {
+  if (max_mixed_sources_ != kUnlimitedMixedSources) {
+    SelectLoudestSources();
+  }
   int audio_to_mix_count = 0;
   for (auto& source_and_status : audio_source_list_) {
+    if (!source_and_status->is_selected) {
+      source_and_status->audio_source->SkipAudioFrame(output_frequency);
+      continue;
+    }
     const auto audio_frame_info =
         source_and_status->audio_source->GetAudioFrameWithInfo(
             output_frequency, &source_and_status->audio_frame);
@@ -148,6 +178,39 @@ ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromSources(
                                       audio_to_mix_count);
 }
 
+void AudioMixerImpl::SelectLoudestSources() {
+  std::vector<SourceStatus*>& candidates =
+      helper_containers_->selection_candidates;
+  candidates.clear();
+  for (auto& source_and_status : audio_source_list_) {
+    const std::optional<AudioLevel> level =
+        source_and_status->audio_source->LastReceivedAudioLevel();
+    // The level is in -dBov, i.e. lower is louder. A source that never
+    // signaled a level can't be ranked without decoding it, so it competes
+    // for a slot as if it were at full scale.
+    const int level_dbov = level ? level->level() : 0;
+    int score = kDigitalSilenceLevel - level_dbov;
+    if (source_and_status->is_selected) {
+      score += kSelectionHysteresisDb;
+    }
+    source_and_status->selection_score = score;
+    source_and_status->is_selected = false;
+    if (level_dbov < kDigitalSilenceLevel) {
+      candidates.push_back(source_and_status.get());
+    }
+  }
+
+  const size_t num_selected = std::min(candidates.size(), max_mixed_sources_);
+  std::partial_sort(candidates.begin(), candidates.begin() + num_selected,
+                    candidates.end(),
+                    [](const SourceStatus* a, const SourceStatus* b) {
+                      return a->selection_score > b->selection_score;
+                    });
+  for (size_t i = 0; i < num_selected; ++i) {
+    candidates[i]->is_selected = true;
+  }
+}
+
 void AudioMixerImpl::UpdateSourceCountStats() {
   size_t current_source_count = audio_source_list_.size();
   // Log to the histogram whenever the maximum number of sources increases.
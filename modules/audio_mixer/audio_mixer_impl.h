@@ -41,6 +41,20 @@ class AudioMixerImpl : public AudioMixer {
       std::unique_ptr<OutputRateCalculator> output_rate_calculator,
       bool use_limiter);
 
+  // Mixes at most `max_mixed_sources` of the sources that signal an audio
+  // level, chosen by their LastReceivedAudioLevel() before pulling any audio.
+  // A mixed source stays mixed until another is kSelectionHysteresisDb
+  // louder. The sources that aren't mixed are called with SkipAudioFrame().
+  // Sources that don't signal an audio level are ranked as if at full scale,
+  // but still count against `max_mixed_sources`.
+  static scoped_refptr<AudioMixerImpl> Create(
+      std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+      bool use_limiter,
+      size_t max_mixed_sources);
+
+  static constexpr size_t kUnlimitedMixedSources = 0;
+  static constexpr int kSelectionHysteresisDb = 6;
+
   ~AudioMixerImpl() override;
 
   AudioMixerImpl(const AudioMixerImpl&) = delete;
@@ -56,7 +70,8 @@ class AudioMixerImpl : public AudioMixer {
 
  protected:
   AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-                 bool use_limiter);
+                 bool use_limiter,
+                 size_t max_mixed_sources = kUnlimitedMixedSources);
 
  private:
   struct HelperContainers;
@@ -67,6 +82,9 @@ class AudioMixerImpl : public AudioMixer {
   ArrayView<AudioFrame* const> GetAudioFromSources(int output_frequency)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Marks the loudest sources to be pulled by GetAudioFromSources().
+  void SelectLoudestSources() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // The critical section lock guards audio source insertion and
   // removal, which can be done from any thread. The race checker
   // checks that mixing is done sequentially.
@@ -74,6 +92,8 @@ class AudioMixerImpl : public AudioMixer {
 
   std::unique_ptr<OutputRateCalculator> output_rate_calculator_;
 
+  const size_t max_mixed_sources_;
+
   // List of all audio sources.
   std::vector<std::unique_ptr<SourceStatus>> audio_source_list_
       RTC_GUARDED_BY(mutex_);
@@ -0,0 +1,102 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/rtp_headers.h"
+#include "api/scoped_refptr.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_mixer/audio_mixer_impl.h"
+#include "modules/audio_mixer/default_output_rate_calculator.h"
+#include "modules/audio_mixer/sine_wave_generator.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr int kNumSources = 100;
+constexpr int kNumSpeakers = 3;
+
+// Stands in for a receive stream, where producing audio means decoding it,
+// here approximated by synthesizing a sine wave. Skipped audio costs nothing.
+class SignaledLevelSource : public AudioMixer::Source {
+ public:
+  SignaledLevelSource(float frequency_hz, int16_t amplitude, int level)
+      : generator_(frequency_hz, amplitude), level_(level) {}
+
+  AudioFrameInfo GetAudioFrameWithInfo(int sample_rate_hz,
+                                       AudioFrame* audio_frame) override {
+    audio_frame->sample_rate_hz_ = sample_rate_hz;
+    audio_frame->samples_per_channel_ = sample_rate_hz / 100;
+    audio_frame->num_channels_ = 1;
+    generator_.GenerateNextFrame(audio_frame);
+    return AudioFrameInfo::kNormal;
+  }
+  int Ssrc() const override { return 0; }
+  int PreferredSampleRate() const override { return kSampleRateHz; }
+  std::optional<AudioLevel> LastReceivedAudioLevel() const override {
+    return AudioLevel(/*voice_activity=*/level_ < 60, level_);
+  }
+  void SkipAudioFrame(int /* sample_rate_hz */) override {}
+
+ private:
+  SineWaveGenerator generator_;
+  const int level_;
+};
+
+// A few speakers among many quiet or muted participants.
+std::vector<std::unique_ptr<SignaledLevelSource>> CreateSources() {
+  std::vector<std::unique_ptr<SignaledLevelSource>> sources;
+  for (int i = 0; i < kNumSources; ++i) {
+    const bool is_speaker = i < kNumSpeakers;
+    sources.push_back(std::make_unique<SignaledLevelSource>(
+        100 + 10 * i, is_speaker ? 5000 : 30,
+        is_speaker ? 20 + i : 70 + i % 58));
+  }
+  return sources;
+}
+
+void BM_MixAllSources(benchmark::State& state) {
+  std::vector<std::unique_ptr<SignaledLevelSource>> sources = CreateSources();
+  scoped_refptr<AudioMixerImpl> mixer = AudioMixerImpl::Create();
+  for (const auto& source : sources) {
+    mixer->AddSource(source.get());
+  }
+  AudioFrame mix;
+  for (auto _ : state) {
+    mixer->Mix(1, &mix);
+    benchmark::DoNotOptimize(mix.data());
+  }
+}
+
+void BM_MixLoudestSources(benchmark::State& state) {
+  std::vector<std::unique_ptr<SignaledLevelSource>> sources = CreateSources();
+  scoped_refptr<AudioMixerImpl> mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/true,
+      /*max_mixed_sources=*/kNumSpeakers);
+  for (const auto& source : sources) {
+    mixer->AddSource(source.get());
+  }
+  AudioFrame mix;
+  for (auto _ : state) {
+    mixer->Mix(1, &mix);
+    benchmark::DoNotOptimize(mix.data());
+  }
+}
+
+BENCHMARK(BM_MixAllSources);
+BENCHMARK(BM_MixLoudestSources);
+
+}  // namespace
+}  // namespace webrtc
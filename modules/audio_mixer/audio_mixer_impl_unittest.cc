@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "api/audio/audio_mixer.h"
+#include "api/rtp_headers.h"
 #include "api/rtp_packet_info.h"
 #include "api/rtp_packet_infos.h"
 #include "api/units/timestamp.h"
@@ -90,6 +91,11 @@ class MockMixerAudioSource : public ::testing::NiceMock<AudioMixer::Source> {
 
   MOCK_METHOD(int, PreferredSampleRate, (), (const, override));
   MOCK_METHOD(int, Ssrc, (), (const, override));
+  MOCK_METHOD(std::optional<AudioLevel>,
+              LastReceivedAudioLevel,
+              (),
+              (const, override));
+  MOCK_METHOD(void, SkipAudioFrame, (int sample_rate_hz), (override));
 
   AudioFrame* fake_frame() { return &fake_frame_; }
   AudioFrameInfo fake_info() { return fake_audio_frame_info_; }
@@ -478,6 +484,102 @@ TEST(AudioMixer, ShouldIncludeRtpPacketInfoFromAllMixedSources) {
   EXPECT_THAT(frame_for_mixing.packet_infos_, UnorderedElementsAre(p0, p1, p2));
 }
 
+TEST(AudioMixer, PullsOnlyLoudestSourcesWhenLimited) {
+  constexpr size_t kMaxMixedSources = 2;
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), true, kMaxMixedSources);
+  MockMixerAudioSource sources[4];
+  // Levels in -dBov, i.e. the last two sources are the loudest.
+  const int kLevels[] = {40, 50, 20, 10};
+  for (int i = 0; i < 4; ++i) {
+    ResetFrame(sources[i].fake_frame());
+    ON_CALL(sources[i], LastReceivedAudioLevel())
+        .WillByDefault(Return(AudioLevel(true, kLevels[i])));
+    mixer->AddSource(&sources[i]);
+  }
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_CALL(sources[i], GetAudioFrameWithInfo).Times(0);
+    EXPECT_CALL(sources[i], SkipAudioFrame(kDefaultSampleRateHz));
+  }
+  for (int i = 2; i < 4; ++i) {
+    EXPECT_CALL(sources[i], GetAudioFrameWithInfo);
+    EXPECT_CALL(sources[i], SkipAudioFrame).Times(0);
+  }
+  mixer->Mix(1, &frame_for_mixing);
+}
+
+TEST(AudioMixer, LoudestSourceSelectionHasHysteresis) {
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), true,
+      /*max_mixed_sources=*/1);
+  MockMixerAudioSource mixed;
+  MockMixerAudioSource other;
+  ResetFrame(mixed.fake_frame());
+  ResetFrame(other.fake_frame());
+  mixer->AddSource(&mixed);
+  mixer->AddSource(&other);
+
+  constexpr int kMixedLevel = 30;
+  constexpr int kHysteresis = AudioMixerImpl::kSelectionHysteresisDb;
+  EXPECT_CALL(mixed, LastReceivedAudioLevel())
+      .WillRepeatedly(Return(AudioLevel(true, kMixedLevel)));
+  EXPECT_CALL(other, LastReceivedAudioLevel())
+      .WillOnce(Return(AudioLevel(true, kMixedLevel + 5)))
+      // Louder, but not by more than the hysteresis.
+      .WillOnce(Return(AudioLevel(true, kMixedLevel + 1 - kHysteresis)))
+      .WillOnce(Return(AudioLevel(true, kMixedLevel - 1 - kHysteresis)));
+  EXPECT_CALL(mixed, GetAudioFrameWithInfo).Times(2);
+  EXPECT_CALL(mixed, SkipAudioFrame).Times(1);
+  EXPECT_CALL(other, GetAudioFrameWithInfo).Times(1);
+  EXPECT_CALL(other, SkipAudioFrame).Times(2);
+  for (int i = 0; i < 3; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+}
+
+TEST(AudioMixer, LimitedMixingRanksSourcesWithoutAudioLevelAsLoud) {
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), true,
+      /*max_mixed_sources=*/1);
+  MockMixerAudioSource without_level;
+  MockMixerAudioSource silent;
+  MockMixerAudioSource loud;
+  for (MockMixerAudioSource* source : {&without_level, &silent, &loud}) {
+    ResetFrame(source->fake_frame());
+    mixer->AddSource(source);
+  }
+  ON_CALL(silent, LastReceivedAudioLevel())
+      .WillByDefault(Return(AudioLevel(false, 127)));
+  ON_CALL(loud, LastReceivedAudioLevel())
+      .WillByDefault(Return(AudioLevel(true, 10)));
+
+  EXPECT_CALL(without_level, GetAudioFrameWithInfo);
+  EXPECT_CALL(loud, GetAudioFrameWithInfo).Times(0);
+  EXPECT_CALL(loud, SkipAudioFrame);
+  EXPECT_CALL(silent, GetAudioFrameWithInfo).Times(0);
+  EXPECT_CALL(silent, SkipAudioFrame);
+  mixer->Mix(1, &frame_for_mixing);
+}
+
+TEST(AudioMixer, LimitedMixingCapsSourcesWithoutAudioLevel) {
+  constexpr size_t kMaxMixedSources = 2;
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), true, kMaxMixedSources);
+  MockMixerAudioSource sources[4];
+  for (MockMixerAudioSource& source : sources) {
+    ResetFrame(source.fake_frame());
+    mixer->AddSource(&source);
+  }
+
+  int skipped = 0;
+  for (MockMixerAudioSource& source : sources) {
+    ON_CALL(source, SkipAudioFrame).WillByDefault([&](int) { ++skipped; });
+  }
+  mixer->Mix(1, &frame_for_mixing);
+  EXPECT_EQ(skipped, 4 - static_cast<int>(kMaxMixedSources));
+}
+
 class HighOutputRateCalculator : public OutputRateCalculator {
  public:
   static const int kDefaultFrequency = 76000;
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_mixer/conference_mixer.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/audio/audio_view.h"
+#include "modules/audio_mixer/audio_frame_manipulator.h"
+#include "modules/audio_mixer/default_output_rate_calculator.h"
+#include "modules/audio_mixer/frame_combiner.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/system/arch.h"
+#include "rtc_base/trace_event.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace webrtc {
+namespace {
+
+// Computes y += x.
+void Accumulate(ArrayView<const float> x, ArrayView<float> y) {
+  RTC_DCHECK_EQ(x.size(), y.size());
+  const size_t size = x.size();
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; i + 4 <= size; i += 4) {
+    _mm_storeu_ps(&y[i],
+                  _mm_add_ps(_mm_loadu_ps(&y[i]), _mm_loadu_ps(&x[i])));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; i + 4 <= size; i += 4) {
+    vst1q_f32(&y[i], vaddq_f32(vld1q_f32(&y[i]), vld1q_f32(&x[i])));
+  }
+#endif
+  for (; i < size; ++i) {
+    y[i] += x[i];
+  }
+}
+
+// Computes z = x - y.
+void Subtract(ArrayView<const float> x,
+              ArrayView<const float> y,
+              ArrayView<float> z) {
+  RTC_DCHECK_EQ(x.size(), y.size());
+  RTC_DCHECK_EQ(x.size(), z.size());
+  const size_t size = x.size();
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; i + 4 <= size; i += 4) {
+    _mm_storeu_ps(&z[i],
+                  _mm_sub_ps(_mm_loadu_ps(&x[i]), _mm_loadu_ps(&y[i])));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; i + 4 <= size; i += 4) {
+    vst1q_f32(&z[i], vsubq_f32(vld1q_f32(&x[i]), vld1q_f32(&y[i])));
+  }
+#endif
+  for (; i < size; ++i) {
+    z[i] = x[i] - y[i];
+  }
+}
+
+// Converts the interleaved 16 bit samples of `frame` to deinterleaved
+// FloatS16.
+void DeinterleaveToFloat(const AudioFrame& frame,
+                         DeinterleavedView<float> destination) {
+  InterleavedView<const int16_t> source = frame.data_view();
+  RTC_DCHECK_EQ(NumChannels(source), NumChannels(destination));
+  RTC_DCHECK_EQ(SamplesPerChannel(source), SamplesPerChannel(destination));
+  const size_t num_channels = NumChannels(source);
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    MonoView<float> destination_channel = destination[channel];
+    for (size_t i = 0; i < SamplesPerChannel(destination_channel); ++i) {
+      destination_channel[i] = source[i * num_channels + channel];
+    }
+  }
+}
+
+}  // namespace
+
+struct ConferenceMixer::Participant {
+  Participant(AudioMixer::Source* source, bool use_limiter)
+      : source(source), frame_combiner(use_limiter) {}
+
+  AudioMixer::Source* const source;
+  // The audio of the last call to Mix(), valid if `is_mixed`.
+  AudioFrame frame;
+  std::vector<float> samples;
+  bool is_mixed = false;
+  // Holds the limiter state of the mix this participant listens to.
+  FrameCombiner frame_combiner;
+};
+
+ConferenceMixer::ConferenceMixer()
+    : ConferenceMixer(std::make_unique<DefaultOutputRateCalculator>(),
+                      /*use_limiter=*/true) {}
+
+ConferenceMixer::ConferenceMixer(
+    std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+    bool use_limiter)
+    : output_rate_calculator_(std::move(output_rate_calculator)),
+      use_limiter_(use_limiter) {}
+
+ConferenceMixer::~ConferenceMixer() = default;
+
+bool ConferenceMixer::AddParticipant(AudioMixer::Source* participant) {
+  RTC_DCHECK(participant);
+  MutexLock lock(&mutex_);
+  RTC_DCHECK(std::none_of(participants_.begin(), participants_.end(),
+                          [&](const std::unique_ptr<Participant>& p) {
+                            return p->source == participant;
+                          }))
+      << "Participant already added to mixer";
+  participants_.push_back(
+      std::make_unique<Participant>(participant, use_limiter_));
+  return true;
+}
+
+void ConferenceMixer::RemoveParticipant(AudioMixer::Source* participant) {
+  RTC_DCHECK(participant);
+  MutexLock lock(&mutex_);
+  auto it = std::find_if(participants_.begin(), participants_.end(),
+                         [&](const std::unique_ptr<Participant>& p) {
+                           return p->source == participant;
+                         });
+  RTC_DCHECK(it != participants_.end()) << "Participant not present in mixer";
+  if (it != participants_.end()) {
+    participants_.erase(it);
+  }
+}
+
+void ConferenceMixer::Mix(size_t number_of_channels, MixCallback on_mix) {
+  TRACE_EVENT0("webrtc", "ConferenceMixer::Mix");
+  RTC_DCHECK_GE(number_of_channels, 1);
+  MutexLock lock(&mutex_);
+  if (participants_.empty()) {
+    return;
+  }
+  number_of_channels =
+      std::min(number_of_channels, FrameCombiner::kMaximumNumberOfChannels);
+
+  preferred_rates_.clear();
+  for (const std::unique_ptr<Participant>& participant : participants_) {
+    preferred_rates_.push_back(participant->source->PreferredSampleRate());
+  }
+  const int sample_rate =
+      output_rate_calculator_->CalculateOutputRateFromRange(preferred_rates_);
+  const size_t samples_per_channel =
+      SampleRateToDefaultChannelSize(sample_rate);
+  RTC_CHECK_LE(samples_per_channel, FrameCombiner::kMaximumChannelSize);
+  const size_t size = samples_per_channel * number_of_channels;
+
+  // Pull every participant once and sum all of them.
+  full_mix_.assign(size, 0.0f);
+  listener_mix_.resize(size);
+  for (std::unique_ptr<Participant>& participant : participants_) {
+    participant->is_mixed = false;
+    switch (participant->source->GetAudioFrameWithInfo(sample_rate,
+                                                       &participant->frame)) {
+      case AudioMixer::Source::AudioFrameInfo::kError:
+        RTC_LOG_F(LS_WARNING)
+            << "failed to GetAudioFrameWithInfo() from participant";
+        continue;
+      case AudioMixer::Source::AudioFrameInfo::kMuted:
+        continue;
+      case AudioMixer::Source::AudioFrameInfo::kNormal:
+        break;
+    }
+    RTC_DCHECK_EQ(participant->frame.samples_per_channel_,
+                  samples_per_channel);
+    RemixFrame(number_of_channels, &participant->frame);
+    participant->samples.resize(size);
+    DeinterleaveToFloat(
+        participant->frame,
+        DeinterleavedView<float>(participant->samples.data(),
+                                 samples_per_channel, number_of_channels));
+    Accumulate(participant->samples, full_mix_);
+    participant->is_mixed = true;
+  }
+
+  // Every listener hears all other participants.
+  const size_t number_of_streams = participants_.size() - 1;
+  for (std::unique_ptr<Participant>& listener : participants_) {
+    mix_list_.clear();
+    for (const std::unique_ptr<Participant>& participant : participants_) {
+      if (participant->is_mixed && participant != listener) {
+        mix_list_.push_back(&participant->frame);
+      }
+    }
+    if (listener->is_mixed) {
+      Subtract(full_mix_, listener->samples, listener_mix_);
+    } else {
+      std::copy(full_mix_.begin(), full_mix_.end(), listener_mix_.begin());
+    }
+    listener->frame_combiner.CombineMixed(
+        mix_list_,
+        DeinterleavedView<float>(listener_mix_.data(), samples_per_channel,
+                                 number_of_channels),
+        sample_rate, number_of_streams, &output_frame_);
+    on_mix(listener->source, output_frame_);
+  }
+}
+
+}  // namespace webrtc
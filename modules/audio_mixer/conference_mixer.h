@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_MIXER_CONFERENCE_MIXER_H_
+#define MODULES_AUDIO_MIXER_CONFERENCE_MIXER_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/function_view.h"
+#include "modules/audio_mixer/output_rate_calculator.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Mixer for a server side conference, where every participant is both a
+// source and a listener, and hears the mix of all other participants
+// ("mix-minus"). Running one AudioMixerImpl per listener pulls every source
+// once per listener, i.e. N * (N - 1) times per 10 ms. Instead, this pulls
+// every source once, sums all of them into a full mix and produces the mix of
+// each listener by subtracting its own audio. Each output has its own limiter.
+//
+// The sums are computed in float on audio converted from 16 bit, which is
+// exact for less than 2^24 / 2^15 = 512 participants. The output is then the
+// same as that of an AudioMixerImpl with all other participants as sources,
+// as long as the output rates match.
+class ConferenceMixer {
+ public:
+  // Receives the mix of all participants but `listener`.
+  using MixCallback =
+      FunctionView<void(AudioMixer::Source* listener, const AudioFrame& mix)>;
+
+  ConferenceMixer();
+  ConferenceMixer(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
+                  bool use_limiter);
+  ~ConferenceMixer();
+
+  ConferenceMixer(const ConferenceMixer&) = delete;
+  ConferenceMixer& operator=(const ConferenceMixer&) = delete;
+
+  // Adds and removes participants, possibly from other threads than Mix().
+  bool AddParticipant(AudioMixer::Source* participant)
+      RTC_LOCKS_EXCLUDED(mutex_);
+  void RemoveParticipant(AudioMixer::Source* participant)
+      RTC_LOCKS_EXCLUDED(mutex_);
+
+  // Pulls 10 ms of audio from every participant and calls `on_mix` once per
+  // participant, in the order they were added. The mixes have
+  // `number_of_channels` channels and share a sample rate, which is chosen
+  // from the preferred rates of all participants. `on_mix` is called with the
+  // mixer locked and must not add or remove participants.
+  void Mix(size_t number_of_channels, MixCallback on_mix)
+      RTC_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  struct Participant;
+
+  const std::unique_ptr<OutputRateCalculator> output_rate_calculator_;
+  const bool use_limiter_;
+
+  Mutex mutex_;
+  std::vector<std::unique_ptr<Participant>> participants_
+      RTC_GUARDED_BY(mutex_);
+
+  // Scratch buffers, kept between calls to avoid allocations.
+  std::vector<int> preferred_rates_ RTC_GUARDED_BY(mutex_);
+  std::vector<const AudioFrame*> mix_list_ RTC_GUARDED_BY(mutex_);
+  std::vector<float> full_mix_ RTC_GUARDED_BY(mutex_);
+  std::vector<float> listener_mix_ RTC_GUARDED_BY(mutex_);
+  AudioFrame output_frame_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_MIXER_CONFERENCE_MIXER_H_
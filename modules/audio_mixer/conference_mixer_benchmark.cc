@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/scoped_refptr.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_mixer/audio_mixer_impl.h"
+#include "modules/audio_mixer/conference_mixer.h"
+#include "modules/audio_mixer/sine_wave_generator.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+
+// Returns the same 10 ms of audio on every call, so that the benchmarks
+// measure the mixing rather than the production of audio.
+class FixedSource : public AudioMixer::Source {
+ public:
+  explicit FixedSource(float frequency_hz) {
+    frame_.sample_rate_hz_ = kSampleRateHz;
+    frame_.samples_per_channel_ = kSampleRateHz / 100;
+    frame_.num_channels_ = 1;
+    SineWaveGenerator(frequency_hz, 3000).GenerateNextFrame(&frame_);
+  }
+
+  AudioFrameInfo GetAudioFrameWithInfo(int /* sample_rate_hz */,
+                                       AudioFrame* audio_frame) override {
+    audio_frame->CopyFrom(frame_);
+    return AudioFrameInfo::kNormal;
+  }
+  int Ssrc() const override { return 0; }
+  int PreferredSampleRate() const override { return kSampleRateHz; }
+
+ private:
+  AudioFrame frame_;
+};
+
+std::vector<std::unique_ptr<FixedSource>> CreateSources(int count) {
+  std::vector<std::unique_ptr<FixedSource>> sources;
+  for (int i = 0; i < count; ++i) {
+    sources.push_back(std::make_unique<FixedSource>(100 + 10 * i));
+  }
+  return sources;
+}
+
+// One AudioMixerImpl per listener, mixing all other participants. Each source
+// is pulled once per listener.
+void BM_MixMinusWithMixerPerListener(benchmark::State& state) {
+  const int num_participants = state.range(0);
+  std::vector<std::unique_ptr<FixedSource>> sources =
+      CreateSources(num_participants);
+  std::vector<scoped_refptr<AudioMixerImpl>> mixers;
+  for (int listener = 0; listener < num_participants; ++listener) {
+    mixers.push_back(AudioMixerImpl::Create());
+    for (int i = 0; i < num_participants; ++i) {
+      if (i != listener) {
+        mixers.back()->AddSource(sources[i].get());
+      }
+    }
+  }
+  AudioFrame mix;
+  for (auto _ : state) {
+    for (const scoped_refptr<AudioMixerImpl>& mixer : mixers) {
+      mixer->Mix(1, &mix);
+      benchmark::DoNotOptimize(mix.data());
+    }
+  }
+}
+
+void BM_MixMinusWithConferenceMixer(benchmark::State& state) {
+  const int num_participants = state.range(0);
+  std::vector<std::unique_ptr<FixedSource>> sources =
+      CreateSources(num_participants);
+  ConferenceMixer mixer;
+  for (const std::unique_ptr<FixedSource>& source : sources) {
+    mixer.AddParticipant(source.get());
+  }
+  for (auto _ : state) {
+    mixer.Mix(1, [](AudioMixer::Source* /* listener */,
+                    const AudioFrame& mix) {
+      benchmark::DoNotOptimize(mix.data());
+    });
+  }
+}
+
+BENCHMARK(BM_MixMinusWithMixerPerListener)->Arg(10)->Arg(50)->Arg(200);
+BENCHMARK(BM_MixMinusWithConferenceMixer)->Arg(10)->Arg(50)->Arg(200);
+
+}  // namespace
+}  // namespace webrtc
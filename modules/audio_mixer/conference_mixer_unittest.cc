@@ -0,0 +1,166 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_mixer/conference_mixer.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_mixer.h"
+#include "api/scoped_refptr.h"
+#include "modules/audio_mixer/audio_mixer_impl.h"
+#include "modules/audio_mixer/sine_wave_generator.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAreArray;
+
+constexpr int kSampleRateHz = 48000;
+
+class SineSource : public AudioMixer::Source {
+ public:
+  SineSource(float frequency_hz, int16_t amplitude)
+      : generator_(frequency_hz, amplitude) {}
+
+  AudioFrameInfo GetAudioFrameWithInfo(int sample_rate_hz,
+                                       AudioFrame* audio_frame) override {
+    ++num_calls_;
+    audio_frame->sample_rate_hz_ = sample_rate_hz;
+    audio_frame->samples_per_channel_ = sample_rate_hz / 100;
+    audio_frame->num_channels_ = 1;
+    generator_.GenerateNextFrame(audio_frame);
+    return muted_ ? AudioFrameInfo::kMuted : AudioFrameInfo::kNormal;
+  }
+  int Ssrc() const override { return 0; }
+  int PreferredSampleRate() const override { return kSampleRateHz; }
+
+  void set_muted(bool muted) { muted_ = muted; }
+  int num_calls() const { return num_calls_; }
+
+ private:
+  SineWaveGenerator generator_;
+  bool muted_ = false;
+  int num_calls_ = 0;
+};
+
+std::vector<int16_t> Samples(const AudioFrame& frame) {
+  InterleavedView<const int16_t> data = frame.data_view();
+  return std::vector<int16_t>(data.begin(), data.end());
+}
+
+TEST(ConferenceMixerTest, PullsEverySourceOncePerMix) {
+  ConferenceMixer mixer;
+  std::vector<std::unique_ptr<SineSource>> sources;
+  for (int i = 0; i < 4; ++i) {
+    sources.push_back(std::make_unique<SineSource>(100 * (i + 1), 1000));
+    mixer.AddParticipant(sources.back().get());
+  }
+
+  std::vector<AudioMixer::Source*> listeners;
+  mixer.Mix(1, [&](AudioMixer::Source* listener, const AudioFrame& mix) {
+    listeners.push_back(listener);
+    EXPECT_EQ(mix.sample_rate_hz_, kSampleRateHz);
+    EXPECT_EQ(mix.num_channels_, 1u);
+  });
+
+  EXPECT_THAT(listeners,
+              ElementsAreArray({sources[0].get(), sources[1].get(),
+                                sources[2].get(), sources[3].get()}));
+  for (const auto& source : sources) {
+    EXPECT_EQ(source->num_calls(), 1);
+  }
+}
+
+TEST(ConferenceMixerTest, ListenerDoesNotHearItself) {
+  ConferenceMixer mixer;
+  SineSource speaker(440, 5000);
+  SineSource listener(440, 5000);
+  listener.set_muted(true);
+  mixer.AddParticipant(&speaker);
+  mixer.AddParticipant(&listener);
+
+  std::map<AudioMixer::Source*, std::vector<int16_t>> mixes;
+  mixer.Mix(1, [&](AudioMixer::Source* participant, const AudioFrame& mix) {
+    mixes[participant] = Samples(mix);
+  });
+
+  // The speaker hears the muted listener, i.e. silence, and the listener
+  // hears the speaker.
+  EXPECT_THAT(mixes[&speaker], ::testing::Each(0));
+  SineSource expected_source(440, 5000);
+  AudioFrame expected;
+  expected_source.GetAudioFrameWithInfo(kSampleRateHz, &expected);
+  EXPECT_EQ(mixes[&listener], Samples(expected));
+}
+
+// The mix of each listener must match that of a separate AudioMixerImpl that
+// mixes all other participants, including the limiter.
+TEST(ConferenceMixerTest, MatchesAudioMixerWithAllOtherParticipants) {
+  constexpr int kNumParticipants = 4;
+  constexpr int kListener = 1;
+  ConferenceMixer conference_mixer;
+  scoped_refptr<AudioMixerImpl> reference_mixer = AudioMixerImpl::Create();
+  std::vector<std::unique_ptr<SineSource>> sources;
+  std::vector<std::unique_ptr<SineSource>> reference_sources;
+  for (int i = 0; i < kNumParticipants; ++i) {
+    // Loud enough for the limiter to kick in.
+    sources.push_back(std::make_unique<SineSource>(200 * (i + 1), 20000));
+    reference_sources.push_back(
+        std::make_unique<SineSource>(200 * (i + 1), 20000));
+    conference_mixer.AddParticipant(sources.back().get());
+    if (i != kListener) {
+      reference_mixer->AddSource(reference_sources.back().get());
+    }
+  }
+
+  for (int tick = 0; tick < 20; ++tick) {
+    std::vector<int16_t> mix;
+    conference_mixer.Mix(
+        2, [&](AudioMixer::Source* listener, const AudioFrame& frame) {
+          if (listener == sources[kListener].get()) {
+            mix = Samples(frame);
+          }
+        });
+    // Keep the reference source of the listener in step.
+    AudioFrame unused;
+    reference_sources[kListener]->GetAudioFrameWithInfo(kSampleRateHz,
+                                                        &unused);
+    AudioFrame reference;
+    reference_mixer->Mix(2, &reference);
+    ASSERT_EQ(mix, Samples(reference)) << "tick " << tick;
+  }
+}
+
+TEST(ConferenceMixerTest, RemovedParticipantIsNotMixed) {
+  ConferenceMixer mixer;
+  SineSource first(440, 1000);
+  SineSource second(440, 1000);
+  mixer.AddParticipant(&first);
+  mixer.AddParticipant(&second);
+  mixer.RemoveParticipant(&second);
+
+  int num_mixes = 0;
+  mixer.Mix(1, [&](AudioMixer::Source* listener, const AudioFrame& mix) {
+    ++num_mixes;
+    EXPECT_EQ(listener, &first);
+    EXPECT_TRUE(mix.muted());
+  });
+  EXPECT_EQ(num_mixes, 1);
+  EXPECT_EQ(second.num_calls(), 0);
+}
+
+}  // namespace
+}  // namespace webrtc
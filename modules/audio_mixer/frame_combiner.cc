@@ -198,4 +198,31 @@ void FrameCombiner::Combine(ArrayView<AudioFrame* const> mix_list,
   InterleaveToAudioFrame(deinterleaved, audio_frame_for_mixing);
 }
 
+void FrameCombiner::CombineMixed(ArrayView<const AudioFrame* const> mix_list,
+                                 DeinterleavedView<float> mix,
+                                 int sample_rate,
+                                 size_t number_of_streams,
+                                 AudioFrame* audio_frame_for_mixing) {
+  RTC_DCHECK(audio_frame_for_mixing);
+  RTC_DCHECK_GT(sample_rate, 0);
+  RTC_DCHECK_EQ(SamplesPerChannel(mix),
+                SampleRateToDefaultChannelSize(sample_rate));
+  RTC_CHECK_LE(NumChannels(mix), kMaximumNumberOfChannels);
+  RTC_CHECK_LE(SamplesPerChannel(mix), kMaximumChannelSize);
+
+  SetAudioFrameFields(mix_list, NumChannels(mix), sample_rate,
+                      number_of_streams, audio_frame_for_mixing);
+
+  // Like Combine(), a mix of no streams is muted.
+  if (number_of_streams <= 1 && mix_list.empty()) {
+    audio_frame_for_mixing->Mute();
+    return;
+  }
+  if (use_limiter_ && number_of_streams > 1) {
+    RunLimiter(mix, &limiter_);
+  }
+
+  InterleaveToAudioFrame(mix, audio_frame_for_mixing);
+}
+
 }  // namespace webrtc
@@ -16,6 +16,7 @@
 
 #include "api/array_view.h"
 #include "api/audio/audio_frame.h"
+#include "api/audio/audio_view.h"
 #include "modules/audio_processing/agc2/limiter.h"
 
 namespace webrtc {
@@ -38,6 +39,17 @@ class FrameCombiner {
                size_t number_of_streams,
                AudioFrame* audio_frame_for_mixing);
 
+  // Like Combine(), but for audio that the caller already mixed into `mix`,
+  // as FloatS16. Only the limiter is applied, in place, before `mix` is
+  // written to `audio_frame_for_mixing`. `mix_list` holds the frames that
+  // were mixed and is used for the timestamps and packet infos of the result.
+  // `mix` must not exceed kMaximumNumberOfChannels and kMaximumChannelSize.
+  void CombineMixed(ArrayView<const AudioFrame* const> mix_list,
+                    DeinterleavedView<float> mix,
+                    int sample_rate,
+                    size_t number_of_streams,
+                    AudioFrame* audio_frame_for_mixing);
+
   // Stereo, 48 kHz, 10 ms.
   static constexpr size_t kMaximumNumberOfChannels = 8;
   static constexpr size_t kMaximumChannelSize = 48 * 10;
@@ -27,6 +27,7 @@
 #include "modules/audio_processing/aec3/render_delay_buffer.h"
 #include "modules/audio_processing/aec3/render_delay_controller.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 
@@ -241,7 +242,8 @@ std::unique_ptr<BlockProcessor> BlockProcessor::Create(
     const EchoCanceller3Config& config,
     int sample_rate_hz,
     size_t num_render_channels,
-    size_t num_capture_channels) {
+    size_t num_capture_channels,
+    ProcessingThreadPool* thread_pool) {
   std::unique_ptr<RenderDelayBuffer> render_buffer(
       RenderDelayBuffer::Create(config, sample_rate_hz, num_render_channels));
   std::unique_ptr<RenderDelayController> delay_controller;
@@ -249,8 +251,9 @@ std::unique_ptr<BlockProcessor> BlockProcessor::Create(
     delay_controller.reset(RenderDelayController::Create(config, sample_rate_hz,
                                                          num_capture_channels));
   }
-  std::unique_ptr<EchoRemover> echo_remover = EchoRemover::Create(
-      env, config, sample_rate_hz, num_render_channels, num_capture_channels);
+  std::unique_ptr<EchoRemover> echo_remover =
+      EchoRemover::Create(env, config, sample_rate_hz, num_render_channels,
+                          num_capture_channels, thread_pool);
   return Create(config, sample_rate_hz, num_render_channels,
                 num_capture_channels, std::move(render_buffer),
                 std::move(delay_controller), std::move(echo_remover));
@@ -23,18 +23,22 @@
 #include "modules/audio_processing/aec3/echo_remover.h"
 #include "modules/audio_processing/aec3/render_delay_buffer.h"
 #include "modules/audio_processing/aec3/render_delay_controller.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 
 namespace webrtc {
 
 // Class for performing echo cancellation on 64 sample blocks of audio data.
 class BlockProcessor {
  public:
+  // If `thread_pool` is non-null, the echo removal splits its per-channel
+  // processing across the threads of the pool.
   static std::unique_ptr<BlockProcessor> Create(
       const Environment& env,
       const EchoCanceller3Config& config,
       int sample_rate_hz,
       size_t num_render_channels,
-      size_t num_capture_channels);
+      size_t num_capture_channels,
+      ProcessingThreadPool* thread_pool = nullptr);
   // Only used for testing purposes.
   static std::unique_ptr<BlockProcessor> Create(
       const Environment& env,
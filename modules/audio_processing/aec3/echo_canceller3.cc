@@ -32,6 +32,7 @@
 #include "modules/audio_processing/aec3/frame_blocker.h"
 #include "modules/audio_processing/high_pass_filter.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/logging.h"
@@ -750,7 +751,8 @@ EchoCanceller3::EchoCanceller3(
     const std::optional<EchoCanceller3Config>& multichannel_config,
     int sample_rate_hz,
     size_t num_render_channels,
-    size_t num_capture_channels)
+    size_t num_capture_channels,
+    ProcessingThreadPool* thread_pool)
     : env_(env),
       data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
       config_(AdjustConfig(config, env.field_trials())),
@@ -758,6 +760,7 @@ EchoCanceller3::EchoCanceller3(
       num_bands_(NumBandsForRate(sample_rate_hz_)),
       num_render_input_channels_(num_render_channels),
       num_capture_channels_(num_capture_channels),
+      thread_pool_(thread_pool),
       config_selector_(config_,
                        multichannel_config,
                        num_render_input_channels_),
@@ -843,7 +846,7 @@ void EchoCanceller3::Initialize() {
 
   block_processor_ = BlockProcessor::Create(
       env_, config_selector_.active_config(), sample_rate_hz_,
-      num_render_channels_to_aec_, num_capture_channels_);
+      num_render_channels_to_aec_, num_capture_channels_, thread_pool_);
 
   render_sub_frame_view_ = std::vector<std::vector<ArrayView<float>>>(
       num_bands_, std::vector<ArrayView<float>>(num_render_channels_to_aec_));
@@ -32,6 +32,7 @@
 #include "modules/audio_processing/aec3/multi_channel_content_detector.h"
 #include "modules/audio_processing/audio_buffer.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/race_checker.h"
 #include "rtc_base/swap_queue.h"
@@ -89,6 +90,9 @@ class Aec3RenderQueueItemVerifier {
 //
 // The class is supposed to be used in a non-concurrent manner apart from the
 // AnalyzeRender call which can be called concurrently with the other methods.
+// If a `thread_pool` is passed, the capture processing of the channels is
+// split across its threads, which must not be used concurrently by others
+// during the ProcessCapture calls. The pool must outlive the echo canceller.
 class EchoCanceller3 : public EchoControl {
  public:
   EchoCanceller3(const Environment& env,
@@ -96,7 +100,8 @@ class EchoCanceller3 : public EchoControl {
                  const std::optional<EchoCanceller3Config>& multichannel_config,
                  int sample_rate_hz,
                  size_t num_render_channels,
-                 size_t num_capture_channels);
+                 size_t num_capture_channels,
+                 ProcessingThreadPool* thread_pool = nullptr);
 
   ~EchoCanceller3() override;
 
@@ -195,6 +200,7 @@ class EchoCanceller3 : public EchoControl {
   const size_t num_render_input_channels_;
   size_t num_render_channels_to_aec_;
   const size_t num_capture_channels_;
+  ProcessingThreadPool* const thread_pool_;
   ConfigSelector config_selector_;
   MultiChannelContentDetector multichannel_content_detector_;
   std::unique_ptr<BlockFramer> linear_output_framer_
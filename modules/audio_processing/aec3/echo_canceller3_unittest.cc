@@ -25,6 +25,8 @@
 #include "modules/audio_processing/audio_buffer.h"
 #include "modules/audio_processing/high_pass_filter.h"
 #include "modules/audio_processing/utility/cascaded_biquad_filter.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
 #include "test/explicit_key_value_config.h"
 #include "test/gmock.h"
@@ -1146,6 +1148,61 @@ TEST(EchoCanceller3, StereoContentDetectionForMonoSignals) {
   }
 }
 
+// Verifies that splitting the capture channels across threads does not change
+// the output.
+TEST(EchoCanceller3, ParallelCaptureProcessingIsBitExact) {
+  constexpr int kSampleRateHz = 16000;
+  constexpr size_t kNumChannels = 4;
+  constexpr size_t kFrameLength = 160;
+  ProcessingThreadPool thread_pool(3);
+  EchoCanceller3 serial_aec3(CreateEnvironment(), EchoCanceller3Config(),
+                             /*multichannel_config=*/std::nullopt,
+                             kSampleRateHz, kNumChannels, kNumChannels);
+  EchoCanceller3 parallel_aec3(CreateEnvironment(), EchoCanceller3Config(),
+                               /*multichannel_config=*/std::nullopt,
+                               kSampleRateHz, kNumChannels, kNumChannels,
+                               &thread_pool);
+  AudioBuffer render(kSampleRateHz, kNumChannels, kSampleRateHz, kNumChannels,
+                     kSampleRateHz, kNumChannels);
+  AudioBuffer serial_capture(kSampleRateHz, kNumChannels, kSampleRateHz,
+                             kNumChannels, kSampleRateHz, kNumChannels);
+  AudioBuffer parallel_capture(kSampleRateHz, kNumChannels, kSampleRateHz,
+                               kNumChannels, kSampleRateHz, kNumChannels);
+  Random random(7);
+  std::vector<std::vector<float>> previous_render(
+      kNumChannels, std::vector<float>(kFrameLength, 0.f));
+
+  for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      for (size_t i = 0; i < kFrameLength; ++i) {
+        // The capture signal is an attenuated, delayed render signal with a
+        // channel dependent echo path, plus noise.
+        const float capture_sample = 0.1f * (ch + 1) * previous_render[ch][i] +
+                                     random.Gaussian(0.f, 50.f);
+        previous_render[ch][i] = random.Gaussian(0.f, 3000.f);
+        render.channels()[ch][i] = previous_render[ch][i];
+        serial_capture.channels()[ch][i] = capture_sample;
+        parallel_capture.channels()[ch][i] = capture_sample;
+      }
+    }
+
+    serial_aec3.AnalyzeRender(&render);
+    parallel_aec3.AnalyzeRender(&render);
+    serial_aec3.AnalyzeCapture(&serial_capture);
+    parallel_aec3.AnalyzeCapture(&parallel_capture);
+    serial_aec3.ProcessCapture(&serial_capture, /*level_change=*/false);
+    parallel_aec3.ProcessCapture(&parallel_capture, /*level_change=*/false);
+
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      for (size_t i = 0; i < kFrameLength; ++i) {
+        ASSERT_EQ(parallel_capture.channels_const()[ch][i],
+                  serial_capture.channels_const()[ch][i])
+            << "frame " << frame_index << ", channel " << ch;
+      }
+    }
+  }
+}
+
 #if RTC_DCHECK_IS_ON && GTEST_HAS_DEATH_TEST && !defined(WEBRTC_ANDROID)
 
 TEST(EchoCanceller3InputCheckDeathTest, WrongCaptureNumBandsCheckVerification) {
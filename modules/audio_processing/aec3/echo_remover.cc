@@ -35,6 +35,7 @@
 #include "modules/audio_processing/aec3/suppression_filter.h"
 #include "modules/audio_processing/aec3/suppression_gain.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 
@@ -110,7 +111,8 @@ class EchoRemoverImpl final : public EchoRemover {
                   const EchoCanceller3Config& config,
                   int sample_rate_hz,
                   size_t num_render_channels,
-                  size_t num_capture_channels);
+                  size_t num_capture_channels,
+                  ProcessingThreadPool* thread_pool);
   ~EchoRemoverImpl() override;
   EchoRemoverImpl(const EchoRemoverImpl&) = delete;
   EchoRemoverImpl& operator=(const EchoRemoverImpl&) = delete;
@@ -152,6 +154,7 @@ class EchoRemoverImpl final : public EchoRemover {
   const int sample_rate_hz_;
   const size_t num_render_channels_;
   const size_t num_capture_channels_;
+  ProcessingThreadPool* const thread_pool_;
   const bool use_coarse_filter_output_;
   Subtractor subtractor_;
   SuppressionGain suppression_gain_;
@@ -188,7 +191,8 @@ EchoRemoverImpl::EchoRemoverImpl(const Environment& env,
                                  const EchoCanceller3Config& config,
                                  int sample_rate_hz,
                                  size_t num_render_channels,
-                                 size_t num_capture_channels)
+                                 size_t num_capture_channels,
+                                 ProcessingThreadPool* thread_pool)
     : config_(config),
       fft_(),
       data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
@@ -196,6 +200,7 @@ EchoRemoverImpl::EchoRemoverImpl(const Environment& env,
       sample_rate_hz_(sample_rate_hz),
       num_render_channels_(num_render_channels),
       num_capture_channels_(num_capture_channels),
+      thread_pool_(thread_pool),
       use_coarse_filter_output_(
           config_.filter.enable_coarse_filter_output_usage),
       subtractor_(env,
@@ -203,11 +208,13 @@ EchoRemoverImpl::EchoRemoverImpl(const Environment& env,
                   num_render_channels_,
                   num_capture_channels_,
                   data_dumper_.get(),
-                  optimization_),
+                  optimization_,
+                  thread_pool),
       suppression_gain_(config_,
                         optimization_,
                         sample_rate_hz,
-                        num_capture_channels),
+                        num_capture_channels,
+                        thread_pool),
       cng_(config_, optimization_, num_capture_channels_),
       suppression_filter_(optimization_,
                           sample_rate_hz_,
@@ -373,15 +380,20 @@ void EchoRemoverImpl::ProcessCapture(
   subtractor_.Process(*render_buffer, *y, render_signal_analyzer_, aec_state_,
                       subtractor_output);
 
-  // Compute spectra.
+  // Form the linear filter outputs. This is done in channel order, as the
+  // choice of filter output for a channel depends on that for the previous.
   for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
     FormLinearFilterOutput(subtractor_output[ch], e[ch]);
+  }
+
+  // Compute spectra.
+  ParallelFor(thread_pool_, num_capture_channels_, [&](size_t ch) {
     WindowedPaddedFft(fft_, y->View(/*band=*/0, ch), y_old_[ch], &Y[ch]);
     WindowedPaddedFft(fft_, e[ch], e_old_[ch], &E[ch]);
     LinearEchoPower(E[ch], Y[ch], &S2_linear[ch]);
     Y[ch].Spectrum(optimization_, Y2[ch]);
     E[ch].Spectrum(optimization_, E2[ch]);
-  }
+  });
 
   // Optionally return the linear filter output.
   if (linear_output) {
@@ -519,9 +531,11 @@ std::unique_ptr<EchoRemover> EchoRemover::Create(
     const EchoCanceller3Config& config,
     int sample_rate_hz,
     size_t num_render_channels,
-    size_t num_capture_channels) {
-  return std::make_unique<EchoRemoverImpl>(
-      env, config, sample_rate_hz, num_render_channels, num_capture_channels);
+    size_t num_capture_channels,
+    ProcessingThreadPool* thread_pool) {
+  return std::make_unique<EchoRemoverImpl>(env, config, sample_rate_hz,
+                                           num_render_channels,
+                                           num_capture_channels, thread_pool);
 }
 
 }  // namespace webrtc
@@ -22,17 +22,22 @@
 #include "modules/audio_processing/aec3/delay_estimate.h"
 #include "modules/audio_processing/aec3/echo_path_variability.h"
 #include "modules/audio_processing/aec3/render_buffer.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 
 namespace webrtc {
 
 // Class for removing the echo from the capture signal.
 class EchoRemover {
  public:
-  static std::unique_ptr<EchoRemover> Create(const Environment& env,
-                                             const EchoCanceller3Config& config,
-                                             int sample_rate_hz,
-                                             size_t num_render_channels,
-                                             size_t num_capture_channels);
+  // If `thread_pool` is non-null, per-channel processing is split across its
+  // threads.
+  static std::unique_ptr<EchoRemover> Create(
+      const Environment& env,
+      const EchoCanceller3Config& config,
+      int sample_rate_hz,
+      size_t num_render_channels,
+      size_t num_capture_channels,
+      ProcessingThreadPool* thread_pool = nullptr);
   virtual ~EchoRemover() = default;
 
   // Get current metrics.
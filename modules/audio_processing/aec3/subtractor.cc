@@ -19,6 +19,7 @@
 #include "modules/audio_processing/aec3/adaptive_fir_filter_erl.h"
 #include "modules/audio_processing/aec3/fft_data.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_minmax.h"
 
@@ -68,10 +69,12 @@ Subtractor::Subtractor(const Environment& env,
                        size_t num_render_channels,
                        size_t num_capture_channels,
                        ApmDataDumper* data_dumper,
-                       Aec3Optimization optimization)
+                       Aec3Optimization optimization,
+                       ProcessingThreadPool* thread_pool)
     : fft_(),
       data_dumper_(data_dumper),
       optimization_(optimization),
+      thread_pool_(thread_pool),
       config_(config),
       num_capture_channels_(num_capture_channels),
       use_coarse_filter_reset_hangover_(
@@ -205,8 +208,9 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
                                &X2_coarse);
   }
 
-  // Process all capture channels
-  for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
+  // Process all capture channels. The channels only share read-only state, and
+  // channel 0, which is the only one being dumped, runs on the calling thread.
+  ParallelFor(thread_pool_, num_capture_channels_, [&](size_t ch) {
     SubtractorOutput& output = outputs[ch];
     ArrayView<const float> y = capture.View(/*band=*/0, ch);
     FftData& E_refined = output.E_refined;
@@ -324,7 +328,7 @@ void Subtractor::Process(const RenderBuffer& render_buffer,
       data_dumper_->DumpWav("aec3_coarse_filter_output", kBlockSize,
                             &e_coarse[0], 16000, 1);
     }
-  }
+  });
 }
 
 void Subtractor::FilterMisadjustmentEstimator::Update(
@@ -32,6 +32,7 @@
 #include "modules/audio_processing/aec3/render_signal_analyzer.h"
 #include "modules/audio_processing/aec3/subtractor_output.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -39,12 +40,15 @@ namespace webrtc {
 // Proves linear echo cancellation functionality
 class Subtractor {
  public:
+  // If `thread_pool` is non-null, the capture channels are processed
+  // concurrently on its threads.
   Subtractor(const Environment& env,
              const EchoCanceller3Config& config,
              size_t num_render_channels,
              size_t num_capture_channels,
              ApmDataDumper* data_dumper,
-             Aec3Optimization optimization);
+             Aec3Optimization optimization,
+             ProcessingThreadPool* thread_pool = nullptr);
   ~Subtractor();
   Subtractor(const Subtractor&) = delete;
   Subtractor& operator=(const Subtractor&) = delete;
@@ -130,6 +134,7 @@ class Subtractor {
   const Aec3Fft fft_;
   ApmDataDumper* data_dumper_;
   const Aec3Optimization optimization_;
+  ProcessingThreadPool* const thread_pool_;
   const EchoCanceller3Config config_;
   const size_t num_capture_channels_;
   const bool use_coarse_filter_reset_hangover_;
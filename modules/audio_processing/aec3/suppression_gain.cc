@@ -21,6 +21,7 @@
 #include "modules/audio_processing/aec3/subband_nearend_detector.h"
 #include "modules/audio_processing/aec3/vector_math.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -274,8 +275,8 @@ void SuppressionGain::LowerBandGain(
   std::array<float, kFftLengthBy2Plus1> max_gain;
   GetMaxGain(max_gain);
 
-  for (size_t ch = 0; ch < num_capture_channels_; ++ch) {
-    std::array<float, kFftLengthBy2Plus1> G;
+  ParallelFor(thread_pool_, num_capture_channels_, [&](size_t ch) {
+    std::array<float, kFftLengthBy2Plus1>& G = channel_gains_[ch];
     std::array<float, kFftLengthBy2Plus1> nearend;
     nearend_smoothers_[ch].Average(suppressor_input[ch], nearend);
 
@@ -290,15 +291,21 @@ void SuppressionGain::LowerBandGain(
     GainToNoAudibleEcho(nearend, weighted_residual_echo, comfort_noise[0], &G);
 
     // Clamp gains.
-    for (size_t k = 0; k < gain->size(); ++k) {
+    for (size_t k = 0; k < G.size(); ++k) {
       G[k] = std::max(std::min(G[k], max_gain[k]), min_gain[k]);
-      (*gain)[k] = std::min((*gain)[k], G[k]);
     }
 
     // Store data required for the gain computation of the next block.
     std::copy(nearend.begin(), nearend.end(), last_nearend_[ch].begin());
     std::copy(weighted_residual_echo.begin(), weighted_residual_echo.end(),
               last_echo_[ch].begin());
+  });
+
+  // Use the lowest gain of all channels, combined in channel order.
+  for (const auto& G : channel_gains_) {
+    for (size_t k = 0; k < gain->size(); ++k) {
+      (*gain)[k] = std::min((*gain)[k], G[k]);
+    }
   }
 
   LimitLowFrequencyGains(gain);
@@ -320,13 +327,16 @@ void SuppressionGain::LowerBandGain(
 SuppressionGain::SuppressionGain(const EchoCanceller3Config& config,
                                  Aec3Optimization optimization,
                                  int /* sample_rate_hz */,
-                                 size_t num_capture_channels)
+                                 size_t num_capture_channels,
+                                 ProcessingThreadPool* thread_pool)
     : data_dumper_(new ApmDataDumper(instance_count_.fetch_add(1) + 1)),
       optimization_(optimization),
       config_(config),
       num_capture_channels_(num_capture_channels),
+      thread_pool_(thread_pool),
       state_change_duration_blocks_(
           static_cast<int>(config_.filter.config_change_duration_blocks)),
+      channel_gains_(num_capture_channels_),
       last_nearend_(num_capture_channels_, {0}),
       last_echo_(num_capture_channels_, {0}),
       nearend_smoothers_(
@@ -26,15 +26,19 @@
 #include "modules/audio_processing/aec3/nearend_detector.h"
 #include "modules/audio_processing/aec3/render_signal_analyzer.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 
 namespace webrtc {
 
 class SuppressionGain {
  public:
+  // If `thread_pool` is non-null, the per-channel gains are computed
+  // concurrently on its threads.
   SuppressionGain(const EchoCanceller3Config& config,
                   Aec3Optimization optimization,
                   int sample_rate_hz,
-                  size_t num_capture_channels);
+                  size_t num_capture_channels,
+                  ProcessingThreadPool* thread_pool = nullptr);
   ~SuppressionGain();
 
   SuppressionGain(const SuppressionGain&) = delete;
@@ -122,8 +126,11 @@ class SuppressionGain {
   const Aec3Optimization optimization_;
   const EchoCanceller3Config config_;
   const size_t num_capture_channels_;
+  ProcessingThreadPool* const thread_pool_;
   const int state_change_duration_blocks_;
   std::array<float, kFftLengthBy2Plus1> last_gain_;
+  // Per-channel gains, combined after they have all been computed.
+  std::vector<std::array<float, kFftLengthBy2Plus1>> channel_gains_;
   std::vector<std::array<float, kFftLengthBy2Plus1>> last_nearend_;
   std::vector<std::array<float, kFftLengthBy2Plus1>> last_echo_;
   LowNoiseRenderDetector low_render_detector_;
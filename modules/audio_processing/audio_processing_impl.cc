@@ -517,6 +517,7 @@ void AudioProcessingImpl::MaybeInitializeRender(
 
 void AudioProcessingImpl::InitializeLocked() {
   UpdateActiveSubmoduleStates();
+  InitializeCaptureThreadPool();
 
   const int render_audiobuffer_sample_rate_hz =
       formats_.api_format.reverse_output_stream().num_frames() == 0
@@ -687,7 +688,9 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
       config_.pipeline.maximum_internal_processing_rate !=
           config.pipeline.maximum_internal_processing_rate ||
       config_.pipeline.capture_downmix_method !=
-          config.pipeline.capture_downmix_method;
+          config.pipeline.capture_downmix_method ||
+      config_.pipeline.capture_processing_threads !=
+          config.pipeline.capture_processing_threads;
 
   const bool aec_config_changed =
       config_.echo_canceller.enabled != config.echo_canceller.enabled ||
@@ -1888,6 +1891,18 @@ void AudioProcessingImpl::InitializeHighPassFilter(bool forced_reset) {
   }
 }
 
+void AudioProcessingImpl::InitializeCaptureThreadPool() {
+  const int num_threads = config_.pipeline.capture_processing_threads;
+  if (num_threads <= 1) {
+    capture_thread_pool_.reset();
+    return;
+  }
+  if (!capture_thread_pool_ ||
+      capture_thread_pool_->num_threads() != num_threads) {
+    capture_thread_pool_ = std::make_unique<ProcessingThreadPool>(num_threads);
+  }
+}
+
 void AudioProcessingImpl::InitializeEchoController() {
   bool use_echo_controller =
       echo_control_factory_ ||
@@ -1909,7 +1924,8 @@ void AudioProcessingImpl::InitializeEchoController() {
       }
       submodules_.echo_controller = std::make_unique<EchoCanceller3>(
           env_, config, multichannel_config, proc_sample_rate_hz(),
-          num_reverse_channels(), num_proc_channels());
+          num_reverse_channels(), num_proc_channels(),
+          capture_thread_pool_.get());
     }
 
     // Setup the storage for returning the linear AEC output.
@@ -2082,7 +2098,8 @@ void AudioProcessingImpl::InitializeNoiseSuppressor() {
     NsConfig cfg;
     cfg.target_level = map_level(config_.noise_suppression.level);
     submodules_.noise_suppressor = std::make_unique<NoiseSuppressor>(
-        cfg, proc_sample_rate_hz(), num_proc_channels());
+        cfg, proc_sample_rate_hz(), num_proc_channels(),
+        capture_thread_pool_.get());
   }
 }
 
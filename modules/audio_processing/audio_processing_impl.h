@@ -43,6 +43,7 @@
 #include "modules/audio_processing/ns/noise_suppressor.h"
 #include "modules/audio_processing/render_queue_item_verifier.h"
 #include "modules/audio_processing/rms_level.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/gtest_prod_util.h"
 #include "rtc_base/swap_queue.h"
 #include "rtc_base/synchronization/mutex.h"
@@ -257,6 +258,10 @@ class AudioProcessingImpl : public AudioProcessing {
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
   void InitializeEchoController()
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
+  // Creates the threads for the per-channel capture processing if needed. Must
+  // be followed by the initialization of the submodules that use them.
+  void InitializeCaptureThreadPool()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_render_, mutex_capture_);
 
   // Initializations of capture-only sub-modules, requiring the capture lock
   // already acquired.
@@ -363,6 +368,10 @@ class AudioProcessingImpl : public AudioProcessing {
   // Class containing information about what submodules are active.
   SubmoduleStates submodule_states_;
 
+  // Threads for the per-channel capture processing, shared by the submodules.
+  // Declared before `submodules_` to outlive them.
+  std::unique_ptr<ProcessingThreadPool> capture_thread_pool_;
+
   // Struct containing the pointers to the submodules.
   struct Submodules {
     Submodules(std::unique_ptr<CustomProcessing> capture_post_processor,
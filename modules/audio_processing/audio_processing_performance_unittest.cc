@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
@@ -553,8 +555,98 @@ bool TimedThreadApiProcessor::Process() {
 
 const float CallSimulator::kRenderInputFloatLevel = 0.5f;
 const float CallSimulator::kCaptureInputFloatLevel = 0.03125f;
+
+// Runs multi-channel echo cancellation and noise suppression on `num_frames`
+// of random 48 kHz audio with the per-channel capture processing split across
+// `num_threads`, and returns the capture output of all frames.
+std::vector<float> RunMultiChannelCapture(int num_channels,
+                                          int num_threads,
+                                          int num_frames,
+                                          SamplesStatsCounter& durations) {
+  constexpr int kSampleRateHz = 48000;
+  constexpr int kFrameSize = kSampleRateHz / 100;
+  constexpr int kNumInitializationFrames = 5;
+  AudioProcessing::Config config;
+  config.pipeline.multi_channel_render = true;
+  config.pipeline.multi_channel_capture = true;
+  config.pipeline.capture_processing_threads = num_threads;
+  config.echo_canceller.enabled = true;
+  config.noise_suppression.enabled = true;
+  scoped_refptr<AudioProcessing> apm =
+      BuiltinAudioProcessingBuilder(config).Build(CreateEnvironment());
+
+  const StreamConfig stream_config(kSampleRateHz, num_channels);
+  std::vector<std::vector<float>> render(num_channels,
+                                         std::vector<float>(kFrameSize));
+  std::vector<std::vector<float>> capture(num_channels,
+                                          std::vector<float>(kFrameSize));
+  std::vector<float*> render_channels;
+  std::vector<float*> capture_channels;
+  for (int ch = 0; ch < num_channels; ++ch) {
+    render_channels.push_back(render[ch].data());
+    capture_channels.push_back(capture[ch].data());
+  }
+
+  Random rand_gen(42U);
+  Clock* clock = Clock::GetRealTimeClock();
+  std::vector<float> output;
+  output.reserve(num_frames * num_channels * kFrameSize);
+  for (int frame = 0; frame < num_frames; ++frame) {
+    for (int ch = 0; ch < num_channels; ++ch) {
+      for (int k = 0; k < kFrameSize; ++k) {
+        render[ch][k] = 0.5f * (2 * rand_gen.Rand<float>() - 1);
+        capture[ch][k] = 0.1f * render[ch][k] +
+                         0.03125f * (2 * rand_gen.Rand<float>() - 1);
+      }
+    }
+    EXPECT_EQ(apm->ProcessReverseStream(render_channels.data(), stream_config,
+                                        stream_config, render_channels.data()),
+              AudioProcessing::kNoError);
+    apm->set_stream_delay_ms(0);
+    const int64_t start_time = clock->TimeInMicroseconds();
+    EXPECT_EQ(apm->ProcessStream(capture_channels.data(), stream_config,
+                                 stream_config, capture_channels.data()),
+              AudioProcessing::kNoError);
+    const int64_t end_time = clock->TimeInMicroseconds();
+    if (frame >= kNumInitializationFrames) {
+      durations.AddSample((end_time - start_time) / 1000.0);
+    }
+    for (int ch = 0; ch < num_channels; ++ch) {
+      output.insert(output.end(), capture[ch].begin(), capture[ch].end());
+    }
+  }
+  return output;
+}
+
 }  // anonymous namespace
 
+// Compares the capture processing time of multi-channel audio when the
+// per-channel processing runs on one thread and when it is split across
+// several, and verifies that the output is unaffected.
+TEST(AudioProcessingPerformanceTest, MultiChannelCaptureProcessingThreads) {
+  constexpr int kNumFrames = 300;
+  for (int num_channels : {8, 16}) {
+    std::vector<float> serial_output;
+    for (int num_threads : {1, 2, 4}) {
+      SamplesStatsCounter durations;
+      std::vector<float> output = RunMultiChannelCapture(
+          num_channels, num_threads, kNumFrames, durations);
+      GetGlobalMetricsLogger()->LogMetric(
+          "apm_multi_channel_capture_48000Hz",
+          std::to_string(num_channels) + "_channels_" +
+              std::to_string(num_threads) + "_threads",
+          durations, Unit::kMilliseconds,
+          ImprovementDirection::kSmallerIsBetter);
+      if (num_threads == 1) {
+        serial_output = std::move(output);
+      } else {
+        EXPECT_EQ(output, serial_output)
+            << num_channels << " channels, " << num_threads << " threads";
+      }
+    }
+  }
+}
+
 TEST_P(CallSimulator, ApiCallDurationTest) {
   // Run test and verify that it did not time out.
   EXPECT_TRUE(Run());
@@ -18,6 +18,7 @@
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/fast_math.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/suppression_params.h"
 #include "rtc_base/checks.h"
 
@@ -49,8 +50,11 @@ constexpr std::array<float, 129> log_table = {
 
 }  // namespace
 
-NoiseEstimator::NoiseEstimator(const SuppressionParams& suppression_params)
-    : suppression_params_(suppression_params) {
+NoiseEstimator::NoiseEstimator(const SuppressionParams& suppression_params,
+                               NsOptimization optimization)
+    : suppression_params_(suppression_params),
+      vector_math_(optimization),
+      quantile_noise_estimator_(optimization) {
   noise_spectrum_.fill(0.f);
   prev_noise_spectrum_.fill(0.f);
   conservative_noise_spectrum_.fill(0.f);
@@ -155,47 +159,12 @@ void NoiseEstimator::PreUpdate(
 void NoiseEstimator::PostUpdate(
     ArrayView<const float> speech_probability,
     ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum) {
-  // Time-avg parameter for noise_spectrum update.
-  constexpr float kNoiseUpdate = 0.9f;
-
-  float gamma = kNoiseUpdate;
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    const float prob_speech = speech_probability[i];
-    const float prob_non_speech = 1.f - prob_speech;
-
-    // Temporary noise update used for speech frames if update value is less
-    // than previous.
-    float noise_update_tmp =
-        gamma * prev_noise_spectrum_[i] +
-        (1.f - gamma) * (prob_non_speech * signal_spectrum[i] +
-                         prob_speech * prev_noise_spectrum_[i]);
-
-    // Time-constant based on speech/noise_spectrum state.
-    float gamma_old = gamma;
-
-    // Increase gamma for frame likely to be seech.
-    constexpr float kProbRange = .2f;
-    gamma = prob_speech > kProbRange ? .99f : kNoiseUpdate;
-
-    // Conservative noise_spectrum update.
-    if (prob_speech < kProbRange) {
-      conservative_noise_spectrum_[i] +=
-          0.05f * (signal_spectrum[i] - conservative_noise_spectrum_[i]);
-    }
-
-    // Noise_spectrum update.
-    if (gamma == gamma_old) {
-      noise_spectrum_[i] = noise_update_tmp;
-    } else {
-      noise_spectrum_[i] =
-          gamma * prev_noise_spectrum_[i] +
-          (1.f - gamma) * (prob_non_speech * signal_spectrum[i] +
-                           prob_speech * prev_noise_spectrum_[i]);
-      // Allow for noise_spectrum update downwards: If noise_spectrum update
-      // decreases the noise_spectrum, it is safe, so allow it to happen.
-      noise_spectrum_[i] = std::min(noise_spectrum_[i], noise_update_tmp);
-    }
-  }
+  RTC_DCHECK_EQ(speech_probability.size(), kFftSizeBy2Plus1);
+  vector_math_.NoiseUpdate(
+      ArrayView<const float, kFftSizeBy2Plus1>(speech_probability.data(),
+                                               kFftSizeBy2Plus1),
+      signal_spectrum, prev_noise_spectrum_, conservative_noise_spectrum_,
+      noise_spectrum_);
 }
 
 }  // namespace webrtc
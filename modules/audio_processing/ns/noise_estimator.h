@@ -15,6 +15,7 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/quantile_noise_estimator.h"
 #include "modules/audio_processing/ns/suppression_params.h"
 
@@ -24,7 +25,8 @@ namespace webrtc {
 // signal.
 class NoiseEstimator {
  public:
-  explicit NoiseEstimator(const SuppressionParams& suppression_params);
+  NoiseEstimator(const SuppressionParams& suppression_params,
+                 NsOptimization optimization);
 
   // Prepare the estimator for analysis of a new frame.
   void PrepareAnalysis();
@@ -60,6 +62,7 @@ class NoiseEstimator {
 
  private:
   const SuppressionParams& suppression_params_;
+  const NsVectorMath vector_math_;
   float white_noise_level_ = 0.f;
   float pink_noise_numerator_ = 0.f;
   float pink_noise_exp_ = 0.f;
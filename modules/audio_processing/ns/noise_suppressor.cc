@@ -16,7 +16,7 @@
 
 #include <algorithm>
 
-#include "modules/audio_processing/ns/fast_math.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -69,16 +69,29 @@ constexpr std::array<float, 96> kBlocks160w256FirstHalf = {
     0.99518473f, 0.99665524f, 0.99785892f, 0.99879546f, 0.99946459f,
     0.99986614f};
 
-// Applies the filterbank window to a buffer.
-void ApplyFilterBankWindow(ArrayView<float, kFftSize> x) {
+// Forms the full filterbank window, which is flat between the two halves, so
+// that it can be applied as a single elementwise multiplication.
+constexpr std::array<float, kFftSize> CreateFilterBankWindow() {
+  std::array<float, kFftSize> window = {};
+  for (size_t i = 0; i < kFftSize; ++i) {
+    window[i] = 1.f;
+  }
   for (size_t i = 0; i < 96; ++i) {
-    x[i] = kBlocks160w256FirstHalf[i] * x[i];
+    window[i] = kBlocks160w256FirstHalf[i];
   }
-
   for (size_t i = 161, k = 95; i < kFftSize; ++i, --k) {
-    RTC_DCHECK_NE(0, k);
-    x[i] = kBlocks160w256FirstHalf[k] * x[i];
+    window[i] = kBlocks160w256FirstHalf[k];
   }
+  return window;
+}
+
+constexpr std::array<float, kFftSize> kFilterBankWindow =
+    CreateFilterBankWindow();
+
+// Applies the filterbank window to a buffer.
+void ApplyFilterBankWindow(const NsVectorMath& vector_math,
+                           ArrayView<float, kFftSize> x) {
+  vector_math.Multiply(kFilterBankWindow, x, x);
 }
 
 // Extends a frame with previous data.
@@ -144,46 +157,6 @@ float ComputeEnergyOfExtendedFrame(
   return energy;
 }
 
-// Computes the magnitude spectrum based on an FFT output.
-void ComputeMagnitudeSpectrum(
-    ArrayView<const float, kFftSize> real,
-    ArrayView<const float, kFftSize> imag,
-    ArrayView<float, kFftSizeBy2Plus1> signal_spectrum) {
-  signal_spectrum[0] = fabsf(real[0]) + 1.f;
-  signal_spectrum[kFftSizeBy2Plus1 - 1] =
-      fabsf(real[kFftSizeBy2Plus1 - 1]) + 1.f;
-
-  for (size_t i = 1; i < kFftSizeBy2Plus1 - 1; ++i) {
-    signal_spectrum[i] =
-        SqrtFastApproximation(real[i] * real[i] + imag[i] * imag[i]) + 1.f;
-  }
-}
-
-// Compute prior and post SNR.
-void ComputeSnr(ArrayView<const float, kFftSizeBy2Plus1> filter,
-                ArrayView<const float> prev_signal_spectrum,
-                ArrayView<const float> signal_spectrum,
-                ArrayView<const float> prev_noise_spectrum,
-                ArrayView<const float> noise_spectrum,
-                ArrayView<float> prior_snr,
-                ArrayView<float> post_snr) {
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    // Previous post SNR.
-    // Previous estimate: based on previous frame with gain filter.
-    float prev_estimate = prev_signal_spectrum[i] /
-                          (prev_noise_spectrum[i] + 0.0001f) * filter[i];
-    // Post SNR.
-    if (signal_spectrum[i] > noise_spectrum[i]) {
-      post_snr[i] = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
-    } else {
-      post_snr[i] = 0.f;
-    }
-    // The directed decision estimate of the prior SNR is a sum the current and
-    // previous estimates.
-    prior_snr[i] = 0.98f * prev_estimate + (1.f - 0.98f) * post_snr[i];
-  }
-}
-
 // Computes the attenuating gain for the noise suppression of the upper bands.
 float ComputeUpperBandsGain(
     float minimum_attenuating_gain,
@@ -240,9 +213,12 @@ float ComputeUpperBandsGain(
 
 NoiseSuppressor::ChannelState::ChannelState(
     const SuppressionParams& suppression_params,
-    size_t num_bands)
-    : wiener_filter(suppression_params),
-      noise_estimator(suppression_params),
+    size_t num_bands,
+    NsOptimization optimization)
+    : fft(optimization),
+      speech_probability_estimator(optimization),
+      wiener_filter(suppression_params, optimization),
+      noise_estimator(suppression_params, optimization),
       process_delay_memory(num_bands > 1 ? num_bands - 1 : 0) {
   analyze_analysis_memory.fill(0.f);
   prev_analysis_signal_spectrum.fill(1.f);
@@ -255,18 +231,21 @@ NoiseSuppressor::ChannelState::ChannelState(
 
 NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
                                  size_t sample_rate_hz,
-                                 size_t num_channels)
+                                 size_t num_channels,
+                                 ProcessingThreadPool* thread_pool)
     : num_bands_(NumBandsForRate(sample_rate_hz)),
       num_channels_(num_channels),
       suppression_params_(config.target_level),
+      thread_pool_(thread_pool),
+      vector_math_(DetectNsOptimization()),
       filter_bank_states_heap_(NumChannelsOnHeap(num_channels_)),
       upper_band_gains_heap_(NumChannelsOnHeap(num_channels_)),
       energies_before_filtering_heap_(NumChannelsOnHeap(num_channels_)),
       gain_adjustments_heap_(NumChannelsOnHeap(num_channels_)),
       channels_(num_channels_) {
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channels_[ch] =
-        std::make_unique<ChannelState>(suppression_params_, num_bands_);
+    channels_[ch] = std::make_unique<ChannelState>(
+        suppression_params_, num_bands_, vector_math_.optimization());
   }
 }
 
@@ -323,7 +302,7 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
   }
 
   // Analyze all channels.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
+  ParallelFor(thread_pool_, num_channels_, [&](size_t ch) {
     std::unique_ptr<ChannelState>& ch_p = channels_[ch];
     ArrayView<const float, kNsFrameSize> y_band0(
         &audio.split_bands_const(ch)[0][0], kNsFrameSize);
@@ -331,15 +310,15 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
     // Form an extended frame and apply analysis filter bank windowing.
     std::array<float, kFftSize> extended_frame;
     FormExtendedFrame(y_band0, ch_p->analyze_analysis_memory, extended_frame);
-    ApplyFilterBankWindow(extended_frame);
+    ApplyFilterBankWindow(vector_math_, extended_frame);
 
     // Compute the magnitude spectrum.
     std::array<float, kFftSize> real;
     std::array<float, kFftSize> imag;
-    fft_.Fft(extended_frame, real, imag);
+    ch_p->fft.Fft(extended_frame, real, imag);
 
     std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(real, imag, signal_spectrum);
+    vector_math_.MagnitudeSpectrum(real, imag, signal_spectrum);
 
     // Compute energies.
     float signal_energy = 0.f;
@@ -360,10 +339,11 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
 
     std::array<float, kFftSizeBy2Plus1> post_snr;
     std::array<float, kFftSizeBy2Plus1> prior_snr;
-    ComputeSnr(ch_p->wiener_filter.get_filter(),
-               ch_p->prev_analysis_signal_spectrum, signal_spectrum,
-               ch_p->noise_estimator.get_prev_noise_spectrum(),
-               ch_p->noise_estimator.get_noise_spectrum(), prior_snr, post_snr);
+    vector_math_.Snr(ch_p->wiener_filter.get_filter(),
+                     ch_p->prev_analysis_signal_spectrum, signal_spectrum,
+                     ch_p->noise_estimator.get_prev_noise_spectrum(),
+                     ch_p->noise_estimator.get_noise_spectrum(), prior_snr,
+                     post_snr);
 
     ch_p->speech_probability_estimator.Update(
         num_analyzed_frames_, prior_snr, post_snr,
@@ -377,7 +357,7 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
     // method.
     std::copy(signal_spectrum.begin(), signal_spectrum.end(),
               ch_p->prev_analysis_signal_spectrum.begin());
-  }
+  });
 }
 
 void NoiseSuppressor::Process(AudioBuffer* audio) {
@@ -408,7 +388,7 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
   }
 
   // Compute the suppression filters for all channels.
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
+  ParallelFor(thread_pool_, num_channels_, [&](size_t ch) {
     // Form an extended frame and apply analysis filter bank windowing.
     ArrayView<float, kNsFrameSize> y_band0(&audio->split_bands(ch)[0][0],
                                            kNsFrameSize);
@@ -416,18 +396,20 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
     FormExtendedFrame(y_band0, channels_[ch]->process_analysis_memory,
                       filter_bank_states[ch].extended_frame);
 
-    ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
+    ApplyFilterBankWindow(vector_math_, filter_bank_states[ch].extended_frame);
 
     energies_before_filtering[ch] =
         ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
 
     // Perform filter bank analysis and compute the magnitude spectrum.
-    fft_.Fft(filter_bank_states[ch].extended_frame, filter_bank_states[ch].real,
-             filter_bank_states[ch].imag);
+    channels_[ch]->fft.Fft(filter_bank_states[ch].extended_frame,
+                           filter_bank_states[ch].real,
+                           filter_bank_states[ch].imag);
 
     std::array<float, kFftSizeBy2Plus1> signal_spectrum;
-    ComputeMagnitudeSpectrum(filter_bank_states[ch].real,
-                             filter_bank_states[ch].imag, signal_spectrum);
+    vector_math_.MagnitudeSpectrum(filter_bank_states[ch].real,
+                                   filter_bank_states[ch].imag,
+                                   signal_spectrum);
 
     // Compute the frequency domain gain filter for noise attenuation.
     channels_[ch]->wiener_filter.Update(
@@ -447,7 +429,7 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
           channels_[ch]->speech_probability_estimator.get_probability(),
           channels_[ch]->prev_analysis_signal_spectrum, signal_spectrum);
     }
-  }
+  });
 
   // Only do the below processing if the output of the audio processing module
   // is used.
@@ -464,26 +446,25 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
     AggregateWienerFilters(filter_data);
   }
 
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
+  ParallelFor(thread_pool_, num_channels_, [&](size_t ch) {
     // Apply the filter to the lower band.
-    for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-      filter_bank_states[ch].real[i] *= filter[i];
-      filter_bank_states[ch].imag[i] *= filter[i];
-    }
-  }
-
-  // Perform filter bank synthesis
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    fft_.Ifft(filter_bank_states[ch].real, filter_bank_states[ch].imag,
-              filter_bank_states[ch].extended_frame);
-  }
+    ArrayView<float> real(filter_bank_states[ch].real.data(),
+                          kFftSizeBy2Plus1);
+    ArrayView<float> imag(filter_bank_states[ch].imag.data(),
+                          kFftSizeBy2Plus1);
+    vector_math_.Multiply(filter, real, real);
+    vector_math_.Multiply(filter, imag, imag);
+
+    // Perform filter bank synthesis
+    channels_[ch]->fft.Ifft(filter_bank_states[ch].real,
+                            filter_bank_states[ch].imag,
+                            filter_bank_states[ch].extended_frame);
 
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
     const float energy_after_filtering =
         ComputeEnergyOfExtendedFrame(filter_bank_states[ch].extended_frame);
 
     // Apply synthesis window.
-    ApplyFilterBankWindow(filter_bank_states[ch].extended_frame);
+    ApplyFilterBankWindow(vector_math_, filter_bank_states[ch].extended_frame);
 
     // Compute the adjustment of the noise attenuation filter based on the
     // effect of the attenuation.
@@ -492,7 +473,7 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
             num_analyzed_frames_,
             channels_[ch]->speech_probability_estimator.get_prior_probability(),
             energies_before_filtering[ch], energy_after_filtering);
-  }
+  });
 
   // Select and apply adjustment of the noise attenuation filter based on the
   // effect of the attenuation.
@@ -501,10 +482,8 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
     gain_adjustment = std::min(gain_adjustment, gain_adjustments[ch]);
   }
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    for (size_t i = 0; i < kFftSize; ++i) {
-      filter_bank_states[ch].extended_frame[i] =
-          gain_adjustment * filter_bank_states[ch].extended_frame[i];
-    }
+    vector_math_.Scale(gain_adjustment, filter_bank_states[ch].extended_frame,
+                       filter_bank_states[ch].extended_frame);
   }
 
   // Use overlap-and-add to form the output frame of the lowest band.
@@ -534,9 +513,7 @@ void NoiseSuppressor::Process(AudioBuffer* audio) {
                     delayed_frame);
 
         // Apply the time-domain noise-attenuating gain.
-        for (size_t j = 0; j < kNsFrameSize; j++) {
-          y_band[j] = upper_band_gain * delayed_frame[j];
-        }
+        vector_math_.Scale(upper_band_gain, delayed_frame, y_band);
       }
     }
   }
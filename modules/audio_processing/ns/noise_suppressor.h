@@ -20,17 +20,23 @@
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/ns_config.h"
 #include "modules/audio_processing/ns/ns_fft.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/speech_probability_estimator.h"
 #include "modules/audio_processing/ns/wiener_filter.h"
+#include "modules/audio_processing/utility/processing_thread_pool.h"
 
 namespace webrtc {
 
 // Class for suppressing noise in a signal.
 class NoiseSuppressor {
  public:
+  // If `thread_pool` is non-null, the per-channel analysis and filtering is
+  // split across its threads. The output is identical to that of the serial
+  // processing. The pool must outlive the noise suppressor.
   NoiseSuppressor(const NsConfig& config,
                   size_t sample_rate_hz,
-                  size_t num_channels);
+                  size_t num_channels,
+                  ProcessingThreadPool* thread_pool = nullptr);
   NoiseSuppressor(const NoiseSuppressor&) = delete;
   NoiseSuppressor& operator=(const NoiseSuppressor&) = delete;
 
@@ -53,13 +59,19 @@ class NoiseSuppressor {
   const size_t num_bands_;
   const size_t num_channels_;
   const SuppressionParams suppression_params_;
+  ProcessingThreadPool* const thread_pool_;
+  const NsVectorMath vector_math_;
   int32_t num_analyzed_frames_ = -1;
-  NrFft fft_;
   bool capture_output_used_ = true;
 
   struct ChannelState {
-    ChannelState(const SuppressionParams& suppression_params, size_t num_bands);
+    ChannelState(const SuppressionParams& suppression_params,
+                 size_t num_bands,
+                 NsOptimization optimization);
 
+    // Per channel, since the FFT keeps scratch state and the channels may be
+    // processed concurrently.
+    NrFft fft;
     SpeechProbabilityEstimator speech_probability_estimator;
     WienerFilter wiener_filter;
     NoiseEstimator noise_estimator;
@@ -0,0 +1,171 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+
+#include <array>
+
+#include "benchmark/benchmark.h"
+#include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/ns/noise_suppressor.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_config.h"
+#include "modules/audio_processing/ns/ns_fft.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
+#include "modules/audio_processing/ns/quantile_noise_estimator.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace webrtc {
+namespace {
+
+bool IsSupported(NsOptimization optimization) {
+  switch (optimization) {
+    case NsOptimization::kNone:
+      return true;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2:
+      return GetCPUInfo(kSSE2) != 0;
+    case NsOptimization::kAvx2:
+      return GetCPUInfo(kAVX2) != 0;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+// Analysis and processing of one 10 ms frame, using the optimization detected
+// for the CPU.
+void BM_NoiseSuppressorFrame(benchmark::State& state) {
+  const int sample_rate_hz = state.range(0);
+  const size_t num_channels = state.range(1);
+  AudioBuffer audio(sample_rate_hz, num_channels, sample_rate_hz, num_channels,
+                    sample_rate_hz, num_channels);
+  NoiseSuppressor suppressor(NsConfig(), sample_rate_hz, num_channels);
+  Random random(42);
+  const size_t num_frames = audio.num_frames();
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (size_t ch = 0; ch < num_channels; ++ch) {
+      for (size_t i = 0; i < num_frames; ++i) {
+        audio.channels()[ch][i] = random.Gaussian(0, 1000);
+      }
+    }
+    if (sample_rate_hz > 16000) {
+      audio.SplitIntoFrequencyBands();
+    }
+    state.ResumeTiming();
+    suppressor.Analyze(audio);
+    suppressor.Process(&audio);
+  }
+}
+
+// The per-bin spectral work of the analysis and processing of one 10 ms frame
+// in one channel, for the optimization given by the argument.
+void BM_NsVectorMathFrame(benchmark::State& state) {
+  const NsOptimization optimization =
+      static_cast<NsOptimization>(state.range(0));
+  if (!IsSupported(optimization)) {
+    state.SkipWithError("Optimization not supported");
+    return;
+  }
+  const NsVectorMath vector_math(optimization);
+  NrFft fft(optimization);
+  Random random(42);
+
+  std::array<float, kFftSize> time_data;
+  std::array<float, kFftSize> window;
+  for (size_t i = 0; i < kFftSize; ++i) {
+    time_data[i] = random.Gaussian(0, 1000);
+    window[i] = random.Rand<float>();
+  }
+  std::array<float, kFftSizeBy2Plus1> filter;
+  std::array<float, kFftSizeBy2Plus1> prev_signal_spectrum;
+  std::array<float, kFftSizeBy2Plus1> prev_noise_spectrum;
+  std::array<float, kFftSizeBy2Plus1> noise_spectrum;
+  std::array<float, kFftSizeBy2Plus1> conservative_noise_spectrum;
+  std::array<float, kFftSizeBy2Plus1> inverse_lrt;
+  std::array<float, kSimult * kFftSizeBy2Plus1> log_quantile;
+  std::array<float, kSimult * kFftSizeBy2Plus1> density;
+  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+    filter[i] = random.Rand<float>();
+    prev_signal_spectrum[i] = 1.f + 1000.f * random.Rand<float>();
+    prev_noise_spectrum[i] = 1.f + 1000.f * random.Rand<float>();
+    noise_spectrum[i] = 1.f + 1000.f * random.Rand<float>();
+    conservative_noise_spectrum[i] = 1.f + 1000.f * random.Rand<float>();
+    inverse_lrt[i] = random.Rand<float>();
+  }
+  log_quantile.fill(8.f);
+  density.fill(0.3f);
+
+  std::array<float, kFftSize> extended_frame;
+  std::array<float, kFftSize> real;
+  std::array<float, kFftSize> imag;
+  std::array<float, kFftSizeBy2Plus1> signal_spectrum;
+  std::array<float, kFftSizeBy2Plus1> log_spectrum;
+  std::array<float, kFftSizeBy2Plus1> prior_snr;
+  std::array<float, kFftSizeBy2Plus1> post_snr;
+  std::array<float, kFftSizeBy2Plus1> speech_probability;
+  for (auto _ : state) {
+    // Analysis.
+    vector_math.Multiply(window, time_data, extended_frame);
+    fft.Fft(extended_frame, real, imag);
+    vector_math.MagnitudeSpectrum(real, imag, signal_spectrum);
+    vector_math.Log(signal_spectrum, log_spectrum);
+    for (int s = 0; s < kSimult; ++s) {
+      vector_math.QuantileUpdate(
+          log_spectrum, 100,
+          ArrayView<float, kFftSizeBy2Plus1>(
+              &log_quantile[s * kFftSizeBy2Plus1], kFftSizeBy2Plus1),
+          ArrayView<float, kFftSizeBy2Plus1>(&density[s * kFftSizeBy2Plus1],
+                                             kFftSizeBy2Plus1));
+    }
+    vector_math.Snr(filter, prev_signal_spectrum, signal_spectrum,
+                    prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+    vector_math.SpeechProbability(0.5f, inverse_lrt, speech_probability);
+    vector_math.NoiseUpdate(speech_probability, signal_spectrum,
+                            prev_noise_spectrum, conservative_noise_spectrum,
+                            noise_spectrum);
+
+    // Processing.
+    vector_math.Multiply(window, time_data, extended_frame);
+    fft.Fft(extended_frame, real, imag);
+    vector_math.MagnitudeSpectrum(real, imag, signal_spectrum);
+    vector_math.Snr(filter, prev_signal_spectrum, signal_spectrum,
+                    prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+    vector_math.WienerGain(1.f, 0.1f, prior_snr, filter);
+    ArrayView<float> real_bins(real.data(), kFftSizeBy2Plus1);
+    ArrayView<float> imag_bins(imag.data(), kFftSizeBy2Plus1);
+    vector_math.Multiply(filter, real_bins, real_bins);
+    vector_math.Multiply(filter, imag_bins, imag_bins);
+    fft.Ifft(real, imag, extended_frame);
+    vector_math.Multiply(window, extended_frame, extended_frame);
+    vector_math.Scale(0.9f, extended_frame, extended_frame);
+    benchmark::DoNotOptimize(extended_frame.data());
+  }
+}
+
+BENCHMARK(BM_NoiseSuppressorFrame)
+    ->ArgNames({"rate", "channels"})
+    ->Args({16000, 1})
+    ->Args({48000, 1})
+    ->Args({48000, 2});
+BENCHMARK(BM_NsVectorMathFrame)
+    ->ArgName("optimization")
+    ->DenseRange(static_cast<int>(NsOptimization::kNone),
+                 static_cast<int>(NsOptimization::kNeon));
+
+}  // namespace
+}  // namespace webrtc
@@ -16,6 +16,8 @@
 #include <utility>
 #include <vector>
 
+#include "modules/audio_processing/utility/processing_thread_pool.h"
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -61,6 +63,22 @@ void VerifyIdenticalChannels(size_t num_channels,
   }
 }
 
+void PopulateInputFrameWithNoise(Random& random,
+                                 size_t num_channels,
+                                 size_t num_bands,
+                                 AudioBuffer* audio) {
+  for (size_t ch = 0; ch < num_channels; ++ch) {
+    // Different levels per channel, so that the channels differ in their
+    // estimates.
+    const float amplitude = 1000.f * (ch + 1);
+    for (size_t b = 0; b < num_bands; ++b) {
+      for (size_t i = 0; i < 160; ++i) {
+        audio->split_bands(ch)[b][i] = random.Gaussian(0.f, amplitude);
+      }
+    }
+  }
+}
+
 }  // namespace
 
 // Verifies that the same noise reduction effect is applied to all channels.
@@ -99,4 +117,45 @@ TEST(NoiseSuppressor, IdenticalChannelEffects) {
   }
 }
 
+// Verifies that splitting the channels across threads does not change the
+// output.
+TEST(NoiseSuppressor, ParallelProcessingIsBitExact) {
+  constexpr int kRate = 48000;
+  constexpr size_t kNumBands = 3;
+  constexpr size_t kNumChannels = 6;
+  ProcessingThreadPool thread_pool(3);
+  NsConfig cfg;
+  NoiseSuppressor serial_ns(cfg, kRate, kNumChannels);
+  NoiseSuppressor parallel_ns(cfg, kRate, kNumChannels, &thread_pool);
+  AudioBuffer serial_audio(kRate, kNumChannels, kRate, kNumChannels, kRate,
+                           kNumChannels);
+  AudioBuffer parallel_audio(kRate, kNumChannels, kRate, kNumChannels, kRate,
+                             kNumChannels);
+  Random serial_random(42);
+  Random parallel_random(42);
+  for (size_t frame_index = 0; frame_index < 300; ++frame_index) {
+    serial_audio.SplitIntoFrequencyBands();
+    parallel_audio.SplitIntoFrequencyBands();
+    PopulateInputFrameWithNoise(serial_random, kNumChannels, kNumBands,
+                                &serial_audio);
+    PopulateInputFrameWithNoise(parallel_random, kNumChannels, kNumBands,
+                                &parallel_audio);
+
+    serial_ns.Analyze(serial_audio);
+    serial_ns.Process(&serial_audio);
+    parallel_ns.Analyze(parallel_audio);
+    parallel_ns.Process(&parallel_audio);
+
+    for (size_t ch = 0; ch < kNumChannels; ++ch) {
+      for (size_t b = 0; b < kNumBands; ++b) {
+        for (size_t i = 0; i < 160; ++i) {
+          ASSERT_EQ(parallel_audio.split_bands_const(ch)[b][i],
+                    serial_audio.split_bands_const(ch)[b][i])
+              << "frame " << frame_index << ", channel " << ch;
+        }
+      }
+    }
+  }
+}
+
 }  // namespace webrtc
@@ -11,10 +11,14 @@
 #include "modules/audio_processing/ns/ns_fft.h"
 
 #include "common_audio/third_party/ooura/fft_size_256/fft4g.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 
 namespace webrtc {
 
-NrFft::NrFft() : bit_reversal_state_(kFftSize / 2), tables_(kFftSize / 2) {
+NrFft::NrFft(NsOptimization optimization)
+    : bit_reversal_state_(kFftSize / 2),
+      tables_(kFftSize / 2),
+      vector_math_(optimization) {
   // Initialize WebRtc_rdt (setting (bit_reversal_state_[0] to 0 triggers
   // initialization)
   bit_reversal_state_[0] = 0.f;
@@ -30,35 +34,28 @@ void NrFft::Fft(ArrayView<float, kFftSize> time_data,
   WebRtc_rdft(kFftSize, 1, time_data.data(), bit_reversal_state_.data(),
               tables_.data());
 
+  // The packed output holds the real parts of the DC and Nyquist components
+  // at indices 0 and 1.
+  vector_math_.Deinterleave(time_data, real.subview(0, kFftSize / 2),
+                            imag.subview(0, kFftSize / 2));
   imag[0] = 0;
-  real[0] = time_data[0];
 
   imag[kFftSizeBy2Plus1 - 1] = 0;
   real[kFftSizeBy2Plus1 - 1] = time_data[1];
-
-  for (size_t i = 1; i < kFftSizeBy2Plus1 - 1; ++i) {
-    real[i] = time_data[2 * i];
-    imag[i] = time_data[2 * i + 1];
-  }
 }
 
 void NrFft::Ifft(ArrayView<const float> real,
                  ArrayView<const float> imag,
                  ArrayView<float> time_data) {
-  time_data[0] = real[0];
+  vector_math_.Interleave(real.subview(0, kFftSize / 2),
+                          imag.subview(0, kFftSize / 2), time_data);
   time_data[1] = real[kFftSizeBy2Plus1 - 1];
-  for (size_t i = 1; i < kFftSizeBy2Plus1 - 1; ++i) {
-    time_data[2 * i] = real[i];
-    time_data[2 * i + 1] = imag[i];
-  }
   WebRtc_rdft(kFftSize, -1, time_data.data(), bit_reversal_state_.data(),
               tables_.data());
 
   // Scale the output
   constexpr float kScaling = 2.f / kFftSize;
-  for (float& d : time_data) {
-    d *= kScaling;
-  }
+  vector_math_.Scale(kScaling, time_data, time_data);
 }
 
 }  // namespace webrtc
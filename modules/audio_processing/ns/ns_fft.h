@@ -15,13 +15,14 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 
 namespace webrtc {
 
 // Wrapper class providing 256 point FFT functionality.
 class NrFft {
  public:
-  NrFft();
+  explicit NrFft(NsOptimization optimization);
   NrFft(const NrFft&) = delete;
   NrFft& operator=(const NrFft&) = delete;
 
@@ -38,6 +39,7 @@ class NrFft {
  private:
   std::vector<size_t> bit_reversal_state_;
   std::vector<float> tables_;
+  const NsVectorMath vector_math_;
 };
 
 }  // namespace webrtc
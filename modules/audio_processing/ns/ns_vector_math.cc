@@ -0,0 +1,757 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/ns_vector_math.h"
+
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#include <math.h>
+
+#include <algorithm>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/fast_math.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "rtc_base/checks.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr float kNoiseUpdate = 0.9f;
+constexpr float kSpeechNoiseUpdate = 0.99f;
+constexpr float kProbRange = 0.2f;
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Returns the elements of `a` where `mask` is set and those of `b` elsewhere.
+__m128 Select(__m128 mask, __m128 a, __m128 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+#endif
+
+void SnrBin(size_t i,
+            ArrayView<const float, kFftSizeBy2Plus1> filter,
+            ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+            ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+            ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+            ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+            ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+            ArrayView<float, kFftSizeBy2Plus1> post_snr) {
+  // Previous estimate: based on previous frame with gain filter.
+  float prev_estimate = prev_signal_spectrum[i] /
+                        (prev_noise_spectrum[i] + 0.0001f) * filter[i];
+  // Post SNR.
+  if (signal_spectrum[i] > noise_spectrum[i]) {
+    post_snr[i] = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
+  } else {
+    post_snr[i] = 0.f;
+  }
+  // The directed decision estimate of the prior SNR is a sum the current and
+  // previous estimates.
+  prior_snr[i] = 0.98f * prev_estimate + (1.f - 0.98f) * post_snr[i];
+}
+
+void NoiseUpdateBin(
+    size_t i,
+    ArrayView<const float, kFftSizeBy2Plus1> speech_probability,
+    ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> conservative_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) {
+  // The time constant is increased for bins following a bin that is likely to
+  // be speech.
+  const float gamma =
+      i > 0 && speech_probability[i - 1] > kProbRange ? kSpeechNoiseUpdate
+                                                      : kNoiseUpdate;
+  const float prob_speech = speech_probability[i];
+  const float prob_non_speech = 1.f - prob_speech;
+
+  // Temporary noise update used for speech frames if update value is less
+  // than previous.
+  float noise_update_tmp =
+      gamma * prev_noise_spectrum[i] +
+      (1.f - gamma) * (prob_non_speech * signal_spectrum[i] +
+                       prob_speech * prev_noise_spectrum[i]);
+
+  const float gamma_new =
+      prob_speech > kProbRange ? kSpeechNoiseUpdate : kNoiseUpdate;
+
+  // Conservative noise_spectrum update.
+  if (prob_speech < kProbRange) {
+    conservative_noise_spectrum[i] +=
+        0.05f * (signal_spectrum[i] - conservative_noise_spectrum[i]);
+  }
+
+  // Noise_spectrum update.
+  if (gamma_new == gamma) {
+    noise_spectrum[i] = noise_update_tmp;
+  } else {
+    noise_spectrum[i] =
+        gamma_new * prev_noise_spectrum[i] +
+        (1.f - gamma_new) * (prob_non_speech * signal_spectrum[i] +
+                             prob_speech * prev_noise_spectrum[i]);
+    // Allow for noise_spectrum update downwards: If noise_spectrum update
+    // decreases the noise_spectrum, it is safe, so allow it to happen.
+    noise_spectrum[i] = std::min(noise_spectrum[i], noise_update_tmp);
+  }
+}
+
+void QuantileUpdateBin(size_t i,
+                       ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+                       int counter,
+                       float one_by_counter_plus_1,
+                       ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+                       ArrayView<float, kFftSizeBy2Plus1> density) {
+  // Update log quantile estimate.
+  const float delta = density[i] > 1.f ? 40.f / density[i] : 40.f;
+
+  const float multiplier = delta * one_by_counter_plus_1;
+  if (log_spectrum[i] > log_quantile[i]) {
+    log_quantile[i] += 0.25f * multiplier;
+  } else {
+    log_quantile[i] -= 0.75f * multiplier;
+  }
+
+  // Update density estimate.
+  constexpr float kWidth = 0.01f;
+  constexpr float kOneByWidthPlus2 = 1.f / (2.f * kWidth);
+  if (fabs(log_spectrum[i] - log_quantile[i]) < kWidth) {
+    density[i] =
+        (counter * density[i] + kOneByWidthPlus2) * one_by_counter_plus_1;
+  }
+}
+
+}  // namespace
+
+NsOptimization DetectNsOptimization() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2) != 0) {
+    return NsOptimization::kAvx2;
+  } else if (GetCPUInfo(kSSE2) != 0) {
+    return NsOptimization::kSse2;
+  }
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+  return NsOptimization::kNeon;
+#else
+  return NsOptimization::kNone;
+#endif
+}
+
+void NsVectorMath::Multiply(ArrayView<const float> x,
+                            ArrayView<const float> y,
+                            ArrayView<float> z) const {
+  RTC_DCHECK_EQ(z.size(), x.size());
+  RTC_DCHECK_EQ(z.size(), y.size());
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2:
+      for (; j + 4 <= z.size(); j += 4) {
+        const __m128 x_j = _mm_loadu_ps(&x[j]);
+        const __m128 y_j = _mm_loadu_ps(&y[j]);
+        _mm_storeu_ps(&z[j], _mm_mul_ps(x_j, y_j));
+      }
+      break;
+    case NsOptimization::kAvx2:
+      j = MultiplyAVX2(x, y, z);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      for (; j + 4 <= z.size(); j += 4) {
+        const float32x4_t x_j = vld1q_f32(&x[j]);
+        const float32x4_t y_j = vld1q_f32(&y[j]);
+        vst1q_f32(&z[j], vmulq_f32(x_j, y_j));
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < z.size(); ++j) {
+    z[j] = x[j] * y[j];
+  }
+}
+
+void NsVectorMath::Scale(float gain,
+                         ArrayView<const float> x,
+                         ArrayView<float> y) const {
+  RTC_DCHECK_EQ(y.size(), x.size());
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 g = _mm_set1_ps(gain);
+      for (; j + 4 <= y.size(); j += 4) {
+        _mm_storeu_ps(&y[j], _mm_mul_ps(g, _mm_loadu_ps(&x[j])));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = ScaleAVX2(gain, x, y);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      for (; j + 4 <= y.size(); j += 4) {
+        vst1q_f32(&y[j], vmulq_n_f32(vld1q_f32(&x[j]), gain));
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < y.size(); ++j) {
+    y[j] = gain * x[j];
+  }
+}
+
+void NsVectorMath::Deinterleave(ArrayView<const float> x,
+                                ArrayView<float> even,
+                                ArrayView<float> odd) const {
+  RTC_DCHECK_EQ(even.size(), odd.size());
+  RTC_DCHECK_EQ(x.size(), 2 * even.size());
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2:
+      for (; j + 4 <= even.size(); j += 4) {
+        const __m128 a = _mm_loadu_ps(&x[2 * j]);
+        const __m128 b = _mm_loadu_ps(&x[2 * j + 4]);
+        _mm_storeu_ps(&even[j], _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(&odd[j], _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+      }
+      break;
+    case NsOptimization::kAvx2:
+      j = DeinterleaveAVX2(x, even, odd);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      for (; j + 4 <= even.size(); j += 4) {
+        const float32x4x2_t x_j = vld2q_f32(&x[2 * j]);
+        vst1q_f32(&even[j], x_j.val[0]);
+        vst1q_f32(&odd[j], x_j.val[1]);
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < even.size(); ++j) {
+    even[j] = x[2 * j];
+    odd[j] = x[2 * j + 1];
+  }
+}
+
+void NsVectorMath::Interleave(ArrayView<const float> even,
+                              ArrayView<const float> odd,
+                              ArrayView<float> x) const {
+  RTC_DCHECK_EQ(even.size(), odd.size());
+  RTC_DCHECK_EQ(x.size(), 2 * even.size());
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2:
+      for (; j + 4 <= even.size(); j += 4) {
+        const __m128 a = _mm_loadu_ps(&even[j]);
+        const __m128 b = _mm_loadu_ps(&odd[j]);
+        _mm_storeu_ps(&x[2 * j], _mm_unpacklo_ps(a, b));
+        _mm_storeu_ps(&x[2 * j + 4], _mm_unpackhi_ps(a, b));
+      }
+      break;
+    case NsOptimization::kAvx2:
+      j = InterleaveAVX2(even, odd, x);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      for (; j + 4 <= even.size(); j += 4) {
+        float32x4x2_t x_j;
+        x_j.val[0] = vld1q_f32(&even[j]);
+        x_j.val[1] = vld1q_f32(&odd[j]);
+        vst2q_f32(&x[2 * j], x_j);
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < even.size(); ++j) {
+    x[2 * j] = even[j];
+    x[2 * j + 1] = odd[j];
+  }
+}
+
+void NsVectorMath::MagnitudeSpectrum(
+    ArrayView<const float, kFftSize> real,
+    ArrayView<const float, kFftSize> imag,
+    ArrayView<float, kFftSizeBy2Plus1> spectrum) const {
+  spectrum[0] = fabsf(real[0]) + 1.f;
+  spectrum[kFftSizeBy2Plus1 - 1] = fabsf(real[kFftSizeBy2Plus1 - 1]) + 1.f;
+
+  constexpr size_t kLastBin = kFftSizeBy2Plus1 - 1;
+  size_t j = 1;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 one = _mm_set1_ps(1.f);
+      for (; j + 4 <= kLastBin; j += 4) {
+        const __m128 re = _mm_loadu_ps(&real[j]);
+        const __m128 im = _mm_loadu_ps(&imag[j]);
+        const __m128 power =
+            _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        _mm_storeu_ps(&spectrum[j], _mm_add_ps(_mm_sqrt_ps(power), one));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = MagnitudeSpectrumAVX2(real, imag, spectrum);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon:
+      for (; j + 4 <= kLastBin; j += 4) {
+        const float32x4_t re = vld1q_f32(&real[j]);
+        const float32x4_t im = vld1q_f32(&imag[j]);
+        const float32x4_t power =
+            vaddq_f32(vmulq_f32(re, re), vmulq_f32(im, im));
+#if defined(WEBRTC_ARCH_ARM64)
+        vst1q_f32(&spectrum[j], vaddq_f32(vsqrtq_f32(power), vdupq_n_f32(1.f)));
+#else
+        // The reciprocal square root estimate of ARMv7 is not exact, so the
+        // square root is computed per bin.
+        vst1q_f32(&spectrum[j], power);
+        for (size_t k = j; k < j + 4; ++k) {
+          spectrum[k] = SqrtFastApproximation(spectrum[k]) + 1.f;
+        }
+#endif
+      }
+      break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kLastBin; ++j) {
+    spectrum[j] =
+        SqrtFastApproximation(real[j] * real[j] + imag[j] * imag[j]) + 1.f;
+  }
+}
+
+void NsVectorMath::Snr(
+    ArrayView<const float, kFftSizeBy2Plus1> filter,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    ArrayView<float, kFftSizeBy2Plus1> post_snr) const {
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 epsilon = _mm_set1_ps(0.0001f);
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 prev_weight = _mm_set1_ps(0.98f);
+      const __m128 current_weight = _mm_set1_ps(1.f - 0.98f);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const __m128 prev_noise =
+            _mm_add_ps(_mm_loadu_ps(&prev_noise_spectrum[j]), epsilon);
+        const __m128 prev_estimate = _mm_mul_ps(
+            _mm_div_ps(_mm_loadu_ps(&prev_signal_spectrum[j]), prev_noise),
+            _mm_loadu_ps(&filter[j]));
+        const __m128 signal = _mm_loadu_ps(&signal_spectrum[j]);
+        const __m128 noise = _mm_loadu_ps(&noise_spectrum[j]);
+        const __m128 post = _mm_and_ps(
+            _mm_cmpgt_ps(signal, noise),
+            _mm_sub_ps(_mm_div_ps(signal, _mm_add_ps(noise, epsilon)), one));
+        _mm_storeu_ps(&post_snr[j], post);
+        _mm_storeu_ps(&prior_snr[j],
+                      _mm_add_ps(_mm_mul_ps(prev_weight, prev_estimate),
+                                 _mm_mul_ps(current_weight, post)));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = SnrAVX2(filter, prev_signal_spectrum, signal_spectrum,
+                  prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+      break;
+#endif
+// Vector division is only available on AArch64.
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t epsilon = vdupq_n_f32(0.0001f);
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t zero = vdupq_n_f32(0.f);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const float32x4_t prev_noise =
+            vaddq_f32(vld1q_f32(&prev_noise_spectrum[j]), epsilon);
+        const float32x4_t prev_estimate = vmulq_f32(
+            vdivq_f32(vld1q_f32(&prev_signal_spectrum[j]), prev_noise),
+            vld1q_f32(&filter[j]));
+        const float32x4_t signal = vld1q_f32(&signal_spectrum[j]);
+        const float32x4_t noise = vld1q_f32(&noise_spectrum[j]);
+        const float32x4_t post = vbslq_f32(
+            vcgtq_f32(signal, noise),
+            vsubq_f32(vdivq_f32(signal, vaddq_f32(noise, epsilon)), one),
+            zero);
+        vst1q_f32(&post_snr[j], post);
+        vst1q_f32(&prior_snr[j],
+                  vaddq_f32(vmulq_n_f32(prev_estimate, 0.98f),
+                            vmulq_n_f32(post, 1.f - 0.98f)));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kFftSizeBy2Plus1; ++j) {
+    SnrBin(j, filter, prev_signal_spectrum, signal_spectrum,
+           prev_noise_spectrum, noise_spectrum, prior_snr, post_snr);
+  }
+}
+
+void NsVectorMath::WienerGain(
+    float over_subtraction_factor,
+    float minimum_gain,
+    ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    ArrayView<float, kFftSizeBy2Plus1> filter) const {
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 factor = _mm_set1_ps(over_subtraction_factor);
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 min_gain = _mm_set1_ps(minimum_gain);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const __m128 snr = _mm_loadu_ps(&prior_snr[j]);
+        __m128 gain = _mm_div_ps(snr, _mm_add_ps(factor, snr));
+        // The argument order matches that of std::min and std::max.
+        gain = _mm_max_ps(min_gain, _mm_min_ps(one, gain));
+        _mm_storeu_ps(&filter[j], gain);
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = WienerGainAVX2(over_subtraction_factor, minimum_gain, prior_snr,
+                         filter);
+      break;
+#endif
+// Vector division is only available on AArch64.
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t factor = vdupq_n_f32(over_subtraction_factor);
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t min_gain = vdupq_n_f32(minimum_gain);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const float32x4_t snr = vld1q_f32(&prior_snr[j]);
+        float32x4_t gain = vdivq_f32(snr, vaddq_f32(factor, snr));
+        gain = vbslq_f32(vcltq_f32(one, gain), one, gain);
+        gain = vbslq_f32(vcltq_f32(gain, min_gain), min_gain, gain);
+        vst1q_f32(&filter[j], gain);
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kFftSizeBy2Plus1; ++j) {
+    filter[j] = prior_snr[j] / (over_subtraction_factor + prior_snr[j]);
+    filter[j] = std::max(std::min(filter[j], 1.f), minimum_gain);
+  }
+}
+
+void NsVectorMath::SpeechProbability(
+    float gain_prior,
+    ArrayView<const float, kFftSizeBy2Plus1> inverse_lrt,
+    ArrayView<float, kFftSizeBy2Plus1> speech_probability) const {
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 g = _mm_set1_ps(gain_prior);
+      const __m128 one = _mm_set1_ps(1.f);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const __m128 denominator =
+            _mm_add_ps(one, _mm_mul_ps(g, _mm_loadu_ps(&inverse_lrt[j])));
+        _mm_storeu_ps(&speech_probability[j], _mm_div_ps(one, denominator));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = SpeechProbabilityAVX2(gain_prior, inverse_lrt, speech_probability);
+      break;
+#endif
+// Vector division is only available on AArch64.
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t one = vdupq_n_f32(1.f);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const float32x4_t denominator =
+            vaddq_f32(one, vmulq_n_f32(vld1q_f32(&inverse_lrt[j]), gain_prior));
+        vst1q_f32(&speech_probability[j], vdivq_f32(one, denominator));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kFftSizeBy2Plus1; ++j) {
+    speech_probability[j] = 1.f / (1.f + gain_prior * inverse_lrt[j]);
+  }
+}
+
+void NsVectorMath::NoiseUpdate(
+    ArrayView<const float, kFftSizeBy2Plus1> speech_probability,
+    ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> conservative_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) const {
+  NoiseUpdateBin(0, speech_probability, signal_spectrum, prev_noise_spectrum,
+                 conservative_noise_spectrum, noise_spectrum);
+  size_t j = 1;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 prob_range = _mm_set1_ps(kProbRange);
+      const __m128 noise_update = _mm_set1_ps(kNoiseUpdate);
+      const __m128 speech_noise_update = _mm_set1_ps(kSpeechNoiseUpdate);
+      const __m128 conservative_rate = _mm_set1_ps(0.05f);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const __m128 prob_speech = _mm_loadu_ps(&speech_probability[j]);
+        const __m128 prob_non_speech = _mm_sub_ps(one, prob_speech);
+        const __m128 gamma = Select(
+            _mm_cmpgt_ps(_mm_loadu_ps(&speech_probability[j - 1]), prob_range),
+            speech_noise_update, noise_update);
+        const __m128 gamma_new =
+            Select(_mm_cmpgt_ps(prob_speech, prob_range), speech_noise_update,
+                   noise_update);
+        const __m128 signal = _mm_loadu_ps(&signal_spectrum[j]);
+        const __m128 prev_noise = _mm_loadu_ps(&prev_noise_spectrum[j]);
+        const __m128 mixed = _mm_add_ps(_mm_mul_ps(prob_non_speech, signal),
+                                        _mm_mul_ps(prob_speech, prev_noise));
+        const __m128 noise_update_tmp =
+            _mm_add_ps(_mm_mul_ps(gamma, prev_noise),
+                       _mm_mul_ps(_mm_sub_ps(one, gamma), mixed));
+        const __m128 noise_update_new =
+            _mm_add_ps(_mm_mul_ps(gamma_new, prev_noise),
+                       _mm_mul_ps(_mm_sub_ps(one, gamma_new), mixed));
+        _mm_storeu_ps(&noise_spectrum[j],
+                      Select(_mm_cmpeq_ps(gamma_new, gamma), noise_update_tmp,
+                             _mm_min_ps(noise_update_tmp, noise_update_new)));
+
+        const __m128 conservative =
+            _mm_loadu_ps(&conservative_noise_spectrum[j]);
+        const __m128 conservative_updated = _mm_add_ps(
+            conservative,
+            _mm_mul_ps(conservative_rate, _mm_sub_ps(signal, conservative)));
+        _mm_storeu_ps(&conservative_noise_spectrum[j],
+                      Select(_mm_cmplt_ps(prob_speech, prob_range),
+                             conservative_updated, conservative));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = NoiseUpdateAVX2(speech_probability, signal_spectrum,
+                          prev_noise_spectrum, conservative_noise_spectrum,
+                          noise_spectrum);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon: {
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t prob_range = vdupq_n_f32(kProbRange);
+      const float32x4_t noise_update = vdupq_n_f32(kNoiseUpdate);
+      const float32x4_t speech_noise_update = vdupq_n_f32(kSpeechNoiseUpdate);
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const float32x4_t prob_speech = vld1q_f32(&speech_probability[j]);
+        const float32x4_t prob_non_speech = vsubq_f32(one, prob_speech);
+        const float32x4_t gamma =
+            vbslq_f32(vcgtq_f32(vld1q_f32(&speech_probability[j - 1]),
+                                prob_range),
+                      speech_noise_update, noise_update);
+        const float32x4_t gamma_new =
+            vbslq_f32(vcgtq_f32(prob_speech, prob_range), speech_noise_update,
+                      noise_update);
+        const float32x4_t signal = vld1q_f32(&signal_spectrum[j]);
+        const float32x4_t prev_noise = vld1q_f32(&prev_noise_spectrum[j]);
+        const float32x4_t mixed = vaddq_f32(vmulq_f32(prob_non_speech, signal),
+                                            vmulq_f32(prob_speech, prev_noise));
+        const float32x4_t noise_update_tmp =
+            vaddq_f32(vmulq_f32(gamma, prev_noise),
+                      vmulq_f32(vsubq_f32(one, gamma), mixed));
+        const float32x4_t noise_update_new =
+            vaddq_f32(vmulq_f32(gamma_new, prev_noise),
+                      vmulq_f32(vsubq_f32(one, gamma_new), mixed));
+        const float32x4_t noise_update_min =
+            vbslq_f32(vcltq_f32(noise_update_tmp, noise_update_new),
+                      noise_update_tmp, noise_update_new);
+        vst1q_f32(&noise_spectrum[j],
+                  vbslq_f32(vceqq_f32(gamma_new, gamma), noise_update_tmp,
+                            noise_update_min));
+
+        const float32x4_t conservative =
+            vld1q_f32(&conservative_noise_spectrum[j]);
+        const float32x4_t conservative_updated = vaddq_f32(
+            conservative, vmulq_n_f32(vsubq_f32(signal, conservative), 0.05f));
+        vst1q_f32(&conservative_noise_spectrum[j],
+                  vbslq_f32(vcltq_f32(prob_speech, prob_range),
+                            conservative_updated, conservative));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kFftSizeBy2Plus1; ++j) {
+    NoiseUpdateBin(j, speech_probability, signal_spectrum, prev_noise_spectrum,
+                   conservative_noise_spectrum, noise_spectrum);
+  }
+}
+
+void NsVectorMath::Log(ArrayView<const float> x, ArrayView<float> y) const {
+  RTC_DCHECK_EQ(y.size(), x.size());
+  size_t j = 0;
+  // The approximation is computed as in LogApproximation(), by interpreting
+  // the bits of the value as an integer.
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 scaling = _mm_set1_ps(1.1920929e-7f);
+      const __m128 bias = _mm_set1_ps(126.942695f);
+      const __m128 log_of_2 = _mm_set1_ps(0.69314718056f);
+      for (; j + 4 <= y.size(); j += 4) {
+        __m128 log2 = _mm_cvtepi32_ps(_mm_castps_si128(_mm_loadu_ps(&x[j])));
+        log2 = _mm_sub_ps(_mm_mul_ps(log2, scaling), bias);
+        _mm_storeu_ps(&y[j], _mm_mul_ps(log2, log_of_2));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = LogAVX2(x, y);
+      break;
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case NsOptimization::kNeon: {
+      const float32x4_t bias = vdupq_n_f32(126.942695f);
+      for (; j + 4 <= y.size(); j += 4) {
+        float32x4_t log2 =
+            vcvtq_f32_u32(vreinterpretq_u32_f32(vld1q_f32(&x[j])));
+        log2 = vsubq_f32(vmulq_n_f32(log2, 1.1920929e-7f), bias);
+        vst1q_f32(&y[j], vmulq_n_f32(log2, 0.69314718056f));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < y.size(); ++j) {
+    y[j] = LogApproximation(x[j]);
+  }
+}
+
+void NsVectorMath::QuantileUpdate(
+    ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    ArrayView<float, kFftSizeBy2Plus1> density) const {
+  const float one_by_counter_plus_1 = 1.f / (counter + 1.f);
+  size_t j = 0;
+  switch (optimization_) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case NsOptimization::kSse2: {
+      const __m128 one = _mm_set1_ps(1.f);
+      const __m128 max_delta = _mm_set1_ps(40.f);
+      const __m128 scale = _mm_set1_ps(one_by_counter_plus_1);
+      const __m128 counter_ps = _mm_set1_ps(static_cast<float>(counter));
+      const __m128 up = _mm_set1_ps(0.25f);
+      const __m128 down = _mm_set1_ps(0.75f);
+      const __m128 abs_mask =
+          _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+      const __m128 width = _mm_set1_ps(0.01f);
+      const __m128 one_by_width_plus_2 = _mm_set1_ps(1.f / (2.f * 0.01f));
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const __m128 d = _mm_loadu_ps(&density[j]);
+        const __m128 delta = Select(_mm_cmpgt_ps(d, one),
+                                    _mm_div_ps(max_delta, d), max_delta);
+        const __m128 multiplier = _mm_mul_ps(delta, scale);
+        const __m128 log_s = _mm_loadu_ps(&log_spectrum[j]);
+        __m128 log_q = _mm_loadu_ps(&log_quantile[j]);
+        log_q = Select(_mm_cmpgt_ps(log_s, log_q),
+                       _mm_add_ps(log_q, _mm_mul_ps(up, multiplier)),
+                       _mm_sub_ps(log_q, _mm_mul_ps(down, multiplier)));
+        _mm_storeu_ps(&log_quantile[j], log_q);
+
+        const __m128 distance = _mm_and_ps(abs_mask, _mm_sub_ps(log_s, log_q));
+        const __m128 d_updated = _mm_mul_ps(
+            _mm_add_ps(_mm_mul_ps(counter_ps, d), one_by_width_plus_2), scale);
+        _mm_storeu_ps(&density[j],
+                      Select(_mm_cmplt_ps(distance, width), d_updated, d));
+      }
+    } break;
+    case NsOptimization::kAvx2:
+      j = QuantileUpdateAVX2(log_spectrum, counter, log_quantile, density);
+      break;
+#endif
+// Vector division is only available on AArch64.
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+    case NsOptimization::kNeon: {
+      const float32x4_t one = vdupq_n_f32(1.f);
+      const float32x4_t max_delta = vdupq_n_f32(40.f);
+      const float32x4_t width = vdupq_n_f32(0.01f);
+      const float32x4_t one_by_width_plus_2 = vdupq_n_f32(1.f / (2.f * 0.01f));
+      for (; j + 4 <= kFftSizeBy2Plus1; j += 4) {
+        const float32x4_t d = vld1q_f32(&density[j]);
+        const float32x4_t delta =
+            vbslq_f32(vcgtq_f32(d, one), vdivq_f32(max_delta, d), max_delta);
+        const float32x4_t multiplier =
+            vmulq_n_f32(delta, one_by_counter_plus_1);
+        const float32x4_t log_s = vld1q_f32(&log_spectrum[j]);
+        float32x4_t log_q = vld1q_f32(&log_quantile[j]);
+        log_q = vbslq_f32(vcgtq_f32(log_s, log_q),
+                          vaddq_f32(log_q, vmulq_n_f32(multiplier, 0.25f)),
+                          vsubq_f32(log_q, vmulq_n_f32(multiplier, 0.75f)));
+        vst1q_f32(&log_quantile[j], log_q);
+
+        const float32x4_t distance = vabsq_f32(vsubq_f32(log_s, log_q));
+        const float32x4_t d_updated = vmulq_n_f32(
+            vaddq_f32(vmulq_n_f32(d, static_cast<float>(counter)),
+                      one_by_width_plus_2),
+            one_by_counter_plus_1);
+        vst1q_f32(&density[j],
+                  vbslq_f32(vcltq_f32(distance, width), d_updated, d));
+      }
+    } break;
+#endif
+    default:
+      break;
+  }
+
+  for (; j < kFftSizeBy2Plus1; ++j) {
+    QuantileUpdateBin(j, log_spectrum, counter, one_by_counter_plus_1,
+                      log_quantile, density);
+  }
+}
+
+}  // namespace webrtc
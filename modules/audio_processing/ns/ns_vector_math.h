@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
+#define MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
+
+#include <stddef.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/ns_common.h"
+
+namespace webrtc {
+
+enum class NsOptimization { kNone, kSse2, kAvx2, kNeon };
+
+// Detects what kind of optimizations to use for the noise suppressor.
+NsOptimization DetectNsOptimization();
+
+// Provides the per-bin spectral operations of the noise suppressor. All
+// optimized variants produce results that are bit-exact with those of
+// `NsOptimization::kNone`: the operations are performed in the same order and
+// without fused multiply-adds.
+class NsVectorMath {
+ public:
+  explicit NsVectorMath(NsOptimization optimization)
+      : optimization_(optimization) {}
+
+  NsOptimization optimization() const { return optimization_; }
+
+  // Elementwise multiplication z = x * y.
+  void Multiply(ArrayView<const float> x,
+                ArrayView<const float> y,
+                ArrayView<float> z) const;
+
+  // Scaling y = gain * x.
+  void Scale(float gain, ArrayView<const float> x, ArrayView<float> y) const;
+
+  // Splits the interleaved samples `x` into the samples at even and at odd
+  // indices.
+  void Deinterleave(ArrayView<const float> x,
+                    ArrayView<float> even,
+                    ArrayView<float> odd) const;
+
+  // Inverse of Deinterleave.
+  void Interleave(ArrayView<const float> even,
+                  ArrayView<const float> odd,
+                  ArrayView<float> x) const;
+
+  // Computes the magnitude spectrum, offset by one, of an FFT output.
+  void MagnitudeSpectrum(ArrayView<const float, kFftSize> real,
+                         ArrayView<const float, kFftSize> imag,
+                         ArrayView<float, kFftSizeBy2Plus1> spectrum) const;
+
+  // Computes the directed decision estimate of the prior SNR and the post SNR.
+  void Snr(ArrayView<const float, kFftSizeBy2Plus1> filter,
+           ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+           ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+           ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+           ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+           ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+           ArrayView<float, kFftSizeBy2Plus1> post_snr) const;
+
+  // Computes the Wiener filter gains from the prior SNR, limited to
+  // [`minimum_gain`, 1].
+  void WienerGain(float over_subtraction_factor,
+                  float minimum_gain,
+                  ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+                  ArrayView<float, kFftSizeBy2Plus1> filter) const;
+
+  // Computes the speech probability from the prior speech to non-speech ratio
+  // and the inverse of the likelihood ratios.
+  void SpeechProbability(
+      float gain_prior,
+      ArrayView<const float, kFftSizeBy2Plus1> inverse_lrt,
+      ArrayView<float, kFftSizeBy2Plus1> speech_probability) const;
+
+  // Updates the noise spectrum estimates based on the speech probability.
+  // The time constant for each bin depends on the speech probability of the
+  // bin below it.
+  void NoiseUpdate(
+      ArrayView<const float, kFftSizeBy2Plus1> speech_probability,
+      ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      ArrayView<float, kFftSizeBy2Plus1> conservative_noise_spectrum,
+      ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) const;
+
+  // Elementwise natural logarithm using the approximation of
+  // LogApproximation().
+  void Log(ArrayView<const float> x, ArrayView<float> y) const;
+
+  // Updates one of the simultaneous quantile estimates and its density.
+  void QuantileUpdate(ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+                      int counter,
+                      ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+                      ArrayView<float, kFftSizeBy2Plus1> density) const;
+
+ private:
+  // The AVX2 variants process the bins from the start of the range and return
+  // the index of the first bin left for the caller to process.
+  size_t MultiplyAVX2(ArrayView<const float> x,
+                      ArrayView<const float> y,
+                      ArrayView<float> z) const;
+  size_t ScaleAVX2(float gain,
+                   ArrayView<const float> x,
+                   ArrayView<float> y) const;
+  size_t DeinterleaveAVX2(ArrayView<const float> x,
+                          ArrayView<float> even,
+                          ArrayView<float> odd) const;
+  size_t InterleaveAVX2(ArrayView<const float> even,
+                        ArrayView<const float> odd,
+                        ArrayView<float> x) const;
+  // Starts at bin 1, as bin 0 holds the DC component.
+  size_t MagnitudeSpectrumAVX2(
+      ArrayView<const float, kFftSize> real,
+      ArrayView<const float, kFftSize> imag,
+      ArrayView<float, kFftSizeBy2Plus1> spectrum) const;
+  size_t SnrAVX2(ArrayView<const float, kFftSizeBy2Plus1> filter,
+                 ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+                 ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+                 ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+                 ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+                 ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+                 ArrayView<float, kFftSizeBy2Plus1> post_snr) const;
+  size_t WienerGainAVX2(float over_subtraction_factor,
+                        float minimum_gain,
+                        ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+                        ArrayView<float, kFftSizeBy2Plus1> filter) const;
+  size_t SpeechProbabilityAVX2(
+      float gain_prior,
+      ArrayView<const float, kFftSizeBy2Plus1> inverse_lrt,
+      ArrayView<float, kFftSizeBy2Plus1> speech_probability) const;
+  // Starts at bin 1, as the time constant of bin 0 does not depend on the
+  // speech probability.
+  size_t NoiseUpdateAVX2(
+      ArrayView<const float, kFftSizeBy2Plus1> speech_probability,
+      ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      ArrayView<float, kFftSizeBy2Plus1> conservative_noise_spectrum,
+      ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) const;
+  size_t LogAVX2(ArrayView<const float> x, ArrayView<float> y) const;
+  size_t QuantileUpdateAVX2(
+      ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      int counter,
+      ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      ArrayView<float, kFftSizeBy2Plus1> density) const;
+
+  const NsOptimization optimization_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
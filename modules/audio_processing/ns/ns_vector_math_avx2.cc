@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+#include <stddef.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
+
+namespace webrtc {
+
+// Elementwise multiplication z = x * y.
+size_t NsVectorMath::MultiplyAVX2(ArrayView<const float> x,
+                                  ArrayView<const float> y,
+                                  ArrayView<float> z) const {
+  size_t j = 0;
+  for (; j + 8 <= z.size(); j += 8) {
+    const __m256 x_j = _mm256_loadu_ps(&x[j]);
+    const __m256 y_j = _mm256_loadu_ps(&y[j]);
+    _mm256_storeu_ps(&z[j], _mm256_mul_ps(x_j, y_j));
+  }
+  return j;
+}
+
+// Scaling y = gain * x.
+size_t NsVectorMath::ScaleAVX2(float gain,
+                               ArrayView<const float> x,
+                               ArrayView<float> y) const {
+  const __m256 g = _mm256_set1_ps(gain);
+  size_t j = 0;
+  for (; j + 8 <= y.size(); j += 8) {
+    _mm256_storeu_ps(&y[j], _mm256_mul_ps(g, _mm256_loadu_ps(&x[j])));
+  }
+  return j;
+}
+
+size_t NsVectorMath::DeinterleaveAVX2(ArrayView<const float> x,
+                                      ArrayView<float> even,
+                                      ArrayView<float> odd) const {
+  size_t j = 0;
+  for (; j + 8 <= even.size(); j += 8) {
+    const __m256 a = _mm256_loadu_ps(&x[2 * j]);
+    const __m256 b = _mm256_loadu_ps(&x[2 * j + 8]);
+    // The shuffles operate within the 128 bit lanes, which leaves the pairs of
+    // the result in the order 0, 2, 1, 3.
+    const __m256d e = _mm256_castps_pd(
+        _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m256d o = _mm256_castps_pd(
+        _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    _mm256_storeu_ps(&even[j], _mm256_castpd_ps(_mm256_permute4x64_pd(
+                                   e, _MM_SHUFFLE(3, 1, 2, 0))));
+    _mm256_storeu_ps(&odd[j], _mm256_castpd_ps(_mm256_permute4x64_pd(
+                                  o, _MM_SHUFFLE(3, 1, 2, 0))));
+  }
+  return j;
+}
+
+size_t NsVectorMath::InterleaveAVX2(ArrayView<const float> even,
+                                    ArrayView<const float> odd,
+                                    ArrayView<float> x) const {
+  size_t j = 0;
+  for (; j + 8 <= even.size(); j += 8) {
+    const __m256 a = _mm256_loadu_ps(&even[j]);
+    const __m256 b = _mm256_loadu_ps(&odd[j]);
+    const __m256 low = _mm256_unpacklo_ps(a, b);
+    const __m256 high = _mm256_unpackhi_ps(a, b);
+    _mm256_storeu_ps(&x[2 * j], _mm256_permute2f128_ps(low, high, 0x20));
+    _mm256_storeu_ps(&x[2 * j + 8], _mm256_permute2f128_ps(low, high, 0x31));
+  }
+  return j;
+}
+
+size_t NsVectorMath::MagnitudeSpectrumAVX2(
+    ArrayView<const float, kFftSize> real,
+    ArrayView<const float, kFftSize> imag,
+    ArrayView<float, kFftSizeBy2Plus1> spectrum) const {
+  const __m256 one = _mm256_set1_ps(1.f);
+  size_t j = 1;
+  for (; j + 8 <= kFftSizeBy2Plus1 - 1; j += 8) {
+    const __m256 re = _mm256_loadu_ps(&real[j]);
+    const __m256 im = _mm256_loadu_ps(&imag[j]);
+    const __m256 power =
+        _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+    _mm256_storeu_ps(&spectrum[j], _mm256_add_ps(_mm256_sqrt_ps(power), one));
+  }
+  return j;
+}
+
+size_t NsVectorMath::SnrAVX2(
+    ArrayView<const float, kFftSizeBy2Plus1> filter,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    ArrayView<float, kFftSizeBy2Plus1> post_snr) const {
+  const __m256 epsilon = _mm256_set1_ps(0.0001f);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 prev_weight = _mm256_set1_ps(0.98f);
+  const __m256 current_weight = _mm256_set1_ps(1.f - 0.98f);
+  size_t j = 0;
+  for (; j + 8 <= kFftSizeBy2Plus1; j += 8) {
+    const __m256 prev_noise =
+        _mm256_add_ps(_mm256_loadu_ps(&prev_noise_spectrum[j]), epsilon);
+    const __m256 prev_estimate = _mm256_mul_ps(
+        _mm256_div_ps(_mm256_loadu_ps(&prev_signal_spectrum[j]), prev_noise),
+        _mm256_loadu_ps(&filter[j]));
+    const __m256 signal = _mm256_loadu_ps(&signal_spectrum[j]);
+    const __m256 noise = _mm256_loadu_ps(&noise_spectrum[j]);
+    const __m256 post = _mm256_and_ps(
+        _mm256_cmp_ps(signal, noise, _CMP_GT_OQ),
+        _mm256_sub_ps(_mm256_div_ps(signal, _mm256_add_ps(noise, epsilon)),
+                      one));
+    _mm256_storeu_ps(&post_snr[j], post);
+    _mm256_storeu_ps(&prior_snr[j],
+                     _mm256_add_ps(_mm256_mul_ps(prev_weight, prev_estimate),
+                                   _mm256_mul_ps(current_weight, post)));
+  }
+  return j;
+}
+
+size_t NsVectorMath::WienerGainAVX2(
+    float over_subtraction_factor,
+    float minimum_gain,
+    ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    ArrayView<float, kFftSizeBy2Plus1> filter) const {
+  const __m256 factor = _mm256_set1_ps(over_subtraction_factor);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 min_gain = _mm256_set1_ps(minimum_gain);
+  size_t j = 0;
+  for (; j + 8 <= kFftSizeBy2Plus1; j += 8) {
+    const __m256 snr = _mm256_loadu_ps(&prior_snr[j]);
+    __m256 gain = _mm256_div_ps(snr, _mm256_add_ps(factor, snr));
+    // The argument order matches that of std::min and std::max.
+    gain = _mm256_max_ps(min_gain, _mm256_min_ps(one, gain));
+    _mm256_storeu_ps(&filter[j], gain);
+  }
+  return j;
+}
+
+size_t NsVectorMath::SpeechProbabilityAVX2(
+    float gain_prior,
+    ArrayView<const float, kFftSizeBy2Plus1> inverse_lrt,
+    ArrayView<float, kFftSizeBy2Plus1> speech_probability) const {
+  const __m256 g = _mm256_set1_ps(gain_prior);
+  const __m256 one = _mm256_set1_ps(1.f);
+  size_t j = 0;
+  for (; j + 8 <= kFftSizeBy2Plus1; j += 8) {
+    const __m256 denominator =
+        _mm256_add_ps(one, _mm256_mul_ps(g, _mm256_loadu_ps(&inverse_lrt[j])));
+    _mm256_storeu_ps(&speech_probability[j], _mm256_div_ps(one, denominator));
+  }
+  return j;
+}
+
+size_t NsVectorMath::NoiseUpdateAVX2(
+    ArrayView<const float, kFftSizeBy2Plus1> speech_probability,
+    ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> conservative_noise_spectrum,
+    ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) const {
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 prob_range = _mm256_set1_ps(0.2f);
+  const __m256 noise_update = _mm256_set1_ps(0.9f);
+  const __m256 speech_noise_update = _mm256_set1_ps(0.99f);
+  const __m256 conservative_rate = _mm256_set1_ps(0.05f);
+  size_t j = 1;
+  for (; j + 8 <= kFftSizeBy2Plus1; j += 8) {
+    const __m256 prob_speech = _mm256_loadu_ps(&speech_probability[j]);
+    const __m256 prob_non_speech = _mm256_sub_ps(one, prob_speech);
+    const __m256 gamma = _mm256_blendv_ps(
+        noise_update, speech_noise_update,
+        _mm256_cmp_ps(_mm256_loadu_ps(&speech_probability[j - 1]), prob_range,
+                      _CMP_GT_OQ));
+    const __m256 gamma_new =
+        _mm256_blendv_ps(noise_update, speech_noise_update,
+                         _mm256_cmp_ps(prob_speech, prob_range, _CMP_GT_OQ));
+    const __m256 signal = _mm256_loadu_ps(&signal_spectrum[j]);
+    const __m256 prev_noise = _mm256_loadu_ps(&prev_noise_spectrum[j]);
+    const __m256 mixed = _mm256_add_ps(_mm256_mul_ps(prob_non_speech, signal),
+                                       _mm256_mul_ps(prob_speech, prev_noise));
+    const __m256 noise_update_tmp =
+        _mm256_add_ps(_mm256_mul_ps(gamma, prev_noise),
+                      _mm256_mul_ps(_mm256_sub_ps(one, gamma), mixed));
+    const __m256 noise_update_new =
+        _mm256_add_ps(_mm256_mul_ps(gamma_new, prev_noise),
+                      _mm256_mul_ps(_mm256_sub_ps(one, gamma_new), mixed));
+    _mm256_storeu_ps(
+        &noise_spectrum[j],
+        _mm256_blendv_ps(_mm256_min_ps(noise_update_tmp, noise_update_new),
+                         noise_update_tmp,
+                         _mm256_cmp_ps(gamma_new, gamma, _CMP_EQ_OQ)));
+
+    const __m256 conservative =
+        _mm256_loadu_ps(&conservative_noise_spectrum[j]);
+    const __m256 conservative_updated = _mm256_add_ps(
+        conservative,
+        _mm256_mul_ps(conservative_rate, _mm256_sub_ps(signal, conservative)));
+    _mm256_storeu_ps(
+        &conservative_noise_spectrum[j],
+        _mm256_blendv_ps(conservative, conservative_updated,
+                         _mm256_cmp_ps(prob_speech, prob_range, _CMP_LT_OQ)));
+  }
+  return j;
+}
+
+size_t NsVectorMath::LogAVX2(ArrayView<const float> x,
+                             ArrayView<float> y) const {
+  const __m256 scaling = _mm256_set1_ps(1.1920929e-7f);
+  const __m256 bias = _mm256_set1_ps(126.942695f);
+  const __m256 log_of_2 = _mm256_set1_ps(0.69314718056f);
+  size_t j = 0;
+  for (; j + 8 <= y.size(); j += 8) {
+    __m256 log2 =
+        _mm256_cvtepi32_ps(_mm256_castps_si256(_mm256_loadu_ps(&x[j])));
+    log2 = _mm256_sub_ps(_mm256_mul_ps(log2, scaling), bias);
+    _mm256_storeu_ps(&y[j], _mm256_mul_ps(log2, log_of_2));
+  }
+  return j;
+}
+
+size_t NsVectorMath::QuantileUpdateAVX2(
+    ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    ArrayView<float, kFftSizeBy2Plus1> density) const {
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 max_delta = _mm256_set1_ps(40.f);
+  const __m256 scale = _mm256_set1_ps(1.f / (counter + 1.f));
+  const __m256 counter_ps = _mm256_set1_ps(static_cast<float>(counter));
+  const __m256 up = _mm256_set1_ps(0.25f);
+  const __m256 down = _mm256_set1_ps(0.75f);
+  const __m256 abs_mask =
+      _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+  const __m256 width = _mm256_set1_ps(0.01f);
+  const __m256 one_by_width_plus_2 = _mm256_set1_ps(1.f / (2.f * 0.01f));
+  size_t j = 0;
+  for (; j + 8 <= kFftSizeBy2Plus1; j += 8) {
+    const __m256 d = _mm256_loadu_ps(&density[j]);
+    const __m256 delta =
+        _mm256_blendv_ps(max_delta, _mm256_div_ps(max_delta, d),
+                         _mm256_cmp_ps(d, one, _CMP_GT_OQ));
+    const __m256 multiplier = _mm256_mul_ps(delta, scale);
+    const __m256 log_s = _mm256_loadu_ps(&log_spectrum[j]);
+    __m256 log_q = _mm256_loadu_ps(&log_quantile[j]);
+    log_q = _mm256_blendv_ps(
+        _mm256_sub_ps(log_q, _mm256_mul_ps(down, multiplier)),
+        _mm256_add_ps(log_q, _mm256_mul_ps(up, multiplier)),
+        _mm256_cmp_ps(log_s, log_q, _CMP_GT_OQ));
+    _mm256_storeu_ps(&log_quantile[j], log_q);
+
+    const __m256 distance =
+        _mm256_and_ps(abs_mask, _mm256_sub_ps(log_s, log_q));
+    const __m256 d_updated = _mm256_mul_ps(
+        _mm256_add_ps(_mm256_mul_ps(counter_ps, d), one_by_width_plus_2),
+        scale);
+    _mm256_storeu_ps(&density[j],
+                     _mm256_blendv_ps(d, d_updated,
+                                      _mm256_cmp_ps(distance, width,
+                                                    _CMP_LT_OQ)));
+  }
+  return j;
+}
+
+}  // namespace webrtc
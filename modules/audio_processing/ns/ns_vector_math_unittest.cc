@@ -0,0 +1,282 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/ns_vector_math.h"
+
+#include <array>
+#include <vector>
+
+#include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_fft.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAreArray;
+
+// Returns the optimizations available on the current CPU. Each is verified to
+// be bit-exact with the reference implementation in NsOptimization::kNone.
+std::vector<NsOptimization> OptimizationsToTest() {
+  std::vector<NsOptimization> optimizations;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kSSE2) != 0) {
+    optimizations.push_back(NsOptimization::kSse2);
+  }
+  if (GetCPUInfo(kAVX2) != 0) {
+    optimizations.push_back(NsOptimization::kAvx2);
+  }
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  optimizations.push_back(NsOptimization::kNeon);
+#endif
+  return optimizations;
+}
+
+template <size_t N>
+void FillUniform(Random& random,
+                 float min,
+                 float max,
+                 std::array<float, N>& x) {
+  for (float& x_k : x) {
+    x_k = min + (max - min) * random.Rand<float>();
+  }
+}
+
+TEST(NsVectorMath, MultiplyAndScale) {
+  Random random(42);
+  // An odd size that exercises the scalar handling of the last elements.
+  std::array<float, kFftSize + 3> x;
+  std::array<float, kFftSize + 3> y;
+  FillUniform(random, -1000.f, 1000.f, x);
+  FillUniform(random, -1.f, 1.f, y);
+  std::array<float, kFftSize + 3> product_ref;
+  std::array<float, kFftSize + 3> scaled_ref;
+  const NsVectorMath reference(NsOptimization::kNone);
+  reference.Multiply(x, y, product_ref);
+  reference.Scale(0.3f, x, scaled_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    const NsVectorMath vector_math(optimization);
+    std::array<float, kFftSize + 3> product;
+    std::array<float, kFftSize + 3> scaled;
+    vector_math.Multiply(x, y, product);
+    vector_math.Scale(0.3f, x, scaled);
+    EXPECT_THAT(product, ElementsAreArray(product_ref));
+    EXPECT_THAT(scaled, ElementsAreArray(scaled_ref));
+  }
+}
+
+TEST(NsVectorMath, DeinterleaveAndInterleave) {
+  Random random(42);
+  std::array<float, 2 * (kFftSizeBy2Plus1 + 2)> x;
+  FillUniform(random, -1000.f, 1000.f, x);
+  std::array<float, kFftSizeBy2Plus1 + 2> even_ref;
+  std::array<float, kFftSizeBy2Plus1 + 2> odd_ref;
+  NsVectorMath(NsOptimization::kNone).Deinterleave(x, even_ref, odd_ref);
+  EXPECT_EQ(even_ref[3], x[6]);
+  EXPECT_EQ(odd_ref[3], x[7]);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    const NsVectorMath vector_math(optimization);
+    std::array<float, kFftSizeBy2Plus1 + 2> even;
+    std::array<float, kFftSizeBy2Plus1 + 2> odd;
+    vector_math.Deinterleave(x, even, odd);
+    EXPECT_THAT(even, ElementsAreArray(even_ref));
+    EXPECT_THAT(odd, ElementsAreArray(odd_ref));
+
+    std::array<float, 2 * (kFftSizeBy2Plus1 + 2)> interleaved;
+    vector_math.Interleave(even, odd, interleaved);
+    EXPECT_THAT(interleaved, ElementsAreArray(x));
+  }
+}
+
+TEST(NsVectorMath, MagnitudeSpectrum) {
+  Random random(42);
+  std::array<float, kFftSize> real;
+  std::array<float, kFftSize> imag;
+  FillUniform(random, -5000.f, 5000.f, real);
+  FillUniform(random, -5000.f, 5000.f, imag);
+  real[7] = imag[7] = 0.f;
+  std::array<float, kFftSizeBy2Plus1> spectrum_ref;
+  NsVectorMath(NsOptimization::kNone)
+      .MagnitudeSpectrum(real, imag, spectrum_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    std::array<float, kFftSizeBy2Plus1> spectrum;
+    NsVectorMath(optimization).MagnitudeSpectrum(real, imag, spectrum);
+    EXPECT_THAT(spectrum, ElementsAreArray(spectrum_ref));
+  }
+}
+
+TEST(NsVectorMath, SnrAndWienerGain) {
+  Random random(42);
+  std::array<float, kFftSizeBy2Plus1> filter;
+  std::array<float, kFftSizeBy2Plus1> prev_signal;
+  std::array<float, kFftSizeBy2Plus1> signal;
+  std::array<float, kFftSizeBy2Plus1> prev_noise;
+  std::array<float, kFftSizeBy2Plus1> noise;
+  FillUniform(random, 0.f, 1.f, filter);
+  FillUniform(random, 1.f, 10000.f, prev_signal);
+  FillUniform(random, 1.f, 10000.f, signal);
+  FillUniform(random, 0.f, 10000.f, prev_noise);
+  FillUniform(random, 0.f, 10000.f, noise);
+
+  const NsVectorMath reference(NsOptimization::kNone);
+  std::array<float, kFftSizeBy2Plus1> prior_snr_ref;
+  std::array<float, kFftSizeBy2Plus1> post_snr_ref;
+  std::array<float, kFftSizeBy2Plus1> gain_ref;
+  reference.Snr(filter, prev_signal, signal, prev_noise, noise, prior_snr_ref,
+                post_snr_ref);
+  reference.WienerGain(1.5f, 0.3f, prior_snr_ref, gain_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    const NsVectorMath vector_math(optimization);
+    std::array<float, kFftSizeBy2Plus1> prior_snr;
+    std::array<float, kFftSizeBy2Plus1> post_snr;
+    std::array<float, kFftSizeBy2Plus1> gain;
+    vector_math.Snr(filter, prev_signal, signal, prev_noise, noise, prior_snr,
+                    post_snr);
+    vector_math.WienerGain(1.5f, 0.3f, prior_snr, gain);
+    EXPECT_THAT(prior_snr, ElementsAreArray(prior_snr_ref));
+    EXPECT_THAT(post_snr, ElementsAreArray(post_snr_ref));
+    EXPECT_THAT(gain, ElementsAreArray(gain_ref));
+  }
+}
+
+TEST(NsVectorMath, SpeechProbability) {
+  Random random(42);
+  std::array<float, kFftSizeBy2Plus1> inverse_lrt;
+  FillUniform(random, 0.f, 100.f, inverse_lrt);
+  std::array<float, kFftSizeBy2Plus1> probability_ref;
+  NsVectorMath(NsOptimization::kNone)
+      .SpeechProbability(2.3f, inverse_lrt, probability_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    std::array<float, kFftSizeBy2Plus1> probability;
+    NsVectorMath(optimization)
+        .SpeechProbability(2.3f, inverse_lrt, probability);
+    EXPECT_THAT(probability, ElementsAreArray(probability_ref));
+  }
+}
+
+TEST(NsVectorMath, NoiseUpdate) {
+  Random random(42);
+  std::array<float, kFftSizeBy2Plus1> probability;
+  std::array<float, kFftSizeBy2Plus1> signal;
+  std::array<float, kFftSizeBy2Plus1> prev_noise;
+  std::array<float, kFftSizeBy2Plus1> conservative_noise_ref;
+  FillUniform(random, 0.f, 0.4f, probability);
+  // Include values at the boundary of the speech probability range.
+  probability[8] = probability[9] = 0.2f;
+  FillUniform(random, 1.f, 10000.f, signal);
+  FillUniform(random, 1.f, 10000.f, prev_noise);
+  FillUniform(random, 1.f, 10000.f, conservative_noise_ref);
+  const std::array<float, kFftSizeBy2Plus1> conservative_noise_initial =
+      conservative_noise_ref;
+  std::array<float, kFftSizeBy2Plus1> noise_ref;
+  NsVectorMath(NsOptimization::kNone)
+      .NoiseUpdate(probability, signal, prev_noise, conservative_noise_ref,
+                   noise_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    std::array<float, kFftSizeBy2Plus1> conservative_noise =
+        conservative_noise_initial;
+    std::array<float, kFftSizeBy2Plus1> noise;
+    NsVectorMath(optimization)
+        .NoiseUpdate(probability, signal, prev_noise, conservative_noise,
+                     noise);
+    EXPECT_THAT(noise, ElementsAreArray(noise_ref));
+    EXPECT_THAT(conservative_noise, ElementsAreArray(conservative_noise_ref));
+  }
+}
+
+TEST(NsVectorMath, LogAndQuantileUpdate) {
+  constexpr int kCounter = 199;
+  Random random(42);
+  std::array<float, kFftSizeBy2Plus1> spectrum;
+  FillUniform(random, 1.f, 100000.f, spectrum);
+  std::array<float, kFftSizeBy2Plus1> log_spectrum;
+  const NsVectorMath reference(NsOptimization::kNone);
+  reference.Log(spectrum, log_spectrum);
+
+  std::array<float, kFftSizeBy2Plus1> log_quantile_initial;
+  std::array<float, kFftSizeBy2Plus1> density_initial;
+  FillUniform(random, 0.f, 12.f, log_quantile_initial);
+  FillUniform(random, 0.f, 3.f, density_initial);
+  // Place some of the quantiles close to the spectrum, with updates small
+  // enough for the density to be updated.
+  for (size_t k = 0; k < kFftSizeBy2Plus1; k += 3) {
+    log_quantile_initial[k] = log_spectrum[k] + 0.001f;
+    density_initial[k] = 20.f;
+  }
+  std::array<float, kFftSizeBy2Plus1> log_quantile_ref = log_quantile_initial;
+  std::array<float, kFftSizeBy2Plus1> density_ref = density_initial;
+  reference.QuantileUpdate(log_spectrum, kCounter, log_quantile_ref,
+                           density_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    const NsVectorMath vector_math(optimization);
+    std::array<float, kFftSizeBy2Plus1> log;
+    vector_math.Log(spectrum, log);
+    EXPECT_THAT(log, ElementsAreArray(log_spectrum));
+
+    std::array<float, kFftSizeBy2Plus1> log_quantile = log_quantile_initial;
+    std::array<float, kFftSizeBy2Plus1> density = density_initial;
+    vector_math.QuantileUpdate(log_spectrum, kCounter, log_quantile, density);
+    EXPECT_THAT(log_quantile, ElementsAreArray(log_quantile_ref));
+    EXPECT_THAT(density, ElementsAreArray(density_ref));
+  }
+  EXPECT_NE(density_ref[0], density_initial[0]);
+}
+
+TEST(NsVectorMath, FftIsBitExact) {
+  Random random(42);
+  std::array<float, kFftSize> time_data;
+  FillUniform(random, -32768.f, 32767.f, time_data);
+
+  NrFft reference_fft(NsOptimization::kNone);
+  std::array<float, kFftSize> scratch = time_data;
+  std::array<float, kFftSize> real_ref;
+  std::array<float, kFftSize> imag_ref;
+  reference_fft.Fft(scratch, real_ref, imag_ref);
+  std::array<float, kFftSize> output_ref;
+  reference_fft.Ifft(real_ref, imag_ref, output_ref);
+
+  for (NsOptimization optimization : OptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    NrFft fft(optimization);
+    scratch = time_data;
+    std::array<float, kFftSize> real;
+    std::array<float, kFftSize> imag;
+    fft.Fft(scratch, real, imag);
+    EXPECT_THAT(ArrayView<const float>(real.data(), kFftSizeBy2Plus1),
+                ElementsAreArray(real_ref.data(), kFftSizeBy2Plus1));
+    EXPECT_THAT(ArrayView<const float>(imag.data(), kFftSizeBy2Plus1),
+                ElementsAreArray(imag_ref.data(), kFftSizeBy2Plus1));
+    std::array<float, kFftSize> output;
+    fft.Ifft(real, imag, output);
+    EXPECT_THAT(output, ElementsAreArray(output_ref));
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
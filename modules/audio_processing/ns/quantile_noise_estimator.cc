@@ -16,7 +16,8 @@
 
 namespace webrtc {
 
-QuantileNoiseEstimator::QuantileNoiseEstimator() {
+QuantileNoiseEstimator::QuantileNoiseEstimator(NsOptimization optimization)
+    : vector_math_(optimization) {
   quantile_.fill(0.f);
   density_.fill(0.3f);
   log_quantile_.fill(8.f);
@@ -31,32 +32,17 @@ void QuantileNoiseEstimator::Estimate(
     ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
     ArrayView<float, kFftSizeBy2Plus1> noise_spectrum) {
   std::array<float, kFftSizeBy2Plus1> log_spectrum;
-  LogApproximation(signal_spectrum, log_spectrum);
+  vector_math_.Log(signal_spectrum, log_spectrum);
 
   int quantile_index_to_return = -1;
   // Loop over simultaneous estimates.
   for (int s = 0, k = 0; s < kSimult;
        ++s, k += static_cast<int>(kFftSizeBy2Plus1)) {
-    const float one_by_counter_plus_1 = 1.f / (counter_[s] + 1.f);
-    for (int i = 0, j = k; i < static_cast<int>(kFftSizeBy2Plus1); ++i, ++j) {
-      // Update log quantile estimate.
-      const float delta = density_[j] > 1.f ? 40.f / density_[j] : 40.f;
-
-      const float multiplier = delta * one_by_counter_plus_1;
-      if (log_spectrum[i] > log_quantile_[j]) {
-        log_quantile_[j] += 0.25f * multiplier;
-      } else {
-        log_quantile_[j] -= 0.75f * multiplier;
-      }
-
-      // Update density estimate.
-      constexpr float kWidth = 0.01f;
-      constexpr float kOneByWidthPlus2 = 1.f / (2.f * kWidth);
-      if (fabs(log_spectrum[i] - log_quantile_[j]) < kWidth) {
-        density_[j] = (counter_[s] * density_[j] + kOneByWidthPlus2) *
-                      one_by_counter_plus_1;
-      }
-    }
+    // Update log quantile and density estimates.
+    vector_math_.QuantileUpdate(
+        log_spectrum, counter_[s],
+        ArrayView<float, kFftSizeBy2Plus1>(&log_quantile_[k], kFftSizeBy2Plus1),
+        ArrayView<float, kFftSizeBy2Plus1>(&density_[k], kFftSizeBy2Plus1));
 
     if (counter_[s] >= kLongStartupPhaseBlocks) {
       counter_[s] = 0;
@@ -15,6 +15,7 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/signal_model_estimator.h"
 
 namespace webrtc {
@@ -22,7 +23,7 @@ namespace webrtc {
 // Class for estimating the probability of speech.
 class SpeechProbabilityEstimator {
  public:
-  SpeechProbabilityEstimator();
+  explicit SpeechProbabilityEstimator(NsOptimization optimization);
   SpeechProbabilityEstimator(const SpeechProbabilityEstimator&) = delete;
   SpeechProbabilityEstimator& operator=(const SpeechProbabilityEstimator&) =
       delete;
@@ -41,6 +42,7 @@ class SpeechProbabilityEstimator {
   ArrayView<const float> get_probability() { return speech_probability_; }
 
  private:
+  const NsVectorMath vector_math_;
   SignalModelEstimator signal_model_estimator_;
   float prior_speech_prob_ = .5f;
   std::array<float, kFftSizeBy2Plus1> speech_probability_;
@@ -15,6 +15,7 @@
 
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/suppression_params.h"
 
 namespace webrtc {
@@ -22,7 +23,8 @@ namespace webrtc {
 // Estimates a Wiener-filter based frequency domain noise reduction filter.
 class WienerFilter {
  public:
-  explicit WienerFilter(const SuppressionParams& suppression_params);
+  WienerFilter(const SuppressionParams& suppression_params,
+               NsOptimization optimization);
   WienerFilter(const WienerFilter&) = delete;
   WienerFilter& operator=(const WienerFilter&) = delete;
 
@@ -47,6 +49,7 @@ class WienerFilter {
 
  private:
   const SuppressionParams& suppression_params_;
+  const NsVectorMath vector_math_;
   std::array<float, kFftSizeBy2Plus1> spectrum_prev_process_;
   std::array<float, kFftSizeBy2Plus1> initial_spectral_estimate_;
   std::array<float, kFftSizeBy2Plus1> filter_;
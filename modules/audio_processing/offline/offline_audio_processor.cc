@@ -0,0 +1,304 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/offline/offline_audio_processor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "common_audio/channel_buffer.h"
+#include "common_audio/include/audio_util.h"
+#include "common_audio/wav_file.h"
+#include "common_audio/wav_header.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/system/file_wrapper.h"
+
+namespace webrtc {
+namespace {
+
+// Reads a WAV header straight from a file, without taking ownership of it.
+class WavHeaderFileReader : public WavHeaderReader {
+ public:
+  explicit WavHeaderFileReader(FileWrapper* file) : file_(file) {}
+
+  size_t Read(void* buf, size_t num_bytes) override {
+    size_t count = file_->Read(buf, num_bytes);
+    pos_ += count;
+    return count;
+  }
+  bool SeekForward(uint32_t num_bytes) override {
+    bool success = file_->SeekRelative(num_bytes);
+    if (success) {
+      pos_ += num_bytes;
+    }
+    return success;
+  }
+  int64_t GetPosition() override { return pos_; }
+
+ private:
+  FileWrapper* const file_;
+  int64_t pos_ = 0;
+};
+
+// Returns nullptr if the file can't be opened or isn't a WAV file that
+// WavReader supports, which WavReader itself would RTC_CHECK.
+std::unique_ptr<WavReader> OpenWavReader(absl::string_view filename) {
+  FileWrapper file = FileWrapper::OpenReadOnly(filename);
+  if (!file.is_open()) {
+    RTC_LOG(LS_ERROR) << "Could not open " << filename;
+    return nullptr;
+  }
+  WavHeaderFileReader header_reader(&file);
+  size_t num_channels;
+  int sample_rate_hz;
+  WavFormat format;
+  size_t bytes_per_sample;
+  size_t num_samples;
+  int64_t data_start_pos;
+  if (!ReadWavHeader(&header_reader, &num_channels, &sample_rate_hz, &format,
+                     &bytes_per_sample, &num_samples, &data_start_pos) ||
+      (format != WavFormat::kWavFormatPcm &&
+       format != WavFormat::kWavFormatIeeeFloat)) {
+    RTC_LOG(LS_ERROR) << "Invalid or unsupported WAV file " << filename;
+    return nullptr;
+  }
+  if (!file.Rewind()) {
+    RTC_LOG(LS_ERROR) << "Could not rewind " << filename;
+    return nullptr;
+  }
+  return std::make_unique<WavReader>(std::move(file));
+}
+
+// Returns `config` with the values that can't be processed replaced by the
+// closest ones that can.
+OfflineAudioProcessor::Config SanitizeConfig(
+    OfflineAudioProcessor::Config config) {
+  if (config.num_threads < 1) {
+    RTC_LOG(LS_WARNING) << "Invalid number of threads " << config.num_threads
+                        << ", using 1.";
+    config.num_threads = 1;
+  }
+  if (config.block_duration_ms < AudioProcessing::kChunkSizeMs) {
+    RTC_LOG(LS_WARNING) << "Block duration " << config.block_duration_ms
+                        << " ms is shorter than a frame, using "
+                        << AudioProcessing::kChunkSizeMs << " ms.";
+    config.block_duration_ms = AudioProcessing::kChunkSizeMs;
+  }
+  return config;
+}
+
+// A block of interleaved 10 ms frames of one of the streams of a recording,
+// together with the deinterleaved buffers used for processing one frame.
+class FrameBlock {
+ public:
+  FrameBlock(const StreamConfig& config, size_t frames_per_block)
+      : config_(config),
+        interleaved_(frames_per_block * config.num_samples()),
+        input_(config.num_frames(), config.num_channels()),
+        output_(config.num_frames(), config.num_channels()) {}
+
+  const StreamConfig& config() const { return config_; }
+  const float* const* input() const { return input_.channels(); }
+  float* const* output() { return output_.channels(); }
+
+  // Fills the block from `reader` and returns the number of whole frames
+  // read. The rest of the block is zeroed.
+  size_t Read(WavReader& reader) {
+    const size_t num_read =
+        reader.ReadSamples(interleaved_.size(), interleaved_.data());
+    std::fill(interleaved_.begin() + num_read, interleaved_.end(), 0.f);
+    return num_read / config_.num_samples();
+  }
+
+  // Writes the first `num_frames` frames of the block to `writer`.
+  void Write(size_t num_frames, WavWriter& writer) const {
+    writer.WriteSamples(interleaved_.data(),
+                        num_frames * config_.num_samples());
+  }
+
+  // Copies frame `index` of the block into the input buffer.
+  void Deinterleave(size_t index) {
+    const size_t num_channels = config_.num_channels();
+    const float* frame = &interleaved_[index * config_.num_samples()];
+    for (size_t ch = 0; ch < num_channels; ++ch) {
+      float* channel = input_.channels()[ch];
+      for (size_t i = 0; i < config_.num_frames(); ++i) {
+        channel[i] = FloatS16ToFloat(frame[i * num_channels + ch]);
+      }
+    }
+  }
+
+  // Copies the output buffer into frame `index` of the block.
+  void Interleave(size_t index) {
+    const size_t num_channels = config_.num_channels();
+    float* frame = &interleaved_[index * config_.num_samples()];
+    for (size_t ch = 0; ch < num_channels; ++ch) {
+      const float* channel = output_.channels()[ch];
+      for (size_t i = 0; i < config_.num_frames(); ++i) {
+        frame[i * num_channels + ch] = FloatToFloatS16(channel[i]);
+      }
+    }
+  }
+
+ private:
+  const StreamConfig config_;
+  std::vector<float> interleaved_;
+  ChannelBuffer<float> input_;
+  ChannelBuffer<float> output_;
+};
+
+}  // namespace
+
+double OfflineProcessingResult::RealtimeFactor() const {
+  return processing_time > TimeDelta::Zero() ? audio_duration / processing_time
+                                             : 0.0;
+}
+
+double OfflineBatchResult::RealtimeFactor() const {
+  return processing_time > TimeDelta::Zero() ? audio_duration / processing_time
+                                             : 0.0;
+}
+
+OfflineAudioProcessor::OfflineAudioProcessor(const Environment& env,
+                                             const Config& config)
+    : env_(env), config_(SanitizeConfig(config)) {}
+
+OfflineProcessingResult OfflineAudioProcessor::Process(
+    const OfflineProcessingJob& job) const {
+  OfflineProcessingResult result;
+  std::unique_ptr<WavReader> capture_reader =
+      OpenWavReader(job.capture_filename);
+  if (!capture_reader) {
+    return result;
+  }
+  std::unique_ptr<WavReader> render_reader;
+  if (!job.render_filename.empty()) {
+    render_reader = OpenWavReader(job.render_filename);
+    if (!render_reader) {
+      return result;
+    }
+  }
+  FileWrapper output_file = FileWrapper::OpenWriteOnly(job.output_filename);
+  if (!output_file.is_open()) {
+    RTC_LOG(LS_ERROR) << "Could not open " << job.output_filename;
+    return result;
+  }
+
+  const Timestamp start_time = env_.clock().CurrentTime();
+  scoped_refptr<AudioProcessing> apm =
+      BuiltinAudioProcessingBuilder(config_.apm_config).Build(env_);
+
+  const size_t frames_per_block =
+      config_.block_duration_ms / AudioProcessing::kChunkSizeMs;
+  FrameBlock capture(StreamConfig(capture_reader->sample_rate(),
+                                  capture_reader->num_channels()),
+                     frames_per_block);
+  std::optional<FrameBlock> render;
+  if (render_reader) {
+    render.emplace(StreamConfig(render_reader->sample_rate(),
+                                render_reader->num_channels()),
+                   frames_per_block);
+  }
+
+  size_t num_processed_frames = 0;
+  {
+    WavWriter writer(std::move(output_file), capture_reader->sample_rate(),
+                     capture_reader->num_channels(), config_.output_format);
+    size_t num_frames;
+    do {
+      num_frames = capture.Read(*capture_reader);
+      if (render) {
+        render->Read(*render_reader);
+      }
+      for (size_t i = 0; i < num_frames; ++i) {
+        bool failed = false;
+        if (render) {
+          render->Deinterleave(i);
+          failed = apm->ProcessReverseStream(
+                       render->input(), render->config(), render->config(),
+                       render->output()) != AudioProcessing::kNoError;
+        }
+        capture.Deinterleave(i);
+        apm->set_stream_delay_ms(config_.stream_delay_ms);
+        if (apm->ProcessStream(capture.input(), capture.config(),
+                               capture.config(),
+                               capture.output()) != AudioProcessing::kNoError) {
+          failed = true;
+        }
+        if (failed) {
+          ++result.num_failed_frames;
+        }
+        capture.Interleave(i);
+      }
+      capture.Write(num_frames, writer);
+      num_processed_frames += num_frames;
+    } while (num_frames == frames_per_block);
+  }
+
+  result.success = true;
+  result.processing_time = env_.clock().CurrentTime() - start_time;
+  result.audio_duration =
+      TimeDelta::Micros(num_processed_frames * capture.config().num_frames() *
+                        1'000'000 / capture.config().sample_rate_hz());
+  return result;
+}
+
+OfflineBatchResult OfflineAudioProcessor::ProcessBatch(
+    ArrayView<const OfflineProcessingJob> jobs) const {
+  OfflineBatchResult result;
+  result.jobs.resize(jobs.size());
+  const Timestamp start_time = env_.clock().CurrentTime();
+
+  // The jobs are handed out one at a time, so that the threads done with short
+  // recordings take over the remaining ones.
+  std::atomic<size_t> next_job(0);
+  auto run_jobs = [&] {
+    for (size_t i = next_job.fetch_add(1); i < jobs.size();
+         i = next_job.fetch_add(1)) {
+      result.jobs[i] = Process(jobs[i]);
+    }
+  };
+  const size_t num_threads =
+      std::min(static_cast<size_t>(config_.num_threads), jobs.size());
+  std::vector<PlatformThread> workers;
+  for (size_t i = 1; i < num_threads; ++i) {
+    workers.push_back(
+        PlatformThread::SpawnJoinable(run_jobs, "OfflineApmWorker"));
+  }
+  run_jobs();
+  for (PlatformThread& worker : workers) {
+    worker.Finalize();
+  }
+
+  result.processing_time = env_.clock().CurrentTime() - start_time;
+  for (const OfflineProcessingResult& job_result : result.jobs) {
+    result.audio_duration += job_result.audio_duration;
+  }
+  return result;
+}
+
+}  // namespace webrtc
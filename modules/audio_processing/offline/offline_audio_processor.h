@@ -0,0 +1,100 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_OFFLINE_OFFLINE_AUDIO_PROCESSOR_H_
+#define MODULES_AUDIO_PROCESSING_OFFLINE_OFFLINE_AUDIO_PROCESSOR_H_
+
+#include <string>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment.h"
+#include "api/units/time_delta.h"
+#include "common_audio/wav_file.h"
+
+namespace webrtc {
+
+// A recording to process: the captured audio, the optional rendered audio that
+// the capture may contain echo of, and where to write the processed capture.
+struct OfflineProcessingJob {
+  std::string capture_filename;
+  // Empty if there is no rendered audio.
+  std::string render_filename;
+  std::string output_filename;
+};
+
+struct OfflineProcessingResult {
+  // Ratio between the duration of the processed audio and the time it took to
+  // process it.
+  double RealtimeFactor() const;
+
+  bool success = false;
+  TimeDelta audio_duration = TimeDelta::Zero();
+  TimeDelta processing_time = TimeDelta::Zero();
+  // Number of 10 ms frames for which the audio processing reported an error,
+  // when processing either the captured or the rendered audio.
+  int num_failed_frames = 0;
+};
+
+struct OfflineBatchResult {
+  // Ratio between the total duration of the processed audio and the time it
+  // took to process the whole batch.
+  double RealtimeFactor() const;
+
+  // One result per job, in the order of the jobs.
+  std::vector<OfflineProcessingResult> jobs;
+  TimeDelta audio_duration = TimeDelta::Zero();
+  TimeDelta processing_time = TimeDelta::Zero();
+};
+
+// Runs recorded WAV files through the audio processing as fast as possible,
+// for re-processing archives of recordings. The files are read and written in
+// large blocks, which are then fed to a separate `AudioProcessing` instance per
+// file in 10 ms frames. Independent files are processed in parallel.
+class OfflineAudioProcessor {
+ public:
+  struct Config {
+    AudioProcessing::Config apm_config;
+    // Maximum number of files processed concurrently by ProcessBatch(). Values
+    // below 1 are replaced by 1.
+    int num_threads = 1;
+    // Duration of the audio read from and written to the files at a time,
+    // rounded down to whole 10 ms frames. Values below 10 ms are replaced by
+    // 10 ms.
+    int block_duration_ms = 1000;
+    // Delay between the rendered and the captured audio, as reported to the
+    // audio processing.
+    int stream_delay_ms = 0;
+    WavFile::SampleFormat output_format = WavFile::SampleFormat::kInt16;
+  };
+
+  OfflineAudioProcessor(const Environment& env, const Config& config);
+  OfflineAudioProcessor(const OfflineAudioProcessor&) = delete;
+  OfflineAudioProcessor& operator=(const OfflineAudioProcessor&) = delete;
+
+  // Processes one recording on the calling thread. A trailing partial 10 ms
+  // frame of the capture is dropped. The rendered audio, if any, is
+  // zero-padded when shorter than the capture. May be called concurrently.
+  OfflineProcessingResult Process(const OfflineProcessingJob& job) const;
+
+  // Processes the recordings using up to `Config::num_threads` threads, the
+  // calling thread included.
+  OfflineBatchResult ProcessBatch(
+      ArrayView<const OfflineProcessingJob> jobs) const;
+
+ private:
+  const Environment env_;
+  const Config config_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_OFFLINE_OFFLINE_AUDIO_PROCESSOR_H_
@@ -0,0 +1,249 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/offline/offline_audio_processor.h"
+
+#include <stddef.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment_factory.h"
+#include "api/units/time_delta.h"
+#include "common_audio/wav_file.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+namespace {
+
+std::string CreateNoiseFile(absl::string_view prefix,
+                            int sample_rate_hz,
+                            size_t num_channels,
+                            size_t samples_per_channel,
+                            int seed) {
+  std::string filename = test::TempFilename(test::OutputPath(), prefix);
+  WavWriter writer(filename, sample_rate_hz, num_channels);
+  Random random(seed);
+  std::vector<float> samples(samples_per_channel * num_channels);
+  for (float& sample : samples) {
+    sample = random.Gaussian(0, 2000);
+  }
+  writer.WriteSamples(samples.data(), samples.size());
+  return filename;
+}
+
+std::vector<float> ReadFile(absl::string_view filename) {
+  WavReader reader(filename);
+  std::vector<float> samples(reader.num_samples());
+  EXPECT_EQ(reader.ReadSamples(samples.size(), samples.data()),
+            samples.size());
+  return samples;
+}
+
+AudioProcessing::Config CreateApmConfig() {
+  AudioProcessing::Config config;
+  config.echo_canceller.enabled = true;
+  config.noise_suppression.enabled = true;
+  config.gain_controller2.enabled = true;
+  return config;
+}
+
+class OfflineAudioProcessorTest : public ::testing::Test {
+ protected:
+  ~OfflineAudioProcessorTest() override {
+    for (const std::string& filename : files_) {
+      test::RemoveFile(filename);
+    }
+  }
+
+  std::string AddFile(std::string filename) {
+    files_.push_back(filename);
+    return filename;
+  }
+
+  std::string OutputFilename() {
+    return AddFile(test::TempFilename(test::OutputPath(), "offline_output"));
+  }
+
+  std::vector<std::string> files_;
+};
+
+TEST_F(OfflineAudioProcessorTest, ProcessesWholeFrames) {
+  // 1.234 s of audio, of which the last 4 ms do not make up a frame.
+  const OfflineProcessingJob job = {
+      .capture_filename = AddFile(CreateNoiseFile("offline_capture", 48000,
+                                                  /*num_channels=*/2,
+                                                  /*samples_per_channel=*/59232,
+                                                  /*seed=*/1)),
+      .output_filename = OutputFilename()};
+  OfflineAudioProcessor::Config config;
+  config.apm_config = CreateApmConfig();
+  OfflineAudioProcessor processor(CreateEnvironment(), config);
+
+  const OfflineProcessingResult result = processor.Process(job);
+  EXPECT_TRUE(result.success);
+  EXPECT_EQ(result.num_failed_frames, 0);
+  EXPECT_EQ(result.audio_duration, TimeDelta::Millis(1230));
+
+  WavReader output(job.output_filename);
+  EXPECT_EQ(output.sample_rate(), 48000);
+  EXPECT_EQ(output.num_channels(), 2u);
+  EXPECT_EQ(output.num_samples(), 2u * 59040);
+}
+
+TEST_F(OfflineAudioProcessorTest, OutputDoesNotDependOnBlockDuration) {
+  const std::string capture = AddFile(
+      CreateNoiseFile("offline_capture", 32000, /*num_channels=*/1,
+                      /*samples_per_channel=*/48000, /*seed=*/1));
+  // The render audio is shorter than the capture and at another rate.
+  const std::string render = AddFile(
+      CreateNoiseFile("offline_render", 16000, /*num_channels=*/2,
+                      /*samples_per_channel=*/12345, /*seed=*/2));
+
+  std::vector<std::vector<float>> outputs;
+  for (int block_duration_ms : {10, 70, 1000}) {
+    OfflineAudioProcessor::Config config;
+    config.apm_config = CreateApmConfig();
+    config.block_duration_ms = block_duration_ms;
+    config.output_format = WavFile::SampleFormat::kFloat;
+    OfflineAudioProcessor processor(CreateEnvironment(), config);
+    const OfflineProcessingJob job = {.capture_filename = capture,
+                                      .render_filename = render,
+                                      .output_filename = OutputFilename()};
+    ASSERT_TRUE(processor.Process(job).success);
+    outputs.push_back(ReadFile(job.output_filename));
+  }
+  EXPECT_EQ(outputs[0].size(), 48000u);
+  EXPECT_EQ(outputs[0], outputs[1]);
+  EXPECT_EQ(outputs[0], outputs[2]);
+}
+
+TEST_F(OfflineAudioProcessorTest, ProcessesBlocksShorterThanAFrameAsOneFrame) {
+  const std::string capture = AddFile(
+      CreateNoiseFile("offline_capture", 16000, /*num_channels=*/1,
+                      /*samples_per_channel=*/1600, /*seed=*/1));
+
+  std::vector<std::vector<float>> outputs;
+  for (int block_duration_ms : {10, 5, 0, -10}) {
+    OfflineAudioProcessor::Config config;
+    config.apm_config = CreateApmConfig();
+    config.block_duration_ms = block_duration_ms;
+    OfflineAudioProcessor processor(CreateEnvironment(), config);
+    const OfflineProcessingJob job = {.capture_filename = capture,
+                                      .output_filename = OutputFilename()};
+    const OfflineProcessingResult result = processor.Process(job);
+    ASSERT_TRUE(result.success);
+    EXPECT_EQ(result.audio_duration, TimeDelta::Millis(100));
+    outputs.push_back(ReadFile(job.output_filename));
+  }
+  for (size_t i = 1; i < outputs.size(); ++i) {
+    EXPECT_EQ(outputs[0], outputs[i]);
+  }
+}
+
+TEST_F(OfflineAudioProcessorTest, BatchMatchesIndividualProcessing) {
+  std::vector<OfflineProcessingJob> jobs;
+  for (int i = 0; i < 5; ++i) {
+    jobs.push_back(
+        {.capture_filename = AddFile(CreateNoiseFile(
+             "offline_capture", 16000, /*num_channels=*/1 + i % 2,
+             /*samples_per_channel=*/8000 * (i + 1), /*seed=*/1 + i)),
+         .render_filename = AddFile(CreateNoiseFile(
+             "offline_render", 48000, /*num_channels=*/1,
+             /*samples_per_channel=*/48000, /*seed=*/10 + i)),
+         .output_filename = OutputFilename()});
+  }
+  OfflineAudioProcessor::Config config;
+  config.apm_config = CreateApmConfig();
+  config.num_threads = 3;
+  OfflineAudioProcessor processor(CreateEnvironment(), config);
+
+  const OfflineBatchResult result = processor.ProcessBatch(jobs);
+  ASSERT_EQ(result.jobs.size(), jobs.size());
+  TimeDelta audio_duration = TimeDelta::Zero();
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    EXPECT_TRUE(result.jobs[i].success);
+    EXPECT_EQ(result.jobs[i].audio_duration, TimeDelta::Millis(500 * (i + 1)));
+    audio_duration += result.jobs[i].audio_duration;
+
+    OfflineProcessingJob reference_job = jobs[i];
+    reference_job.output_filename = OutputFilename();
+    ASSERT_TRUE(processor.Process(reference_job).success);
+    EXPECT_EQ(ReadFile(jobs[i].output_filename),
+              ReadFile(reference_job.output_filename));
+  }
+  EXPECT_EQ(result.audio_duration, audio_duration);
+  EXPECT_GT(result.RealtimeFactor(), 0.0);
+}
+
+TEST_F(OfflineAudioProcessorTest, MissingInputFailsOnlyItsJob) {
+  const std::vector<OfflineProcessingJob> jobs = {
+      {.capture_filename = test::OutputPath() + "offline_missing.wav",
+       .output_filename = OutputFilename()},
+      {.capture_filename = AddFile(CreateNoiseFile(
+           "offline_capture", 16000, /*num_channels=*/1,
+           /*samples_per_channel=*/1600, /*seed=*/1)),
+       .render_filename = test::OutputPath() + "offline_missing.wav",
+       .output_filename = OutputFilename()},
+      {.capture_filename = AddFile(CreateNoiseFile(
+           "offline_capture", 16000, /*num_channels=*/1,
+           /*samples_per_channel=*/1600, /*seed=*/1)),
+       .output_filename = OutputFilename()}};
+  OfflineAudioProcessor::Config config;
+  config.num_threads = 2;
+  OfflineAudioProcessor processor(CreateEnvironment(), config);
+
+  const OfflineBatchResult result = processor.ProcessBatch(jobs);
+  ASSERT_EQ(result.jobs.size(), 3u);
+  EXPECT_FALSE(result.jobs[0].success);
+  EXPECT_FALSE(result.jobs[1].success);
+  EXPECT_TRUE(result.jobs[2].success);
+  EXPECT_EQ(result.audio_duration, TimeDelta::Millis(100));
+}
+
+TEST_F(OfflineAudioProcessorTest, CorruptInputFailsOnlyItsJob) {
+  // A file with a valid RIFF header, but the WAVE format tag is missing.
+  const std::string corrupt_filename =
+      AddFile(test::TempFilename(test::OutputPath(), "offline_corrupt"));
+  FILE* file = fopen(corrupt_filename.c_str(), "wb");
+  ASSERT_TRUE(file);
+  const char kCorruptHeader[] = "RIFF\x24\x00\x00\x00JUNKfmt garbage";
+  fwrite(kCorruptHeader, 1, sizeof(kCorruptHeader), file);
+  fclose(file);
+
+  const std::vector<OfflineProcessingJob> jobs = {
+      {.capture_filename = corrupt_filename,
+       .output_filename = OutputFilename()},
+      {.capture_filename = AddFile(CreateNoiseFile(
+           "offline_capture", 16000, /*num_channels=*/1,
+           /*samples_per_channel=*/1600, /*seed=*/1)),
+       .render_filename = corrupt_filename,
+       .output_filename = OutputFilename()},
+      {.capture_filename = AddFile(CreateNoiseFile(
+           "offline_capture", 16000, /*num_channels=*/1,
+           /*samples_per_channel=*/1600, /*seed=*/1)),
+       .output_filename = OutputFilename()}};
+  OfflineAudioProcessor processor(CreateEnvironment(),
+                                  OfflineAudioProcessor::Config());
+
+  const OfflineBatchResult result = processor.ProcessBatch(jobs);
+  ASSERT_EQ(result.jobs.size(), 3u);
+  EXPECT_FALSE(result.jobs[0].success);
+  EXPECT_FALSE(result.jobs[1].success);
+  EXPECT_TRUE(result.jobs[2].success);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/utility/processing_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "api/function_view.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/race_checker.h"
+
+namespace webrtc {
+
+ProcessingThreadPool::ProcessingThreadPool(int num_threads) {
+  RTC_DCHECK_GE(num_threads, 1);
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  // The workers run in the same conditions as the audio processing thread
+  // that waits for them.
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->thread = PlatformThread::SpawnJoinable(
+        [this, i] { RunWorker(i); }, "ApmProcessingWorker",
+        ThreadAttributes().SetPriority(ThreadPriority::kRealtime));
+  }
+}
+
+ProcessingThreadPool::~ProcessingThreadPool() {
+  quit_ = true;
+  for (auto& worker : workers_) {
+    worker->start.Set();
+  }
+  for (auto& worker : workers_) {
+    worker->thread.Finalize();
+  }
+}
+
+void ProcessingThreadPool::ParallelFor(size_t num_items,
+                                       FunctionView<void(size_t)> work) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const size_t num_active_threads =
+      std::min(static_cast<size_t>(num_threads()), num_items);
+  if (num_active_threads <= 1) {
+    for (size_t i = 0; i < num_items; ++i) {
+      work(i);
+    }
+    return;
+  }
+
+  work_ = &work;
+  num_items_ = num_items;
+  num_active_threads_ = num_active_threads;
+  num_pending_workers_.store(num_active_threads - 1);
+  for (size_t i = 0; i + 1 < num_active_threads; ++i) {
+    workers_[i]->start.Set();
+  }
+  RunItems(/*thread_index=*/0);
+  done_.Wait(Event::kForever);
+  work_ = nullptr;
+}
+
+void ProcessingThreadPool::RunWorker(size_t worker_index) {
+  Worker& worker = *workers_[worker_index];
+  while (true) {
+    worker.start.Wait(Event::kForever);
+    if (quit_) {
+      return;
+    }
+    RunItems(/*thread_index=*/worker_index + 1);
+    if (num_pending_workers_.fetch_sub(1) == 1) {
+      done_.Set();
+    }
+  }
+}
+
+void ProcessingThreadPool::RunItems(size_t thread_index) {
+  for (size_t i = thread_index; i < num_items_; i += num_active_threads_) {
+    (*work_)(i);
+  }
+}
+
+void ParallelFor(ProcessingThreadPool* thread_pool,
+                 size_t num_items,
+                 FunctionView<void(size_t)> work) {
+  if (thread_pool) {
+    thread_pool->ParallelFor(num_items, work);
+    return;
+  }
+  for (size_t i = 0; i < num_items; ++i) {
+    work(i);
+  }
+}
+
+}  // namespace webrtc
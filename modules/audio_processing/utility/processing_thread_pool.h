@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_UTILITY_PROCESSING_THREAD_POOL_H_
+#define MODULES_AUDIO_PROCESSING_UTILITY_PROCESSING_THREAD_POOL_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/function_view.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/race_checker.h"
+
+namespace webrtc {
+
+// Pool of threads for splitting independent per-channel work within one call
+// to the audio processing. The calling thread takes part in the work, so a
+// pool of `num_threads` spawns `num_threads` - 1 threads.
+class ProcessingThreadPool {
+ public:
+  explicit ProcessingThreadPool(int num_threads);
+  ~ProcessingThreadPool();
+  ProcessingThreadPool(const ProcessingThreadPool&) = delete;
+  ProcessingThreadPool& operator=(const ProcessingThreadPool&) = delete;
+
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Runs `work` for every index in [0, `num_items`) and returns when all calls
+  // have completed. The calls for different indices may run concurrently and
+  // must therefore not touch the same state. Index 0 is always run on the
+  // calling thread. Must not be called concurrently or from within `work`.
+  void ParallelFor(size_t num_items, FunctionView<void(size_t)> work);
+
+ private:
+  struct Worker {
+    Event start;
+    PlatformThread thread;
+  };
+
+  void RunWorker(size_t worker_index);
+  void RunItems(size_t thread_index);
+
+  RaceChecker race_checker_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Set before the workers are started and read by them until `done_` is set.
+  FunctionView<void(size_t)>* work_ = nullptr;
+  size_t num_items_ = 0;
+  size_t num_active_threads_ = 0;
+  bool quit_ = false;
+  std::atomic<size_t> num_pending_workers_{0};
+  Event done_;
+};
+
+// Runs `work` for every index in [0, `num_items`) on `thread_pool`, or in
+// order on the calling thread if `thread_pool` is null.
+void ParallelFor(ProcessingThreadPool* thread_pool,
+                 size_t num_items,
+                 FunctionView<void(size_t)> work);
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_UTILITY_PROCESSING_THREAD_POOL_H_
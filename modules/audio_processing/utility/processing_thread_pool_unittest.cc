@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/utility/processing_thread_pool.h"
+
+#include <stddef.h>
+
+#include <atomic>
+#include <set>
+#include <vector>
+
+#include "rtc_base/platform_thread_types.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+TEST(ProcessingThreadPoolTest, RunsEveryIndexOnce) {
+  ProcessingThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4);
+  for (size_t num_items : {0, 1, 3, 4, 5, 17}) {
+    std::vector<std::atomic<int>> counts(num_items);
+    pool.ParallelFor(num_items, [&](size_t i) { ++counts[i]; });
+    for (size_t i = 0; i < num_items; ++i) {
+      EXPECT_EQ(counts[i], 1) << "index " << i << " of " << num_items;
+    }
+  }
+}
+
+TEST(ProcessingThreadPoolTest, RunsFirstIndexOnCallingThread) {
+  ProcessingThreadPool pool(3);
+  const PlatformThreadRef caller = CurrentThreadRef();
+  for (int call = 0; call < 10; ++call) {
+    std::vector<PlatformThreadRef> threads(6);
+    pool.ParallelFor(threads.size(),
+                     [&](size_t i) { threads[i] = CurrentThreadRef(); });
+    EXPECT_TRUE(IsThreadRefEqual(threads[0], caller));
+    std::set<PlatformThreadRef> distinct(threads.begin(), threads.end());
+    EXPECT_EQ(distinct.size(), 3u);
+  }
+}
+
+TEST(ProcessingThreadPoolTest, SingleThreadedPoolRunsInOrder) {
+  ProcessingThreadPool pool(1);
+  std::vector<size_t> order;
+  pool.ParallelFor(5, [&](size_t i) { order.push_back(i); });
+  EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ProcessingThreadPoolTest, RunsInOrderWithoutPool) {
+  std::vector<size_t> order;
+  ParallelFor(/*thread_pool=*/nullptr, 3,
+              [&](size_t i) { order.push_back(i); });
+  EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2}));
+}
+
+}  // namespace
+}  // namespace webrtc
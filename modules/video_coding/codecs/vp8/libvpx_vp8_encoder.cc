@@ -31,6 +31,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/i420_buffer.h"
 #include "api/video/render_resolution.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_bitrate_allocator.h"
@@ -45,6 +46,7 @@
 #include "api/video_codecs/vp8_frame_buffer_controller.h"
 #include "api/video_codecs/vp8_frame_config.h"
 #include "api/video_codecs/vp8_temporal_layers_factory.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "modules/video_coding/codecs/interface/common_constants.h"
 #include "modules/video_coding/codecs/interface/libvpx_interface.h"
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
@@ -1498,6 +1500,25 @@ std::vector<scoped_refptr<VideoFrameBuffer>> LibvpxVp8Encoder::PrepareBuffers(
   std::vector<scoped_refptr<VideoFrameBuffer>> prepared_buffers;
   SetRawImagePlanes(&raw_images_[0], mapped_buffer.get());
   prepared_buffers.push_back(mapped_buffer);
+  if (encoders_.size() > 2 &&
+      mapped_buffer->type() == VideoFrameBuffer::Type::kI420 &&
+      buffer->type() != VideoFrameBuffer::Type::kNative) {
+    // Produce all lower layers in one pass over the input, with each layer
+    // scaled from the one above it while its rows are still in cache. Native
+    // buffers are left to scale themselves below, as they may do it in
+    // hardware.
+    std::vector<scoped_refptr<I420Buffer>> pyramid;
+    for (size_t i = 1; i < encoders_.size(); ++i) {
+      pyramid.push_back(
+          I420Buffer::Create(raw_images_[i].d_w, raw_images_[i].d_h));
+    }
+    ScaleI420Pyramid(*mapped_buffer->GetI420(), pyramid);
+    for (size_t i = 1; i < encoders_.size(); ++i) {
+      SetRawImagePlanes(&raw_images_[i], pyramid[i - 1].get());
+      prepared_buffers.push_back(pyramid[i - 1]);
+    }
+    return prepared_buffers;
+  }
   for (size_t i = 1; i < encoders_.size(); ++i) {
     // Native buffers should implement optimized scaling and is the preferred
     // buffer to scale. But if the buffer isn't native, it should be cheaper to
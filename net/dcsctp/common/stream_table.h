@@ -0,0 +1,180 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef NET_DCSCTP_COMMON_STREAM_TABLE_H_
+#define NET_DCSCTP_COMMON_STREAM_TABLE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "net/dcsctp/public/types.h"
+
+namespace dcsctp {
+
+// A map from stream identifier to per-stream state, stored in a vector indexed
+// by the stream identifier. Looking up a stream is a single array access, and
+// adding one is constant time in whatever order the streams are created, which
+// matters as a peer decides which streams are used. The vector grows to the
+// largest stream identifier in use; as these are 16 bits, it's bounded.
+//
+// Entries are heap-allocated, so references to them remain valid until they're
+// erased. Iteration visits the streams in increasing stream identifier order,
+// as a `std::map<StreamID, T>` would, and yields `std::pair<const StreamID, T>`
+// elements.
+template <typename T>
+class StreamTable {
+ public:
+  using key_type = StreamID;
+  using mapped_type = T;
+  using value_type = std::pair<const StreamID, T>;
+
+ private:
+  using Slots = std::vector<std::unique_ptr<value_type>>;
+
+  template <bool kConst>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = StreamTable::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<kConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<kConst, const value_type*, value_type*>;
+
+    Iterator() = default;
+    // Allows converting an `iterator` to a `const_iterator`.
+    template <bool kOtherConst,
+              bool kSelfConst = kConst,
+              typename = std::enable_if_t<kSelfConst && !kOtherConst>>
+    Iterator(const Iterator<kOtherConst>& other)  // NOLINT(runtime/explicit)
+        : it_(other.it_), end_(other.end_) {}
+
+    reference operator*() const { return **it_; }
+    pointer operator->() const { return it_->get(); }
+
+    Iterator& operator++() {
+      ++it_;
+      SkipEmpty();
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) {
+      return a.it_ == b.it_;
+    }
+    friend bool operator!=(const Iterator& a, const Iterator& b) {
+      return a.it_ != b.it_;
+    }
+
+   private:
+    friend class StreamTable;
+    template <bool>
+    friend class Iterator;
+
+    Iterator(typename Slots::const_iterator it,
+             typename Slots::const_iterator end)
+        : it_(it), end_(end) {
+      SkipEmpty();
+    }
+
+    void SkipEmpty() {
+      while (it_ != end_ && *it_ == nullptr) {
+        ++it_;
+      }
+    }
+
+    typename Slots::const_iterator it_;
+    typename Slots::const_iterator end_;
+  };
+
+ public:
+  using iterator = Iterator</*kConst=*/false>;
+  using const_iterator = Iterator</*kConst=*/true>;
+
+  StreamTable() = default;
+  StreamTable(StreamTable&&) = default;
+  StreamTable& operator=(StreamTable&&) = default;
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  iterator begin() { return iterator(slots_.begin(), slots_.end()); }
+  iterator end() { return iterator(slots_.end(), slots_.end()); }
+  const_iterator begin() const {
+    return const_iterator(slots_.begin(), slots_.end());
+  }
+  const_iterator end() const {
+    return const_iterator(slots_.end(), slots_.end());
+  }
+
+  iterator find(StreamID stream_id) {
+    return has(stream_id) ? iterator(slots_.begin() + *stream_id, slots_.end())
+                          : end();
+  }
+  const_iterator find(StreamID stream_id) const {
+    return has(stream_id)
+               ? const_iterator(slots_.begin() + *stream_id, slots_.end())
+               : end();
+  }
+  bool contains(StreamID stream_id) const { return has(stream_id); }
+
+  // Creates the entry for `stream_id` from `args` unless it already exists.
+  // Returns the entry, and if it was created.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(StreamID stream_id, Args&&... args) {
+    size_t index = *stream_id;
+    if (index >= slots_.size()) {
+      slots_.resize(index + 1);
+    }
+    bool inserted = false;
+    if (slots_[index] == nullptr) {
+      slots_[index] = std::make_unique<value_type>(
+          std::piecewise_construct, std::forward_as_tuple(stream_id),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+      ++size_;
+      inserted = true;
+    }
+    return {iterator(slots_.begin() + index, slots_.end()), inserted};
+  }
+
+  size_t erase(StreamID stream_id) {
+    if (!has(stream_id)) {
+      return 0;
+    }
+    slots_[*stream_id] = nullptr;
+    --size_;
+    return 1;
+  }
+
+  void clear() {
+    slots_.clear();
+    size_ = 0;
+  }
+
+ private:
+  bool has(StreamID stream_id) const {
+    return *stream_id < slots_.size() && slots_[*stream_id] != nullptr;
+  }
+
+  Slots slots_;
+  size_t size_ = 0;
+};
+
+}  // namespace dcsctp
+
+#endif  // NET_DCSCTP_COMMON_STREAM_TABLE_H_
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "net/dcsctp/common/stream_table.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "net/dcsctp/public/types.h"
+#include "rtc_base/gunit.h"
+#include "test/gmock.h"
+
+namespace dcsctp {
+namespace {
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+TEST(StreamTableTest, StartsEmpty) {
+  StreamTable<int> table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.begin(), table.end());
+  EXPECT_EQ(table.find(StreamID(0)), table.end());
+}
+
+TEST(StreamTableTest, CreatesEntryOnce) {
+  StreamTable<std::string> table;
+  auto [it, inserted] = table.try_emplace(StreamID(3), "a");
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->first, StreamID(3));
+  EXPECT_EQ(it->second, "a");
+
+  auto [it2, inserted2] = table.try_emplace(StreamID(3), "b");
+  EXPECT_FALSE(inserted2);
+  EXPECT_EQ(it2, it);
+  EXPECT_EQ(it2->second, "a");
+  EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(StreamTableTest, FindsOnlyCreatedEntries) {
+  StreamTable<int> table;
+  table.try_emplace(StreamID(5), 50);
+  EXPECT_EQ(table.find(StreamID(4)), table.end());
+  EXPECT_EQ(table.find(StreamID(6)), table.end());
+  EXPECT_EQ(table.find(StreamID(65535)), table.end());
+  ASSERT_NE(table.find(StreamID(5)), table.end());
+  EXPECT_EQ(table.find(StreamID(5))->second, 50);
+  EXPECT_TRUE(table.contains(StreamID(5)));
+  EXPECT_FALSE(table.contains(StreamID(0)));
+}
+
+TEST(StreamTableTest, IteratesInStreamIdOrder) {
+  StreamTable<int> table;
+  table.try_emplace(StreamID(65535), 3);
+  table.try_emplace(StreamID(7), 2);
+  table.try_emplace(StreamID(0), 1);
+
+  std::vector<std::pair<StreamID, int>> entries;
+  for (const auto& [stream_id, value] : table) {
+    entries.emplace_back(stream_id, value);
+  }
+  EXPECT_THAT(entries, ElementsAre(Pair(StreamID(0), 1), Pair(StreamID(7), 2),
+                                   Pair(StreamID(65535), 3)));
+}
+
+TEST(StreamTableTest, KeepsReferencesStableWhenGrowing) {
+  StreamTable<int> table;
+  int& value = table.try_emplace(StreamID(1), 10).first->second;
+  for (int i = 2; i < 1000; ++i) {
+    table.try_emplace(StreamID(i), i);
+  }
+  EXPECT_EQ(&table.find(StreamID(1))->second, &value);
+}
+
+TEST(StreamTableTest, ErasesEntries) {
+  StreamTable<int> table;
+  table.try_emplace(StreamID(1), 1);
+  table.try_emplace(StreamID(2), 2);
+  EXPECT_EQ(table.erase(StreamID(1)), 1u);
+  EXPECT_EQ(table.erase(StreamID(1)), 0u);
+  EXPECT_EQ(table.erase(StreamID(100)), 0u);
+  EXPECT_EQ(table.size(), 1u);
+  EXPECT_EQ(table.begin()->first, StreamID(2));
+
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.begin(), table.end());
+}
+
+}  // namespace
+}  // namespace dcsctp
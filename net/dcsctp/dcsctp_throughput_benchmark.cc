@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/public/dcsctp_message.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/rx/reassembly_queue.h"
+#include "net/dcsctp/socket/mock_dcsctp_socket_callbacks.h"
+#include "net/dcsctp/tx/rr_send_queue.h"
+#include "net/dcsctp/tx/send_queue.h"
+
+namespace dcsctp {
+namespace {
+
+constexpr size_t kMtu = 1100;
+constexpr size_t kMessageSize = 200;
+// Splits every message in two fragments, so that reassembly has to buffer
+// partial messages.
+constexpr size_t kMaxChunkPayload = 128;
+constexpr size_t kMessagesPerBatch = 1024;
+constexpr size_t kMaxReassemblyBytes = 4 * 1024 * 1024;
+
+// Sends small ordered messages spread over `streams` streams through the send
+// queue, where they are fragmented, and into the reassembly queue, where they
+// are put back together. With `reorder`, the fragments of each batch are
+// delivered last-first, so that nearly every message waits in the reassembly
+// streams for the ones before it.
+void BM_DcSctpThroughput(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  const bool interleaving = state.range(1) != 0;
+  const bool reorder = state.range(2) != 0;
+  const webrtc::Timestamp now = webrtc::Timestamp::Seconds(1);
+
+  testing::NiceMock<MockDcSctpSocketCallbacks> callbacks;
+  RRSendQueue send_queue("", &callbacks, kMtu, StreamPriority(256),
+                         /*total_buffered_amount_low_threshold=*/0);
+  send_queue.EnableMessageInterleaving(interleaving);
+  ReassemblyQueue reassembly_queue("", kMaxReassemblyBytes, interleaving);
+  const std::vector<uint8_t> payload(kMessageSize);
+  std::vector<Data> chunks;
+  TSN tsn(1);
+  size_t messages = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kMessagesPerBatch; ++i) {
+      send_queue.Add(
+          now, DcSctpMessage(StreamID(i % num_streams), PPID(53), payload));
+    }
+    chunks.clear();
+    while (std::optional<SendQueue::DataToSend> chunk =
+               send_queue.Produce(now, kMaxChunkPayload)) {
+      chunks.push_back(std::move(chunk->data));
+    }
+    if (reorder) {
+      std::reverse(chunks.begin(), chunks.end());
+    }
+    // TSNs follow the order in which the chunks were produced.
+    TSN first_tsn = tsn;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      size_t index = reorder ? chunks.size() - 1 - i : i;
+      reassembly_queue.Add(TSN(*first_tsn + index), std::move(chunks[i]));
+    }
+    tsn = TSN(*first_tsn + chunks.size());
+    messages += reassembly_queue.FlushMessages().size();
+  }
+  state.SetItemsProcessed(messages);
+  state.SetBytesProcessed(messages * kMessageSize);
+}
+
+BENCHMARK(BM_DcSctpThroughput)
+    ->ArgNames({"streams", "interleaving", "reorder"})
+    ->ArgsProduct({{1, 64, 1024}, {0, 1}, {0, 1}});
+
+}  // namespace
+}  // namespace dcsctp
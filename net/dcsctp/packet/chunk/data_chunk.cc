@@ -20,6 +20,7 @@
 #include "net/dcsctp/packet/bounded_byte_reader.h"
 #include "net/dcsctp/packet/bounded_byte_writer.h"
 #include "net/dcsctp/packet/chunk/data_common.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "rtc_base/strings/string_builder.h"
 
 namespace dcsctp {
@@ -45,6 +46,18 @@ constexpr int DataChunk::kType;
 
 std::optional<DataChunk> DataChunk::Parse(
     webrtc::ArrayView<const uint8_t> data) {
+  return Parse(data, nullptr);
+}
+
+std::optional<DataChunk> DataChunk::Parse(
+    webrtc::ArrayView<const uint8_t> data,
+    const PayloadSlice& buffer) {
+  return Parse(data, &buffer);
+}
+
+std::optional<DataChunk> DataChunk::Parse(
+    webrtc::ArrayView<const uint8_t> data,
+    const PayloadSlice* buffer) {
   std::optional<BoundedByteReader<kHeaderSize>> reader = ParseTLV(data);
   if (!reader.has_value()) {
     return std::nullopt;
@@ -65,8 +78,9 @@ std::optional<DataChunk> DataChunk::Parse(
       ImmediateAckFlag((flags & (1 << kFlagsBitImmediateAck)) != 0);
 
   return DataChunk(tsn, stream_identifier, ssn, ppid,
-                   std::vector<uint8_t>(reader->variable_data().begin(),
-                                        reader->variable_data().end()),
+                   buffer != nullptr
+                       ? buffer->SubsliceOrCopy(reader->variable_data())
+                       : PayloadSlice::Copy(reader->variable_data()),
                    options);
 }
 
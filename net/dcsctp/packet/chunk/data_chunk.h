@@ -23,6 +23,7 @@
 #include "net/dcsctp/packet/chunk/data_common.h"
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/packet/tlv_trait.h"
+#include "net/dcsctp/public/payload_slice.h"
 
 namespace dcsctp {
 
@@ -45,7 +46,7 @@ class DataChunk : public AnyDataChunk, public TLVTrait<DataChunkConfig> {
             StreamID stream_id,
             SSN ssn,
             PPID ppid,
-            std::vector<uint8_t> payload,
+            PayloadSlice payload,
             const Options& options)
       : AnyDataChunk(tsn,
                      stream_id,
@@ -60,9 +61,18 @@ class DataChunk : public AnyDataChunk, public TLVTrait<DataChunkConfig> {
       : AnyDataChunk(tsn, std::move(data), immediate_ack) {}
 
   static std::optional<DataChunk> Parse(webrtc::ArrayView<const uint8_t> data);
+  // Parses `data`, which lies within `buffer`, letting the payload reference
+  // `buffer` instead of copying it. Payloads that are small compared to
+  // `buffer` are still copied, see PayloadSlice::SubsliceOrCopy().
+  static std::optional<DataChunk> Parse(webrtc::ArrayView<const uint8_t> data,
+                                        const PayloadSlice& buffer);
 
   void SerializeTo(std::vector<uint8_t>& out) const override;
   std::string ToString() const override;
+
+ private:
+  static std::optional<DataChunk> Parse(webrtc::ArrayView<const uint8_t> data,
+                                        const PayloadSlice* buffer);
 };
 
 }  // namespace dcsctp
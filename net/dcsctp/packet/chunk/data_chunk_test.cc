@@ -11,9 +11,11 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "api/array_view.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "net/dcsctp/testing/testing_macros.h"
 #include "rtc_base/gunit.h"
 #include "test/gmock.h"
@@ -21,6 +23,7 @@
 namespace dcsctp {
 namespace {
 using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
 
 TEST(DataChunkTest, FromCapture) {
   /*
@@ -70,5 +73,43 @@ TEST(DataChunkTest, SerializeAndDeserialize) {
             "DATA, type=ordered::middle, tsn=123, sid=456, ssn=789, ppid=9090, "
             "length=5");
 }
+
+TEST(DataChunkTest, ParseSharesPayloadWithBuffer) {
+  const std::vector<uint8_t> payload(100, 42);
+  DataChunk chunk(TSN(123), StreamID(456), SSN(789), PPID(9090), payload,
+                  /*options=*/{});
+
+  std::vector<uint8_t> serialized;
+  chunk.SerializeTo(serialized);
+  PayloadSlice buffer(std::move(serialized));
+
+  ASSERT_HAS_VALUE_AND_ASSIGN(DataChunk deserialized,
+                              DataChunk::Parse(buffer, buffer));
+  EXPECT_EQ(deserialized.payload().data(),
+            buffer.data() + DataChunk::kHeaderSize);
+  EXPECT_THAT(deserialized.payload(), ElementsAreArray(payload));
+}
+
+TEST(DataChunkTest, ParseCopiesPayloadSmallComparedToBuffer) {
+  // A tiny fragment in a large packet must not keep the packet in memory, as
+  // received data is only accounted for by its payload size.
+  DataChunk chunk(TSN(123), StreamID(456), SSN(789), PPID(9090),
+                  /*payload=*/{1, 2, 3, 4, 5},
+                  /*options=*/{});
+
+  std::vector<uint8_t> serialized;
+  chunk.SerializeTo(serialized);
+  serialized.resize(1200);
+  PayloadSlice buffer(std::move(serialized));
+
+  ASSERT_HAS_VALUE_AND_ASSIGN(
+      DataChunk deserialized,
+      DataChunk::Parse(webrtc::ArrayView<const uint8_t>(buffer).subview(
+                           0, DataChunk::kHeaderSize + 5),
+                       buffer));
+  EXPECT_TRUE(deserialized.payload().data() < buffer.data() ||
+              deserialized.payload().data() >= buffer.end());
+  EXPECT_THAT(deserialized.payload(), ElementsAre(1, 2, 3, 4, 5));
+}
 }  // namespace
 }  // namespace dcsctp
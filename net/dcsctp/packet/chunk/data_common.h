@@ -17,6 +17,7 @@
 #include "api/array_view.h"
 #include "net/dcsctp/packet/chunk/chunk.h"
 #include "net/dcsctp/packet/data.h"
+#include "net/dcsctp/public/payload_slice.h"
 
 namespace dcsctp {
 
@@ -62,7 +63,7 @@ class AnyDataChunk : public Chunk {
                MID mid,
                FSN fsn,
                PPID ppid,
-               std::vector<uint8_t> payload,
+               PayloadSlice payload,
                const Options& options)
       : tsn_(tsn),
         data_(stream_id,
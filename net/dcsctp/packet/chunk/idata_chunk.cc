@@ -20,6 +20,7 @@
 #include "net/dcsctp/packet/bounded_byte_reader.h"
 #include "net/dcsctp/packet/bounded_byte_writer.h"
 #include "net/dcsctp/packet/chunk/data_common.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "rtc_base/strings/string_builder.h"
 
 namespace dcsctp {
@@ -47,6 +48,18 @@ constexpr int IDataChunk::kType;
 
 std::optional<IDataChunk> IDataChunk::Parse(
     webrtc::ArrayView<const uint8_t> data) {
+  return Parse(data, nullptr);
+}
+
+std::optional<IDataChunk> IDataChunk::Parse(
+    webrtc::ArrayView<const uint8_t> data,
+    const PayloadSlice& buffer) {
+  return Parse(data, &buffer);
+}
+
+std::optional<IDataChunk> IDataChunk::Parse(
+    webrtc::ArrayView<const uint8_t> data,
+    const PayloadSlice* buffer) {
   std::optional<BoundedByteReader<kHeaderSize>> reader = ParseTLV(data);
   if (!reader.has_value()) {
     return std::nullopt;
@@ -68,8 +81,9 @@ std::optional<IDataChunk> IDataChunk::Parse(
   return IDataChunk(tsn, stream_identifier, mid,
                     PPID(options.is_beginning ? ppid_or_fsn : 0),
                     FSN(options.is_beginning ? 0 : ppid_or_fsn),
-                    std::vector<uint8_t>(reader->variable_data().begin(),
-                                         reader->variable_data().end()),
+                    buffer != nullptr
+                        ? buffer->SubsliceOrCopy(reader->variable_data())
+                        : PayloadSlice::Copy(reader->variable_data()),
                     options);
 }
 
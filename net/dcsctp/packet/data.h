@@ -12,9 +12,9 @@
 
 #include <cstdint>
 #include <utility>
-#include <vector>
 
 #include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "net/dcsctp/public/types.h"
 
 namespace dcsctp {
@@ -45,7 +45,7 @@ struct Data {
        MID mid,
        FSN fsn,
        PPID ppid,
-       std::vector<uint8_t> payload,
+       PayloadSlice payload,
        IsBeginning is_beginning,
        IsEnd is_end,
        IsUnordered is_unordered)
@@ -63,7 +63,7 @@ struct Data {
   Data(Data&& other) = default;
   Data& operator=(Data&& other) = default;
 
-  // Creates a copy of this `Data` object.
+  // Creates a copy of this `Data` object, sharing the payload's buffer.
   Data Clone() const {
     return Data(stream_id, ssn, mid, fsn, ppid, payload, is_beginning, is_end,
                 is_unordered);
@@ -89,8 +89,9 @@ struct Data {
   // Payload Protocol Identifier (PPID).
   PPID ppid;
 
-  // The actual data payload.
-  std::vector<uint8_t> payload;
+  // The actual data payload, which may reference the buffer of the message it
+  // was fragmented from, or of the packet it was received in.
+  PayloadSlice payload;
 
   // If this data represents the first, last or a middle chunk.
   IsBeginning is_beginning;
@@ -22,6 +22,7 @@
 #include "net/dcsctp/common/internal_types.h"
 #include "net/dcsctp/packet/chunk/chunk.h"
 #include "net/dcsctp/public/dcsctp_options.h"
+#include "net/dcsctp/public/payload_slice.h"
 
 namespace dcsctp {
 
@@ -100,6 +101,10 @@ class SctpPacket {
     return descriptors_;
   }
 
+  // Returns the buffer holding the packet, which the chunk descriptors' data
+  // lie within. Chunks can share it to reference their payload without copying.
+  const PayloadSlice& buffer() const { return data_; }
+
  private:
   SctpPacket(const CommonHeader& common_header,
              std::vector<uint8_t> data,
@@ -111,9 +116,9 @@ class SctpPacket {
   CommonHeader common_header_;
 
   // As the `descriptors_` refer to offset within data, and since SctpPacket is
-  // movable, `data` needs to be pointer stable, which it is according to
-  // http://www.open-std.org/JTC1/SC22/WG21/docs/lwg-active.html#2321
-  std::vector<uint8_t> data_;
+  // movable, `data` needs to be pointer stable, which it is as the buffer is
+  // shared and never reallocated.
+  PayloadSlice data_;
   // The chunks and their offsets within `data_ `.
   std::vector<ChunkDescriptor> descriptors_;
 };
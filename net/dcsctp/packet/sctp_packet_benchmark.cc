@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/packet/chunk/data_chunk.h"
+#include "net/dcsctp/packet/sctp_packet.h"
+#include "net/dcsctp/public/dcsctp_options.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/testing/data_generator.h"
+
+namespace dcsctp {
+namespace {
+
+constexpr VerificationTag kVerificationTag(0x12345678);
+
+// Builds and parses packets holding a single DATA chunk with `payload_size`
+// bytes, as done for every packet sent and received. Without `checksum`, the
+// zero checksum alternate error detection method is used, so the CRC32c is
+// neither calculated when building the packet nor verified when parsing it.
+void BM_SctpPacketBuildAndParse(benchmark::State& state) {
+  const size_t payload_size = state.range(0);
+  const bool checksum = state.range(1) != 0;
+
+  DcSctpOptions options;
+  if (!checksum) {
+    options.zero_checksum_alternate_error_detection_method =
+        ZeroChecksumAlternateErrorDetectionMethod::LowerLayerDtls();
+  }
+  DataGenerator gen;
+  const Data data = gen.Ordered(std::vector<uint8_t>(payload_size), "BE");
+  for (auto _ : state) {
+    SctpPacket::Builder builder(kVerificationTag, options);
+    builder.Add(DataChunk(TSN(1), data.Clone(), /*immediate_ack=*/false));
+    std::vector<uint8_t> packet = builder.Build(/*write_checksum=*/checksum);
+    std::optional<SctpPacket> parsed = SctpPacket::Parse(packet, options);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * payload_size);
+}
+
+BENCHMARK(BM_SctpPacketBuildAndParse)
+    ->ArgNames({"payload_size", "checksum"})
+    ->ArgsProduct({{100, 1100}, {0, 1}});
+
+}  // namespace
+}  // namespace dcsctp
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "net/dcsctp/public/types.h"
 
 namespace dcsctp {
@@ -24,7 +25,10 @@ namespace dcsctp {
 // identifier (`ppid`).
 class DcSctpMessage {
  public:
-  DcSctpMessage(StreamID stream_id, PPID ppid, std::vector<uint8_t> payload)
+  // The payload is either a vector, which the message takes ownership of, or
+  // a slice of a buffer that e.g. the application already holds, which the
+  // message shares without copying it.
+  DcSctpMessage(StreamID stream_id, PPID ppid, PayloadSlice payload)
       : stream_id_(stream_id), ppid_(ppid), payload_(std::move(payload)) {}
 
   DcSctpMessage(DcSctpMessage&& other) = default;
@@ -41,13 +45,19 @@ class DcSctpMessage {
   // The payload of the message.
   webrtc::ArrayView<const uint8_t> payload() const { return payload_; }
 
-  // When destructing the message, extracts the payload.
-  std::vector<uint8_t> ReleasePayload() && { return std::move(payload_); }
+  // The payload of the message, as a slice sharing its buffer.
+  const PayloadSlice& payload_slice() const { return payload_; }
+
+  // When destructing the message, extracts the payload. This only copies the
+  // payload if its buffer is shared or wasn't created from a vector.
+  std::vector<uint8_t> ReleasePayload() && {
+    return std::move(payload_).ToVector();
+  }
 
  private:
   StreamID stream_id_;
   PPID ppid_;
-  std::vector<uint8_t> payload_;
+  PayloadSlice payload_;
 };
 }  // namespace dcsctp
 
@@ -10,6 +10,7 @@
 #ifndef NET_DCSCTP_PUBLIC_DCSCTP_SOCKET_H_
 #define NET_DCSCTP_PUBLIC_DCSCTP_SOCKET_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -299,6 +300,24 @@ class DcSctpSocketCallbacks {
     return SendPacketStatus::kSuccess;
   }
 
+  // Called when the library wants several packets to be sent at once, such as
+  // a burst of DATA that the congestion window allows. The packets should be
+  // sent in order, and the result of each attempt be stored at the same index
+  // in `statuses`, which has the same size as `packets`. Implementing this
+  // allows the client to amortize per-packet work, e.g. in the transport, over
+  // the whole burst. The default implementation calls `SendPacketWithStatus`
+  // for each packet.
+  //
+  // Note that it's NOT ALLOWED to call into this library from within this
+  // callback.
+  virtual void SendPacketsWithStatus(
+      webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>> packets,
+      webrtc::ArrayView<SendPacketStatus> statuses) {
+    for (size_t i = 0; i < packets.size(); ++i) {
+      statuses[i] = SendPacketWithStatus(packets[i]);
+    }
+  }
+
   // Called when the library wants to create a Timeout. The callback must return
   // an object that implements that interface.
   //
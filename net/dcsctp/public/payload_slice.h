@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef NET_DCSCTP_PUBLIC_PAYLOAD_SLICE_H_
+#define NET_DCSCTP_PUBLIC_PAYLOAD_SLICE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "rtc_base/checks.h"
+
+namespace dcsctp {
+
+// An immutable view of bytes that shares ownership of the buffer holding them.
+// Copying a slice, or taking a sub-slice of it, only adds a reference to the
+// buffer, which lets a message payload be written once and then be fragmented,
+// retransmitted and reassembled without copying its bytes.
+//
+// The buffer is kept alive for as long as any slice referencing it exists, so
+// a small slice of a large buffer keeps all of the buffer in memory. See
+// SubsliceOrCopy() for bounding that.
+class PayloadSlice {
+ public:
+  using value_type = uint8_t;
+  using size_type = size_t;
+  using const_iterator = const uint8_t*;
+  using iterator = const_iterator;
+
+  PayloadSlice() = default;
+
+  // Takes ownership of `data`, without copying it.
+  PayloadSlice(std::vector<uint8_t> data)  // NOLINT(runtime/explicit)
+      : PayloadSlice(std::make_shared<std::vector<uint8_t>>(std::move(data))) {}
+
+  PayloadSlice(std::initializer_list<uint8_t> data)  // NOLINT(runtime/explicit)
+      : PayloadSlice(std::vector<uint8_t>(data)) {}
+
+  // References `data`, which must stay valid for as long as `owner` is alive.
+  PayloadSlice(std::shared_ptr<const void> owner,
+               webrtc::ArrayView<const uint8_t> data)
+      : owner_(std::move(owner)), data_(data.data()), size_(data.size()) {}
+
+  // Creates a slice owning a copy of `data`.
+  static PayloadSlice Copy(webrtc::ArrayView<const uint8_t> data) {
+    return PayloadSlice(std::vector<uint8_t>(data.begin(), data.end()));
+  }
+
+  PayloadSlice(const PayloadSlice&) = default;
+  PayloadSlice& operator=(const PayloadSlice&) = default;
+  PayloadSlice(PayloadSlice&& other) noexcept
+      : owner_(std::move(other.owner_)),
+        vector_(std::exchange(other.vector_, nullptr)),
+        data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+  PayloadSlice& operator=(PayloadSlice&& other) noexcept {
+    owner_ = std::move(other.owner_);
+    vector_ = std::exchange(other.vector_, nullptr);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+  uint8_t operator[](size_t index) const {
+    RTC_DCHECK_LT(index, size_);
+    return data_[index];
+  }
+
+  operator webrtc::ArrayView<const uint8_t>() const {
+    return webrtc::ArrayView<const uint8_t>(data_, size_);
+  }
+
+  // Returns `size` bytes starting at `offset`, sharing this slice's buffer.
+  PayloadSlice subslice(size_t offset, size_t size) const {
+    RTC_DCHECK_LE(offset, size_);
+    RTC_DCHECK_LE(size, size_ - offset);
+    PayloadSlice slice(*this);
+    slice.data_ += offset;
+    slice.size_ = size;
+    return slice;
+  }
+
+  // Returns the slice covering `view`, which must lie within this slice.
+  PayloadSlice subslice(webrtc::ArrayView<const uint8_t> view) const {
+    RTC_DCHECK(view.empty() ||
+               (view.data() >= data_ && view.data() + view.size() <= end()));
+    return subslice(view.empty() ? 0 : view.data() - data_, view.size());
+  }
+
+  // Like subslice(view), but copies `view` instead when it covers less than
+  // half of this slice. As the returned slice then never keeps more than twice
+  // its own size in memory, received payloads can be accounted for by their
+  // size, however small the fragments they arrive in.
+  PayloadSlice SubsliceOrCopy(webrtc::ArrayView<const uint8_t> view) const {
+    if (view.size() < size_ - view.size()) {
+      return Copy(view);
+    }
+    return subslice(view);
+  }
+
+  // Returns the bytes as a vector. This moves them out without copying when
+  // the slice is the only reference to an entire buffer that it owns.
+  std::vector<uint8_t> ToVector() && {
+    if (vector_ != nullptr && owner_.use_count() == 1 &&
+        data_ == vector_->data() && size_ == vector_->size()) {
+      std::vector<uint8_t> data = std::move(*vector_);
+      *this = PayloadSlice();
+      return data;
+    }
+    return std::vector<uint8_t>(begin(), end());
+  }
+
+ private:
+  explicit PayloadSlice(std::shared_ptr<std::vector<uint8_t>> vector)
+      : owner_(vector),
+        vector_(vector.get()),
+        data_(vector->data()),
+        size_(vector->size()) {}
+
+  std::shared_ptr<const void> owner_;
+  // Set when `owner_` is a vector created by this class, which is mutable.
+  std::vector<uint8_t>* vector_ = nullptr;
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace dcsctp
+
+#endif  // NET_DCSCTP_PUBLIC_PAYLOAD_SLICE_H_
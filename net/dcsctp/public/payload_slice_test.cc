@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "net/dcsctp/public/payload_slice.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "rtc_base/gunit.h"
+#include "test/gmock.h"
+
+namespace dcsctp {
+namespace {
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+TEST(PayloadSliceTest, DefaultIsEmpty) {
+  PayloadSlice slice;
+  EXPECT_TRUE(slice.empty());
+  EXPECT_THAT(slice, IsEmpty());
+  EXPECT_THAT(std::move(slice).ToVector(), IsEmpty());
+}
+
+TEST(PayloadSliceTest, TakesVectorWithoutCopying) {
+  std::vector<uint8_t> data = {1, 2, 3, 4};
+  const uint8_t* bytes = data.data();
+  PayloadSlice slice(std::move(data));
+  EXPECT_EQ(slice.data(), bytes);
+  EXPECT_THAT(slice, ElementsAre(1, 2, 3, 4));
+}
+
+TEST(PayloadSliceTest, SubslicesShareBuffer) {
+  PayloadSlice slice(std::vector<uint8_t>{1, 2, 3, 4, 5});
+  PayloadSlice middle = slice.subslice(1, 3);
+  EXPECT_EQ(middle.data(), slice.data() + 1);
+  EXPECT_THAT(middle, ElementsAre(2, 3, 4));
+  EXPECT_THAT(middle.subslice(2, 1), ElementsAre(4));
+
+  webrtc::ArrayView<const uint8_t> view = slice;
+  PayloadSlice tail = slice.subslice(view.subview(3));
+  EXPECT_EQ(tail.data(), slice.data() + 3);
+  EXPECT_THAT(tail, ElementsAre(4, 5));
+}
+
+TEST(PayloadSliceTest, SubsliceOrCopySharesLargeParts) {
+  PayloadSlice slice(std::vector<uint8_t>{1, 2, 3, 4, 5, 6});
+  webrtc::ArrayView<const uint8_t> view = slice;
+  PayloadSlice half = slice.SubsliceOrCopy(view.subview(3));
+  EXPECT_EQ(half.data(), slice.data() + 3);
+  EXPECT_THAT(half, ElementsAre(4, 5, 6));
+}
+
+TEST(PayloadSliceTest, SubsliceOrCopyCopiesSmallParts) {
+  PayloadSlice slice(std::vector<uint8_t>{1, 2, 3, 4, 5, 6});
+  webrtc::ArrayView<const uint8_t> view = slice;
+  PayloadSlice small = slice.SubsliceOrCopy(view.subview(4));
+  EXPECT_TRUE(small.data() < slice.data() || small.data() >= slice.end());
+  EXPECT_THAT(small, ElementsAre(5, 6));
+}
+
+TEST(PayloadSliceTest, KeepsBufferAliveWhileReferenced) {
+  PayloadSlice middle;
+  {
+    PayloadSlice slice(std::vector<uint8_t>{1, 2, 3, 4, 5});
+    middle = slice.subslice(1, 2);
+  }
+  EXPECT_THAT(middle, ElementsAre(2, 3));
+}
+
+TEST(PayloadSliceTest, ReferencesExternalOwner) {
+  auto owner = std::make_shared<const std::vector<uint8_t>>(
+      std::vector<uint8_t>{7, 8, 9});
+  PayloadSlice slice(owner, *owner);
+  EXPECT_EQ(slice.data(), owner->data());
+  EXPECT_EQ(owner.use_count(), 2);
+  EXPECT_THAT(std::move(slice).ToVector(), ElementsAre(7, 8, 9));
+}
+
+TEST(PayloadSliceTest, ToVectorMovesOutWhenSoleOwner) {
+  std::vector<uint8_t> data = {1, 2, 3};
+  const uint8_t* bytes = data.data();
+  PayloadSlice slice(std::move(data));
+  std::vector<uint8_t> released = std::move(slice).ToVector();
+  EXPECT_EQ(released.data(), bytes);
+  EXPECT_THAT(released, ElementsAre(1, 2, 3));
+}
+
+TEST(PayloadSliceTest, ToVectorCopiesWhenShared) {
+  PayloadSlice slice(std::vector<uint8_t>{1, 2, 3});
+  PayloadSlice copy = slice;
+  std::vector<uint8_t> released = std::move(slice).ToVector();
+  EXPECT_NE(released.data(), copy.data());
+  EXPECT_THAT(released, ElementsAre(1, 2, 3));
+  EXPECT_THAT(copy, ElementsAre(1, 2, 3));
+}
+
+TEST(PayloadSliceTest, ToVectorCopiesPartOfBuffer) {
+  PayloadSlice slice =
+      PayloadSlice(std::vector<uint8_t>{1, 2, 3}).subslice(1, 2);
+  EXPECT_THAT(std::move(slice).ToVector(), ElementsAre(2, 3));
+}
+
+}  // namespace
+}  // namespace dcsctp
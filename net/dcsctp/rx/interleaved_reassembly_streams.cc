@@ -204,15 +204,10 @@ void InterleavedReassemblyStreams::Stream::AddHandoverState(
 
 InterleavedReassemblyStreams::Stream&
 InterleavedReassemblyStreams::GetOrCreateStream(const FullStreamId& stream_id) {
-  auto it = streams_.find(stream_id);
-  if (it == streams_.end()) {
-    it =
-        streams_
-            .emplace(std::piecewise_construct, std::forward_as_tuple(stream_id),
-                     std::forward_as_tuple(stream_id, this))
-            .first;
-  }
-  return it->second;
+  StreamTable<Stream>& streams =
+      stream_id.unordered ? unordered_streams_ : ordered_streams_;
+  return streams.try_emplace(stream_id.stream_id, stream_id, this)
+      .first->second;
 }
 
 int InterleavedReassemblyStreams::Add(UnwrappedTSN tsn, Data data) {
@@ -236,8 +231,11 @@ size_t InterleavedReassemblyStreams::HandleForwardTsn(
 void InterleavedReassemblyStreams::ResetStreams(
     webrtc::ArrayView<const StreamID> stream_ids) {
   if (stream_ids.empty()) {
-    for (auto& entry : streams_) {
-      entry.second.Reset();
+    for (auto& [unused, stream] : ordered_streams_) {
+      stream.Reset();
+    }
+    for (auto& [unused, stream] : unordered_streams_) {
+      stream.Reset();
     }
   } else {
     for (StreamID stream_id : stream_ids) {
@@ -250,21 +248,24 @@ void InterleavedReassemblyStreams::ResetStreams(
 HandoverReadinessStatus InterleavedReassemblyStreams::GetHandoverReadiness()
     const {
   HandoverReadinessStatus status;
-  for (const auto& [stream_id, stream] : streams_) {
-    if (stream.has_unassembled_chunks()) {
-      status.Add(
-          stream_id.unordered
-              ? HandoverUnreadinessReason::kUnorderedStreamHasUnassembledChunks
-              : HandoverUnreadinessReason::kOrderedStreamHasUnassembledChunks);
-      break;
-    }
+  if (absl::c_any_of(ordered_streams_, [](const auto& entry) {
+        return entry.second.has_unassembled_chunks();
+      })) {
+    status.Add(HandoverUnreadinessReason::kOrderedStreamHasUnassembledChunks);
+  } else if (absl::c_any_of(unordered_streams_, [](const auto& entry) {
+               return entry.second.has_unassembled_chunks();
+             })) {
+    status.Add(HandoverUnreadinessReason::kUnorderedStreamHasUnassembledChunks);
   }
   return status;
 }
 
 void InterleavedReassemblyStreams::AddHandoverState(
     DcSctpSocketHandoverState& state) {
-  for (const auto& [unused, stream] : streams_) {
+  for (const auto& [unused, stream] : ordered_streams_) {
+    stream.AddHandoverState(state);
+  }
+  for (const auto& [unused, stream] : unordered_streams_) {
     stream.AddHandoverState(state);
   }
 }
@@ -272,20 +273,19 @@ void InterleavedReassemblyStreams::AddHandoverState(
 void InterleavedReassemblyStreams::RestoreFromState(
     const DcSctpSocketHandoverState& state) {
   // Validate that the component is in pristine state.
-  RTC_DCHECK(streams_.empty());
+  RTC_DCHECK(ordered_streams_.empty());
+  RTC_DCHECK(unordered_streams_.empty());
 
   for (const DcSctpSocketHandoverState::OrderedStream& stream_state :
        state.rx.ordered_streams) {
     FullStreamId stream_id(IsUnordered(false), StreamID(stream_state.id));
-    streams_.emplace(
-        std::piecewise_construct, std::forward_as_tuple(stream_id),
-        std::forward_as_tuple(stream_id, this, MID(stream_state.next_ssn)));
+    ordered_streams_.try_emplace(stream_id.stream_id, stream_id, this,
+                                 MID(stream_state.next_ssn));
   }
   for (const DcSctpSocketHandoverState::UnorderedStream& stream_state :
        state.rx.unordered_streams) {
     FullStreamId stream_id(IsUnordered(true), StreamID(stream_state.id));
-    streams_.emplace(std::piecewise_construct, std::forward_as_tuple(stream_id),
-                     std::forward_as_tuple(stream_id, this));
+    unordered_streams_.try_emplace(stream_id.stream_id, stream_id, this);
   }
 }
 
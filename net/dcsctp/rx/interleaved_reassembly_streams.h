@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "net/dcsctp/common/sequence_numbers.h"
+#include "net/dcsctp/common/stream_table.h"
 #include "net/dcsctp/packet/chunk/forward_tsn_common.h"
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/rx/reassembly_streams.h"
@@ -52,10 +53,6 @@ class InterleavedReassemblyStreams : public ReassemblyStreams {
     FullStreamId(IsUnordered unordered, StreamID stream_id)
         : unordered(unordered), stream_id(stream_id) {}
 
-    friend bool operator<(FullStreamId a, FullStreamId b) {
-      return a.unordered < b.unordered ||
-             (!(a.unordered < b.unordered) && (a.stream_id < b.stream_id));
-    }
   };
 
   class Stream {
@@ -103,8 +100,9 @@ class InterleavedReassemblyStreams : public ReassemblyStreams {
   // Callback for when a message has been assembled.
   const OnAssembledMessage on_assembled_message_;
 
-  // All unordered and ordered streams, managing not-yet-assembled data.
-  std::map<FullStreamId, Stream> streams_;
+  // All ordered and unordered streams, managing not-yet-assembled data.
+  StreamTable<Stream> ordered_streams_;
+  StreamTable<Stream> unordered_streams_;
 };
 
 }  // namespace dcsctp
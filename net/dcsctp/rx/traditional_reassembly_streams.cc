@@ -364,16 +364,12 @@ void TraditionalReassemblyStreams::RestoreFromState(
 
   for (const DcSctpSocketHandoverState::OrderedStream& state_stream :
        state.rx.ordered_streams) {
-    ordered_streams_.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(StreamID(state_stream.id)),
-        std::forward_as_tuple(this, SSN(state_stream.next_ssn)));
+    ordered_streams_.try_emplace(StreamID(state_stream.id), this,
+                                 SSN(state_stream.next_ssn));
   }
   for (const DcSctpSocketHandoverState::UnorderedStream& state_stream :
        state.rx.unordered_streams) {
-    unordered_streams_.emplace(std::piecewise_construct,
-                               std::forward_as_tuple(StreamID(state_stream.id)),
-                               std::forward_as_tuple(this));
+    unordered_streams_.try_emplace(StreamID(state_stream.id), this);
   }
 }
 
@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "net/dcsctp/common/sequence_numbers.h"
+#include "net/dcsctp/common/stream_table.h"
 #include "net/dcsctp/packet/chunk/forward_tsn_common.h"
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/rx/reassembly_streams.h"
@@ -119,8 +120,8 @@ class TraditionalReassemblyStreams : public ReassemblyStreams {
   const OnAssembledMessage on_assembled_message_;
 
   // All unordered and ordered streams, managing not-yet-assembled data.
-  std::map<StreamID, UnorderedStream> unordered_streams_;
-  std::map<StreamID, OrderedStream> ordered_streams_;
+  StreamTable<UnorderedStream> unordered_streams_;
+  StreamTable<OrderedStream> ordered_streams_;
 };
 
 }  // namespace dcsctp
@@ -42,6 +42,13 @@ SendPacketStatus CallbackDeferrer::SendPacketWithStatus(
   return underlying_.SendPacketWithStatus(data);
 }
 
+void CallbackDeferrer::SendPacketsWithStatus(
+    webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>> packets,
+    webrtc::ArrayView<SendPacketStatus> statuses) {
+  // Will not be deferred - call directly.
+  underlying_.SendPacketsWithStatus(packets, statuses);
+}
+
 std::unique_ptr<Timeout> CallbackDeferrer::CreateTimeout(
     webrtc::TaskQueueBase::DelayPrecision precision) {
   // Will not be deferred - call directly.
@@ -63,6 +63,9 @@ class CallbackDeferrer : public DcSctpSocketCallbacks {
   // Implementation of DcSctpSocketCallbacks
   SendPacketStatus SendPacketWithStatus(
       webrtc::ArrayView<const uint8_t> data) override;
+  void SendPacketsWithStatus(
+      webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>> packets,
+      webrtc::ArrayView<SendPacketStatus> statuses) override;
   std::unique_ptr<Timeout> CreateTimeout(
       webrtc::TaskQueueBase::DelayPrecision precision) override;
   TimeMs TimeMillis() override;
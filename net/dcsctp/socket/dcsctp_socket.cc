@@ -816,7 +816,7 @@ void DcSctpSocket::ReceivePacket(webrtc::ArrayView<const uint8_t> data) {
   MaybeSendShutdownOnPacketReceived(*packet);
 
   for (const auto& descriptor : packet->descriptors()) {
-    if (!Dispatch(packet->common_header(), descriptor)) {
+    if (!Dispatch(*packet, descriptor)) {
       break;
     }
   }
@@ -840,11 +840,12 @@ void DcSctpSocket::DebugPrintOutgoing(
   }
 }
 
-bool DcSctpSocket::Dispatch(const CommonHeader& header,
+bool DcSctpSocket::Dispatch(const SctpPacket& packet,
                             const SctpPacket::ChunkDescriptor& descriptor) {
+  const CommonHeader& header = packet.common_header();
   switch (descriptor.type) {
     case DataChunk::kType:
-      HandleData(header, descriptor);
+      HandleData(packet, descriptor);
       break;
     case InitChunk::kType:
       HandleInit(header, descriptor);
@@ -889,7 +890,7 @@ bool DcSctpSocket::Dispatch(const CommonHeader& header,
       HandleForwardTsn(header, descriptor);
       break;
     case IDataChunk::kType:
-      HandleIData(header, descriptor);
+      HandleIData(packet, descriptor);
       break;
     case IForwardTsnChunk::kType:
       HandleIForwardTsn(header, descriptor);
@@ -1043,17 +1044,19 @@ void DcSctpSocket::ReportFailedToParseChunk(int chunk_type) {
   callbacks_.OnError(ErrorKind::kParseFailed, sb.str());
 }
 
-void DcSctpSocket::HandleData(const CommonHeader& /* header */,
+void DcSctpSocket::HandleData(const SctpPacket& packet,
                               const SctpPacket::ChunkDescriptor& descriptor) {
-  std::optional<DataChunk> chunk = DataChunk::Parse(descriptor.data);
+  std::optional<DataChunk> chunk =
+      DataChunk::Parse(descriptor.data, packet.buffer());
   if (ValidateParseSuccess(chunk) && ValidateHasTCB()) {
     HandleDataCommon(*chunk);
   }
 }
 
-void DcSctpSocket::HandleIData(const CommonHeader& /* header */,
+void DcSctpSocket::HandleIData(const SctpPacket& packet,
                                const SctpPacket::ChunkDescriptor& descriptor) {
-  std::optional<IDataChunk> chunk = IDataChunk::Parse(descriptor.data);
+  std::optional<IDataChunk> chunk =
+      IDataChunk::Parse(descriptor.data, packet.buffer());
   if (ValidateParseSuccess(chunk) && ValidateHasTCB()) {
     HandleDataCommon(*chunk);
   }
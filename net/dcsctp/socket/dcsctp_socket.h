@@ -206,13 +206,13 @@ class DcSctpSocket : public DcSctpSocketInterface {
   bool HandleUnrecognizedChunk(const SctpPacket::ChunkDescriptor& descriptor);
 
   // Will dispatch more specific chunk handlers.
-  bool Dispatch(const CommonHeader& header,
+  bool Dispatch(const SctpPacket& packet,
                 const SctpPacket::ChunkDescriptor& descriptor);
-  // Handles incoming DATA chunks.
-  void HandleData(const CommonHeader& header,
+  // Handles incoming DATA chunks. The payload references the packet's buffer.
+  void HandleData(const SctpPacket& packet,
                   const SctpPacket::ChunkDescriptor& descriptor);
-  // Handles incoming I-DATA chunks.
-  void HandleIData(const CommonHeader& header,
+  // Handles incoming I-DATA chunks. The payload references the packet's buffer.
+  void HandleIData(const SctpPacket& packet,
                    const SctpPacket::ChunkDescriptor& descriptor);
   // Common handler for DATA and I-DATA chunks.
   void HandleDataCommon(AnyDataChunk& chunk);
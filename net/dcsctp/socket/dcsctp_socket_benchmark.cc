@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/public/dcsctp_message.h"
+#include "net/dcsctp/public/dcsctp_options.h"
+#include "net/dcsctp/public/dcsctp_socket.h"
+#include "net/dcsctp/public/timeout.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/socket/dcsctp_socket.h"
+#include "net/dcsctp/timer/fake_timeout.h"
+#include "rtc_base/random.h"
+
+namespace dcsctp {
+namespace {
+
+constexpr size_t kMessageSize = 128 * 1024;
+
+// Callbacks that queue the sent packets, to be delivered to the peer, and that
+// count how many times the client is called to send them. With `batch`, a
+// burst of packets is accepted in a single call, as a transport that
+// implements `SendPacketsWithStatus` would.
+class LoopbackCallbacks : public DcSctpSocketCallbacks {
+ public:
+  explicit LoopbackCallbacks(bool batch)
+      : batch_(batch), random_(42), timeout_manager_([this] { return now_; }) {}
+
+  SendPacketStatus SendPacketWithStatus(
+      webrtc::ArrayView<const uint8_t> data) override {
+    ++send_calls_;
+    packets_.emplace_back(data.begin(), data.end());
+    return SendPacketStatus::kSuccess;
+  }
+
+  void SendPacketsWithStatus(
+      webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>> packets,
+      webrtc::ArrayView<SendPacketStatus> statuses) override {
+    if (!batch_) {
+      DcSctpSocketCallbacks::SendPacketsWithStatus(packets, statuses);
+      return;
+    }
+    ++send_calls_;
+    for (size_t i = 0; i < packets.size(); ++i) {
+      packets_.emplace_back(packets[i].begin(), packets[i].end());
+      statuses[i] = SendPacketStatus::kSuccess;
+    }
+  }
+
+  std::unique_ptr<Timeout> CreateTimeout(
+      webrtc::TaskQueueBase::DelayPrecision /* precision */) override {
+    return timeout_manager_.CreateTimeout();
+  }
+  webrtc::Timestamp Now() override { return now_; }
+  uint32_t GetRandomInt(uint32_t low, uint32_t high) override {
+    return random_.Rand(low, high);
+  }
+  void OnMessageReceived(DcSctpMessage /* message */) override {
+    ++received_messages_;
+  }
+  void OnError(ErrorKind /* error */,
+               absl::string_view /* message */) override {}
+  void OnAborted(ErrorKind /* error */,
+                 absl::string_view /* message */) override {}
+  void OnConnected() override {}
+  void OnClosed() override {}
+  void OnConnectionRestarted() override {}
+  void OnStreamsResetFailed(
+      webrtc::ArrayView<const StreamID> /* outgoing_streams */,
+      absl::string_view /* reason */) override {}
+  void OnStreamsResetPerformed(
+      webrtc::ArrayView<const StreamID> /* outgoing_streams */) override {}
+  void OnIncomingStreamsReset(
+      webrtc::ArrayView<const StreamID> /* incoming_streams */) override {}
+
+  // Delivers the queued packets to `peer`. Returns false if there were none.
+  bool DeliverTo(DcSctpSocket& peer) {
+    if (packets_.empty()) {
+      return false;
+    }
+    std::deque<std::vector<uint8_t>> packets;
+    packets.swap(packets_);
+    for (const std::vector<uint8_t>& packet : packets) {
+      peer.ReceivePacket(packet);
+    }
+    return true;
+  }
+
+  webrtc::TimeDelta GetTimeToNextTimeout() const {
+    return timeout_manager_.GetTimeToNextTimeout();
+  }
+
+  void AdvanceTimeAndRunTimers(webrtc::TimeDelta duration,
+                               DcSctpSocket& socket) {
+    now_ += duration;
+    while (std::optional<TimeoutID> timeout_id =
+               timeout_manager_.GetNextExpiredTimeout()) {
+      socket.HandleTimeout(*timeout_id);
+    }
+  }
+
+  size_t send_calls() const { return send_calls_; }
+  size_t received_messages() const { return received_messages_; }
+
+ private:
+  const bool batch_;
+  webrtc::Timestamp now_ = webrtc::Timestamp::Seconds(1);
+  webrtc::Random random_;
+  FakeTimeoutManager timeout_manager_;
+  std::deque<std::vector<uint8_t>> packets_;
+  size_t send_calls_ = 0;
+  size_t received_messages_ = 0;
+};
+
+struct Peer {
+  explicit Peer(absl::string_view name, bool batch)
+      : cb(batch), socket(name, cb, /*packet_observer=*/nullptr, {}) {}
+
+  LoopbackCallbacks cb;
+  DcSctpSocket socket;
+};
+
+// Exchanges packets between `a` and `z`, over a lossless link without delay,
+// until `z` has received `messages` messages. When no packets are in flight,
+// time is advanced to the next timeout, e.g. for a delayed SACK.
+void RunUntilReceived(Peer& a, Peer& z, size_t messages) {
+  while (z.cb.received_messages() < messages) {
+    bool delivered = a.cb.DeliverTo(z.socket);
+    delivered |= z.cb.DeliverTo(a.socket);
+    if (!delivered) {
+      webrtc::TimeDelta duration = std::min(a.cb.GetTimeToNextTimeout(),
+                                            z.cb.GetTimeToNextTimeout());
+      a.cb.AdvanceTimeAndRunTimers(duration, a.socket);
+      z.cb.AdvanceTimeAndRunTimers(duration, z.socket);
+    }
+  }
+}
+
+// Sends large messages from one socket to another, through a loopback link, to
+// measure the processing cost per byte of the sending and receiving sockets.
+// With `batch`, packets sent in bursts are handed to the client with a single
+// callback.
+void BM_DcSctpSocketLoopback(benchmark::State& state) {
+  const bool batch = state.range(0) != 0;
+  Peer a("A", batch);
+  Peer z("Z", batch);
+  a.socket.Connect();
+  bool delivered = true;
+  while (delivered) {
+    delivered = a.cb.DeliverTo(z.socket);
+    delivered |= z.cb.DeliverTo(a.socket);
+  }
+
+  const std::vector<uint8_t> payload(kMessageSize);
+  size_t messages = 0;
+  size_t send_calls = a.cb.send_calls() + z.cb.send_calls();
+  for (auto _ : state) {
+    a.socket.Send(DcSctpMessage(StreamID(1), PPID(53), payload), {});
+    RunUntilReceived(a, z, ++messages);
+  }
+  send_calls = a.cb.send_calls() + z.cb.send_calls() - send_calls;
+  state.SetBytesProcessed(messages * kMessageSize);
+  state.counters["send_calls_per_mb"] =
+      static_cast<double>(send_calls) * 1024 * 1024 / (messages * kMessageSize);
+}
+
+BENCHMARK(BM_DcSctpSocketLoopback)->ArgName("batch")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace dcsctp
@@ -10,6 +10,7 @@
 #ifndef NET_DCSCTP_SOCKET_MOCK_DCSCTP_SOCKET_CALLBACKS_H_
 #define NET_DCSCTP_SOCKET_MOCK_DCSCTP_SOCKET_CALLBACKS_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -63,6 +64,15 @@ class MockDcSctpSocketCallbacks : public DcSctpSocketCallbacks {
               std::vector<uint8_t>(data.begin(), data.end()));
           return SendPacketStatus::kSuccess;
         });
+    ON_CALL(*this, SendPacketsWithStatus)
+        .WillByDefault(
+            [this](webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>>
+                       packets,
+                   webrtc::ArrayView<SendPacketStatus> statuses) {
+              for (size_t i = 0; i < packets.size(); ++i) {
+                statuses[i] = SendPacketWithStatus(packets[i]);
+              }
+            });
     ON_CALL(*this, OnMessageReceived)
         .WillByDefault([this](DcSctpMessage message) {
           received_messages_.emplace_back(std::move(message));
@@ -87,6 +97,12 @@ class MockDcSctpSocketCallbacks : public DcSctpSocketCallbacks {
               SendPacketWithStatus,
               (webrtc::ArrayView<const uint8_t> data),
               (override));
+  MOCK_METHOD(
+      void,
+      SendPacketsWithStatus,
+      (webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>> packets,
+       webrtc::ArrayView<SendPacketStatus> statuses),
+      (override));
 
   std::unique_ptr<Timeout> CreateTimeout(
       webrtc::TaskQueueBase::DelayPrecision /* precision */) override {
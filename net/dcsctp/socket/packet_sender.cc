@@ -9,9 +9,14 @@
  */
 #include "net/dcsctp/socket/packet_sender.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "api/array_view.h"
+#include "net/dcsctp/packet/sctp_packet.h"
+#include "net/dcsctp/public/dcsctp_socket.h"
 #include "net/dcsctp/public/types.h"
 
 namespace dcsctp {
@@ -25,11 +30,33 @@ bool PacketSender::Send(SctpPacket::Builder& builder, bool write_checksum) {
   if (builder.empty()) {
     return false;
   }
-
+  if (batch_depth_ > 0 && !last_send_failed_) {
+    batch_.push_back(builder.Build(write_checksum));
+    return true;
+  }
   std::vector<uint8_t> payload = builder.Build(write_checksum);
+  return OnSent(payload, callbacks_.SendPacketWithStatus(payload));
+}
 
-  SendPacketStatus status = callbacks_.SendPacketWithStatus(payload);
-  on_sent_packet_(payload, status);
+void PacketSender::SendBatch() {
+  if (batch_.size() == 1) {
+    OnSent(batch_[0], callbacks_.SendPacketWithStatus(batch_[0]));
+  } else if (!batch_.empty()) {
+    batch_views_.assign(batch_.begin(), batch_.end());
+    batch_statuses_.assign(batch_.size(), SendPacketStatus::kError);
+    callbacks_.SendPacketsWithStatus(batch_views_, batch_statuses_);
+    for (size_t i = 0; i < batch_.size(); ++i) {
+      OnSent(batch_[i], batch_statuses_[i]);
+    }
+    batch_views_.clear();
+  }
+  batch_.clear();
+}
+
+bool PacketSender::OnSent(webrtc::ArrayView<const uint8_t> packet,
+                          SendPacketStatus status) {
+  on_sent_packet_(packet, status);
+  last_send_failed_ = status != SendPacketStatus::kSuccess;
   switch (status) {
     case SendPacketStatus::kSuccess: {
       return true;
@@ -38,11 +65,11 @@ bool PacketSender::Send(SctpPacket::Builder& builder, bool write_checksum) {
       // TODO(boivie): Queue this packet to be retried to be sent later.
       return false;
     }
-
     case SendPacketStatus::kError: {
       // Nothing that can be done.
       return false;
     }
   }
 }
+
 }  // namespace dcsctp
@@ -10,6 +10,11 @@
 #ifndef NET_DCSCTP_SOCKET_PACKET_SENDER_H_
 #define NET_DCSCTP_SOCKET_PACKET_SENDER_H_
 
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "api/array_view.h"
 #include "net/dcsctp/packet/sctp_packet.h"
 #include "net/dcsctp/public/dcsctp_socket.h"
 
@@ -20,20 +25,60 @@ namespace dcsctp {
 // callback will be triggered.
 class PacketSender {
  public:
+  // While a batch is alive, packets given to `Send` are held back, and are then
+  // sent together, in order, with a single call to
+  // `DcSctpSocketCallbacks::SendPacketsWithStatus` when it goes out of scope.
+  // Batches may be nested, and the outermost one sends the packets.
+  //
+  // After a send attempt has failed, e.g. with
+  // `SendPacketStatus::kTemporaryFailure` as the transport's send buffer was
+  // full, packets are sent one by one, also within a batch, until the
+  // transport accepts one again. That lets the caller stop producing packets
+  // at the first one that can't be sent, instead of only finding out when the
+  // whole batch is sent.
+  class ScopedBatch {
+   public:
+    explicit ScopedBatch(PacketSender& sender) : sender_(sender) {
+      ++sender_.batch_depth_;
+    }
+    ScopedBatch(const ScopedBatch&) = delete;
+    ScopedBatch& operator=(const ScopedBatch&) = delete;
+    ~ScopedBatch() {
+      if (--sender_.batch_depth_ == 0) {
+        sender_.SendBatch();
+      }
+    }
+
+   private:
+    PacketSender& sender_;
+  };
+
   PacketSender(DcSctpSocketCallbacks& callbacks,
                std::function<void(webrtc::ArrayView<const uint8_t>,
                                   SendPacketStatus)> on_sent_packet);
 
-  // Sends the packet, and returns true if it was sent successfully.
+  // Sends the packet, and returns true if it was sent successfully. Within a
+  // batch, the packet is only built, and this returns true if it wasn't empty,
+  // unless the last send attempt failed, see `ScopedBatch`.
   bool Send(SctpPacket::Builder& builder, bool write_checksum = true);
 
  private:
-  DcSctpSocketCallbacks& callbacks_;
+  void SendBatch();
+  // Reports the send attempt of `packet`, and returns true if it was sent.
+  bool OnSent(webrtc::ArrayView<const uint8_t> packet, SendPacketStatus status);
 
+  DcSctpSocketCallbacks& callbacks_;
   // Callback that will be triggered for every send attempt, indicating the
   // status of the operation.
   std::function<void(webrtc::ArrayView<const uint8_t>, SendPacketStatus)>
       on_sent_packet_;
+
+  int batch_depth_ = 0;
+  bool last_send_failed_ = false;
+  std::vector<std::vector<uint8_t>> batch_;
+  // Reused between batches, to avoid allocating them for every burst.
+  std::vector<webrtc::ArrayView<const uint8_t>> batch_views_;
+  std::vector<SendPacketStatus> batch_statuses_;
 };
 }  // namespace dcsctp
 
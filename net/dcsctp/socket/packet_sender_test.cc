@@ -9,6 +9,10 @@
  */
 #include "net/dcsctp/socket/packet_sender.h"
 
+#include <cstdint>
+#include <vector>
+
+#include "api/array_view.h"
 #include "net/dcsctp/common/internal_types.h"
 #include "net/dcsctp/packet/chunk/cookie_ack_chunk.h"
 #include "net/dcsctp/socket/mock_dcsctp_socket_callbacks.h"
@@ -47,5 +51,86 @@ TEST_F(PacketSenderTest, SendPacketCallsCallback) {
   EXPECT_FALSE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
 }
 
+TEST_F(PacketSenderTest, SendsBatchedPacketsTogether) {
+  EXPECT_CALL(callbacks_, SendPacketsWithStatus).Times(0);
+  {
+    PacketSender::ScopedBatch batch(sender_);
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+    SctpPacket::Builder empty_builder = PacketBuilder();
+    EXPECT_FALSE(sender_.Send(empty_builder));
+    EXPECT_EQ(callbacks_.ConsumeSentPacket(), std::vector<uint8_t>());
+    testing::Mock::VerifyAndClearExpectations(&callbacks_);
+
+    EXPECT_CALL(callbacks_, SendPacketsWithStatus)
+        .WillOnce([](webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>>
+                         packets,
+                     webrtc::ArrayView<SendPacketStatus> statuses) {
+          ASSERT_EQ(packets.size(), 2u);
+          statuses[0] = SendPacketStatus::kSuccess;
+          statuses[1] = SendPacketStatus::kTemporaryFailure;
+        });
+    EXPECT_CALL(on_send_fn_, Call(_, SendPacketStatus::kSuccess));
+    EXPECT_CALL(on_send_fn_, Call(_, SendPacketStatus::kTemporaryFailure));
+  }
+}
+
+TEST_F(PacketSenderTest, SendsSinglePacketInBatchDirectly) {
+  EXPECT_CALL(callbacks_, SendPacketsWithStatus).Times(0);
+  EXPECT_CALL(callbacks_, SendPacketWithStatus);
+  EXPECT_CALL(on_send_fn_, Call(_, SendPacketStatus::kSuccess));
+  PacketSender::ScopedBatch batch(sender_);
+  {
+    PacketSender::ScopedBatch inner_batch(sender_);
+    sender_.Send(PacketBuilder().Add(CookieAckChunk()));
+  }
+}
+
+TEST_F(PacketSenderTest, SendsPacketsOneByOneAfterTemporaryFailure) {
+  EXPECT_CALL(callbacks_, SendPacketsWithStatus)
+      .WillOnce([](webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>>
+                       packets,
+                   webrtc::ArrayView<SendPacketStatus> statuses) {
+        ASSERT_EQ(packets.size(), 2u);
+        statuses[0] = SendPacketStatus::kTemporaryFailure;
+        statuses[1] = SendPacketStatus::kTemporaryFailure;
+      });
+  {
+    PacketSender::ScopedBatch batch(sender_);
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+  }
+  testing::Mock::VerifyAndClearExpectations(&callbacks_);
+
+  // While the transport is blocked, the sender finds out at the first packet
+  // that can't be sent, and can stop there.
+  EXPECT_CALL(callbacks_, SendPacketsWithStatus).Times(0);
+  EXPECT_CALL(callbacks_, SendPacketWithStatus)
+      .WillOnce(testing::Return(SendPacketStatus::kTemporaryFailure));
+  {
+    PacketSender::ScopedBatch batch(sender_);
+    EXPECT_FALSE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+  }
+  testing::Mock::VerifyAndClearExpectations(&callbacks_);
+
+  // Once a packet goes through, the following ones are batched again.
+  EXPECT_CALL(callbacks_, SendPacketWithStatus)
+      .WillOnce(testing::Return(SendPacketStatus::kSuccess));
+  EXPECT_CALL(callbacks_, SendPacketsWithStatus)
+      .WillOnce([](webrtc::ArrayView<const webrtc::ArrayView<const uint8_t>>
+                       packets,
+                   webrtc::ArrayView<SendPacketStatus> statuses) {
+        ASSERT_EQ(packets.size(), 2u);
+        statuses[0] = SendPacketStatus::kSuccess;
+        statuses[1] = SendPacketStatus::kSuccess;
+      });
+  {
+    PacketSender::ScopedBatch batch(sender_);
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+    EXPECT_TRUE(sender_.Send(PacketBuilder().Add(CookieAckChunk())));
+  }
+}
+
 }  // namespace
 }  // namespace dcsctp
@@ -209,6 +209,11 @@ void TransmissionControlBlock::MaybeSendFastRetransmit() {
 
 void TransmissionControlBlock::SendBufferedPackets(SctpPacket::Builder& builder,
                                                    Timestamp now) {
+  // The packets of a burst are handed to the client together, so that it can
+  // send them more efficiently than one by one. While the transport is
+  // blocked, the packet sender sends them one by one, so that the burst stops
+  // at the first packet that can't be sent.
+  PacketSender::ScopedBatch batch(packet_sender_);
   for (int packet_idx = 0; packet_idx < options_.max_burst; ++packet_idx) {
     // Only add control chunks to the first packet that is sent, if sending
     // multiple packets in one go (as allowed by the congestion window).
@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/algorithm/container.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "net/dcsctp/common/math.h"
@@ -76,6 +77,73 @@ bool OutstandingData::Item::has_expired(Timestamp now) const {
   return expires_at_ <= now;
 }
 
+template <typename Fn>
+void OutstandingData::AckedTsnRanges::Add(UnwrappedTSN first,
+                                          UnwrappedTSN last,
+                                          Fn on_added) {
+  RTC_DCHECK(first <= last);
+  // Find the first range that overlaps with, or is adjacent to, [first, last].
+  auto begin = absl::c_lower_bound(
+      ranges_, first, [&](const TsnRange& elem, const UnwrappedTSN& t) {
+        return elem.last.next_value() < t;
+      });
+
+  // Report the TSNs before, between and after the ranges that are merged.
+  TsnRange merged(first, last);
+  UnwrappedTSN tsn = first;
+  auto end = begin;
+  for (; end != ranges_.end() && end->first <= last.next_value(); ++end) {
+    for (; tsn < end->first && tsn <= last; tsn.Increment()) {
+      on_added(tsn);
+    }
+    merged.first = std::min(merged.first, end->first);
+    merged.last = std::max(merged.last, end->last);
+    tsn = std::max(tsn, end->last.next_value());
+  }
+  for (; tsn <= last; tsn.Increment()) {
+    on_added(tsn);
+  }
+
+  if (begin == end) {
+    ranges_.insert(begin, merged);
+  } else {
+    *begin = merged;
+    ranges_.erase(begin + 1, end);
+  }
+}
+
+void OutstandingData::AckedTsnRanges::Remove(UnwrappedTSN tsn) {
+  auto it = absl::c_lower_bound(
+      ranges_, tsn, [&](const TsnRange& elem, const UnwrappedTSN& t) {
+        return elem.last < t;
+      });
+  if (it == ranges_.end() || tsn < it->first) {
+    return;
+  }
+  if (it->first == it->last) {
+    ranges_.erase(it);
+  } else if (it->first == tsn) {
+    it->first = tsn.next_value();
+  } else if (it->last == tsn) {
+    it->last = UnwrappedTSN::AddTo(tsn, -1);
+  } else {
+    UnwrappedTSN first = it->first;
+    it->first = tsn.next_value();
+    ranges_.emplace(it, first, UnwrappedTSN::AddTo(tsn, -1));
+  }
+}
+
+void OutstandingData::AckedTsnRanges::EraseTo(UnwrappedTSN tsn) {
+  auto it = absl::c_lower_bound(
+      ranges_, tsn, [&](const TsnRange& elem, const UnwrappedTSN& t) {
+        return elem.last <= t;
+      });
+  ranges_.erase(ranges_.begin(), it);
+  if (!ranges_.empty() && ranges_.front().first <= tsn) {
+    ranges_.front().first = tsn.next_value();
+  }
+}
+
 bool OutstandingData::IsConsistent() const {
   size_t actual_unacked_payload_bytes = 0;
   size_t actual_unacked_packet_bytes = 0;
@@ -88,9 +156,18 @@ bool OutstandingData::IsConsistent() const {
                                       to_be_fast_retransmitted_.end());
 
   std::set<UnwrappedTSN> actual_combined_to_be_retransmitted;
+  std::vector<AckedTsnRanges::TsnRange> actual_acked_tsns;
   UnwrappedTSN tsn = last_cumulative_tsn_ack_;
   for (const Item& item : outstanding_data_) {
     tsn.Increment();
+    if (item.is_acked()) {
+      if (!actual_acked_tsns.empty() &&
+          actual_acked_tsns.back().last.next_value() == tsn) {
+        actual_acked_tsns.back().last = tsn;
+      } else {
+        actual_acked_tsns.emplace_back(tsn, tsn);
+      }
+    }
     if (item.is_outstanding()) {
       actual_unacked_payload_bytes += item.data().size();
       actual_unacked_packet_bytes += GetSerializedChunkSize(item.data());
@@ -105,7 +182,8 @@ bool OutstandingData::IsConsistent() const {
   return actual_unacked_payload_bytes == unacked_payload_bytes_ &&
          actual_unacked_packet_bytes == unacked_packet_bytes_ &&
          actual_unacked_items == unacked_items_ &&
-         actual_combined_to_be_retransmitted == combined_to_be_retransmitted;
+         actual_combined_to_be_retransmitted == combined_to_be_retransmitted &&
+         actual_acked_tsns == acked_tsns_.ranges();
 }
 
 void OutstandingData::AckChunk(AckInfo& ack_info,
@@ -184,6 +262,7 @@ void OutstandingData::RemoveAcked(UnwrappedTSN cumulative_tsn_ack,
     outstanding_data_.pop_front();
     last_cumulative_tsn_ack_.Increment();
   }
+  acked_tsns_.EraseTo(last_cumulative_tsn_ack_);
 
   stream_reset_breakpoint_tsns_.erase(stream_reset_breakpoint_tsns_.begin(),
                                       stream_reset_breakpoint_tsns_.upper_bound(
@@ -199,14 +278,20 @@ void OutstandingData::AckGapBlocks(
   // SACK chunk as advisory.". Note that when NR-SACK is supported, this can be
   // handled differently.
 
+  //
+  // Chunks that are already acked are skipped, so that the cost is proportional
+  // to the number of newly acked chunks rather than to the size of the blocks.
   for (auto& block : gap_ack_blocks) {
-    UnwrappedTSN start = UnwrappedTSN::AddTo(cumulative_tsn_ack, block.start);
-    UnwrappedTSN end = UnwrappedTSN::AddTo(cumulative_tsn_ack, block.end);
-    for (UnwrappedTSN tsn = start; tsn <= end; tsn = tsn.next_value()) {
-      if (tsn > last_cumulative_tsn_ack_ && tsn < next_tsn()) {
-        Item& item = GetItem(tsn);
-        AckChunk(ack_info, tsn, item);
-      }
+    UnwrappedTSN start =
+        std::max(UnwrappedTSN::AddTo(cumulative_tsn_ack, block.start),
+                 last_cumulative_tsn_ack_.next_value());
+    UnwrappedTSN end =
+        std::min(UnwrappedTSN::AddTo(cumulative_tsn_ack, block.end),
+                 highest_outstanding_tsn());
+    if (start <= end) {
+      acked_tsns_.Add(start, end, [&](UnwrappedTSN tsn) {
+        AckChunk(ack_info, tsn, GetItem(tsn));
+      });
     }
   }
 }
@@ -265,6 +350,9 @@ bool OutstandingData::NackItem(UnwrappedTSN tsn,
     unacked_payload_bytes_ -= item.data().size();
     unacked_packet_bytes_ -= GetSerializedChunkSize(item.data());
     --unacked_items_;
+  } else if (item.is_acked()) {
+    // Gap ack blocks are advisory, and the peer has dropped this chunk.
+    acked_tsns_.Remove(tsn);
   }
 
   switch (item.Nack(retransmit_now)) {
@@ -309,6 +397,7 @@ void OutstandingData::AbandonAllFor(const Item& item) {
     // The added chunk shouldn't be included in `unacked_bytes`, so set it
     // as acked.
     added_item.Ack();
+    acked_tsns_.Add(tsn, tsn, [](UnwrappedTSN) {});
     RTC_DLOG(LS_VERBOSE) << "Adding unsent end placeholder for message at tsn="
                          << *tsn.Wrap();
   }
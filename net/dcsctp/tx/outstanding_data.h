@@ -295,6 +295,43 @@ class OutstandingData {
     const Data data_;
   };
 
+  // The TSNs of outstanding chunks that are acked, as a sorted set of ranges.
+  // A gap ack block is repeated in every SACK until the cumulative TSN ack
+  // passes it, and this allows a SACK to only visit the chunks that it acks
+  // for the first time, rather than every chunk covered by its blocks.
+  class AckedTsnRanges {
+   public:
+    // Represents an inclusive range of acked TSNs, i.e. [first, last].
+    struct TsnRange {
+      TsnRange(UnwrappedTSN first, UnwrappedTSN last)
+          : first(first), last(last) {}
+      UnwrappedTSN first;
+      UnwrappedTSN last;
+
+      bool operator==(const TsnRange& other) const {
+        return first == other.first && last == other.last;
+      }
+    };
+
+    // Adds all TSNs in [first, last] to the set, merging it with overlapping
+    // and adjacent ranges. Calls `on_added` with every TSN that wasn't already
+    // in the set, in increasing order.
+    template <typename Fn>
+    void Add(UnwrappedTSN first, UnwrappedTSN last, Fn on_added);
+
+    // Removes `tsn` from the set, possibly splitting the range containing it.
+    void Remove(UnwrappedTSN tsn);
+
+    // Erases all TSNs up to, and including `tsn`.
+    void EraseTo(UnwrappedTSN tsn);
+
+    const std::vector<TsnRange>& ranges() const { return ranges_; }
+
+   private:
+    // A sorted vector of non-overlapping and non-adjacent ranges.
+    std::vector<TsnRange> ranges_;
+  };
+
   // Returns how large a chunk will be, serialized, carrying the data
   size_t GetSerializedChunkSize(const Data& data) const;
 
@@ -370,6 +407,8 @@ class OutstandingData {
   // The number of DATA chunks that are in-flight (sent but not yet acked or
   // nacked).
   size_t unacked_items_ = 0;
+  // The TSNs of all items in `outstanding_data_` that are acked.
+  AckedTsnRanges acked_tsns_;
   // Data chunks that are eligible for fast retransmission.
   std::set<UnwrappedTSN> to_be_fast_retransmitted_;
   // Data chunks that are to be retransmitted.
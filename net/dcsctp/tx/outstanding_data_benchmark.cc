@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/common/sequence_numbers.h"
+#include "net/dcsctp/packet/chunk/data_chunk.h"
+#include "net/dcsctp/packet/chunk/sack_chunk.h"
+#include "net/dcsctp/packet/data.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/testing/data_generator.h"
+#include "net/dcsctp/tx/outstanding_data.h"
+#include "rtc_base/random.h"
+
+namespace dcsctp {
+namespace {
+
+constexpr size_t kMaxPacketSize = 1200;
+constexpr webrtc::Timestamp kNow = webrtc::Timestamp::Seconds(1);
+
+// Tracks which chunks a peer has received and creates the SACKs it would send,
+// without capping the number of gap ack blocks. Chunks are identified by their
+// offset from the first one sent.
+class Receiver {
+ public:
+  void Receive(int offset) {
+    if (offset <= cumulative_) {
+      return;
+    }
+    if (offset == cumulative_ + 1) {
+      cumulative_ = offset;
+      if (!blocks_.empty() && blocks_.front().first == cumulative_ + 1) {
+        cumulative_ = blocks_.front().second;
+        blocks_.erase(blocks_.begin());
+      }
+      return;
+    }
+    if (blocks_.empty() || offset > blocks_.back().second + 1) {
+      blocks_.emplace_back(offset, offset);
+      return;
+    }
+    // A retransmission filling a hole. Extend the block before or after it,
+    // and merge them if it was the only missing chunk in between.
+    auto it = blocks_.begin();
+    while (it->second + 1 < offset) {
+      ++it;
+    }
+    if (offset >= it->first && offset <= it->second) {
+      return;
+    }
+    if (it->second + 1 == offset) {
+      it->second = offset;
+      auto next = it + 1;
+      if (next != blocks_.end() && next->first == offset + 1) {
+        it->second = next->second;
+        blocks_.erase(next);
+      }
+    } else if (it->first == offset + 1) {
+      it->first = offset;
+    } else {
+      blocks_.emplace(it, offset, offset);
+    }
+  }
+
+  int cumulative() const { return cumulative_; }
+
+  std::vector<SackChunk::GapAckBlock> gap_ack_blocks() const {
+    std::vector<SackChunk::GapAckBlock> blocks;
+    blocks.reserve(blocks_.size());
+    for (const auto& [first, last] : blocks_) {
+      blocks.emplace_back(first - cumulative_, last - cumulative_);
+    }
+    return blocks;
+  }
+
+ private:
+  int cumulative_ = -1;
+  std::vector<std::pair<int, int>> blocks_;
+};
+
+// Sends a window of `chunks` chunks in flight, of which `loss_percent` are lost
+// at random, and processes the SACKs that the peer sends for every second
+// received chunk. Lost chunks are retransmitted after the window has been
+// acked, so until then every SACK carries a growing set of gap ack blocks.
+void BM_OutstandingDataHandleSack(benchmark::State& state) {
+  const int num_chunks = state.range(0);
+  const int loss_percent = state.range(1);
+
+  webrtc::Random random(42);
+  std::vector<bool> lost(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    lost[i] = static_cast<int>(random.Rand(99)) < loss_percent;
+  }
+  DataGenerator gen;
+  const Data data = gen.Ordered(std::vector<uint8_t>(1000), "BE");
+
+  size_t num_sacks = 0;
+  for (auto _ : state) {
+    UnwrappedTSN::Unwrapper unwrapper;
+    const UnwrappedTSN last_tsn = unwrapper.Unwrap(TSN(0));
+    OutstandingData outstanding_data(
+        DataChunk::kHeaderSize, last_tsn,
+        [](StreamID, OutgoingMessageId) { return false; });
+    for (int i = 0; i < num_chunks; ++i) {
+      outstanding_data.Insert(OutgoingMessageId(i), data, kNow);
+    }
+
+    Receiver receiver;
+    auto handle_sack = [&] {
+      outstanding_data.HandleSack(
+          UnwrappedTSN::AddTo(last_tsn, receiver.cumulative() + 1),
+          receiver.gap_ack_blocks(), /*is_in_fast_recovery=*/false);
+      ++num_sacks;
+    };
+    int received = 0;
+    for (int i = 0; i < num_chunks; ++i) {
+      if (lost[i]) {
+        continue;
+      }
+      receiver.Receive(i);
+      if (++received % 2 == 0) {
+        handle_sack();
+      }
+    }
+
+    // The window is full until then, so the lost chunks are retransmitted
+    // now. Those that weren't nacked enough times to be fast retransmitted are
+    // retransmitted when the retransmission timer expires.
+    while (!outstanding_data.empty()) {
+      if (!outstanding_data.has_data_to_be_retransmitted()) {
+        outstanding_data.NackAll();
+      }
+      std::vector<std::pair<TSN, Data>> chunks =
+          outstanding_data.GetChunksToBeFastRetransmitted(kMaxPacketSize);
+      while (outstanding_data.has_data_to_be_retransmitted()) {
+        std::vector<std::pair<TSN, Data>> more =
+            outstanding_data.GetChunksToBeRetransmitted(kMaxPacketSize);
+        chunks.insert(chunks.end(), std::make_move_iterator(more.begin()),
+                      std::make_move_iterator(more.end()));
+      }
+      for (const auto& [tsn, unused] : chunks) {
+        receiver.Receive(
+            UnwrappedTSN::Difference(unwrapper.Unwrap(tsn), last_tsn) - 1);
+      }
+      handle_sack();
+    }
+  }
+  state.counters["sacks_per_second"] =
+      benchmark::Counter(num_sacks, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_OutstandingDataHandleSack)
+    ->ArgNames({"chunks", "loss_percent"})
+    ->Args({10000, 0})
+    ->Args({10000, 5});
+
+}  // namespace
+}  // namespace dcsctp
@@ -145,6 +145,48 @@ TEST_F(OutstandingDataTest, AcksAndNacksWithGapAckBlocks) {
                           Pair(TSN(11), State::kAcked)));
 }
 
+TEST_F(OutstandingDataTest, AcksChunksInRepeatedGapAckBlocksOnce) {
+  for (int i = 0; i < 6; ++i) {
+    buf_.Insert(kMessageId, gen_.Ordered({1}, "BE"), kNow);
+  }
+  const size_t kChunkSize = DataChunk::kHeaderSize + RoundUpTo4(1);
+
+  std::vector<SackChunk::GapAckBlock> gab1 = {SackChunk::GapAckBlock(2, 3)};
+  OutstandingData::AckInfo ack1 =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab1, false);
+  EXPECT_EQ(ack1.bytes_acked, 2 * kChunkSize);
+  EXPECT_EQ(ack1.highest_tsn_acked.Wrap(), TSN(12));
+
+  // The same block, extended. Only the new chunks are acked.
+  std::vector<SackChunk::GapAckBlock> gab2 = {SackChunk::GapAckBlock(2, 5)};
+  OutstandingData::AckInfo ack2 =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab2, false);
+  EXPECT_EQ(ack2.bytes_acked, 2 * kChunkSize);
+  EXPECT_EQ(ack2.highest_tsn_acked.Wrap(), TSN(14));
+
+  // The peer drops TSN 12, which was acked before.
+  std::vector<SackChunk::GapAckBlock> gab3 = {SackChunk::GapAckBlock(2, 2),
+                                              SackChunk::GapAckBlock(4, 6)};
+  OutstandingData::AckInfo ack3 =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab3, false);
+  EXPECT_EQ(ack3.bytes_acked, kChunkSize);
+  EXPECT_THAT(buf_.GetChunkStatesForTesting(),
+              ElementsAre(Pair(TSN(9), State::kAcked),               //
+                          Pair(TSN(10), State::kToBeRetransmitted),  //
+                          Pair(TSN(11), State::kAcked),              //
+                          Pair(TSN(12), State::kNacked),             //
+                          Pair(TSN(13), State::kAcked),              //
+                          Pair(TSN(14), State::kAcked),              //
+                          Pair(TSN(15), State::kAcked)));
+
+  // And acks it again.
+  std::vector<SackChunk::GapAckBlock> gab4 = {SackChunk::GapAckBlock(2, 6)};
+  OutstandingData::AckInfo ack4 =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab4, false);
+  EXPECT_EQ(ack4.bytes_acked, kChunkSize);
+  EXPECT_EQ(ack4.highest_tsn_acked.Wrap(), TSN(12));
+}
+
 TEST_F(OutstandingDataTest, NacksThreeTimesWithSameTsnDoesntRetransmit) {
   buf_.Insert(kMessageId, gen_.Ordered({1}, "B"), kNow);
   buf_.Insert(kMessageId, gen_.Ordered({1}, "E"), kNow);
@@ -12,7 +12,6 @@
 #include <cstdint>
 #include <deque>
 #include <limits>
-#include <map>
 #include <optional>
 #include <set>
 #include <utility>
@@ -24,6 +23,7 @@
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/public/dcsctp_message.h"
 #include "net/dcsctp/public/dcsctp_socket.h"
+#include "net/dcsctp/public/payload_slice.h"
 #include "net/dcsctp/public/types.h"
 #include "net/dcsctp/tx/send_queue.h"
 #include "rtc_base/logging.h"
@@ -178,11 +178,8 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
     StreamID stream_id = message.stream_id();
     PPID ppid = message.ppid();
 
-    // Zero-copy the payload if the message fits in a single chunk.
-    std::vector<uint8_t> payload =
-        is_beginning && is_end
-            ? std::move(message).ReleasePayload()
-            : std::vector<uint8_t>(chunk_payload.begin(), chunk_payload.end());
+    // Zero-copy the payload: fragments share the buffer of the message.
+    PayloadSlice payload = message.payload_slice().subslice(chunk_payload);
 
     FSN fsn(item.current_fsn);
     item.current_fsn = FSN(*item.current_fsn + 1);
@@ -199,8 +196,8 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
         is_end ? item.attributes.lifecycle_id : LifecycleId::NotSet();
 
     if (is_end) {
-      // The entire message has been sent, and its last data copied to `chunk`,
-      // so it can safely be discarded.
+      // The entire message has been sent, and `chunk` holds a reference to its
+      // last data, so it can safely be discarded.
       items_.pop_front();
 
       if (pause_state_ == PauseState::kPending) {
@@ -483,12 +480,10 @@ RRSendQueue::OutgoingStream& RRSendQueue::GetOrCreateStreamInfo(
   }
 
   return streams_
-      .emplace(
-          std::piecewise_construct, std::forward_as_tuple(stream_id),
-          std::forward_as_tuple(this, &scheduler_, stream_id, default_priority_,
-                                [this, stream_id]() {
-                                  callbacks_.OnBufferedAmountLow(stream_id);
-                                }))
+      .try_emplace(stream_id, this, &scheduler_, stream_id, default_priority_,
+                   [this, stream_id]() {
+                     callbacks_.OnBufferedAmountLow(stream_id);
+                   })
       .first->second;
 }
 
@@ -529,12 +524,11 @@ void RRSendQueue::RestoreFromState(const DcSctpSocketHandoverState& state) {
   for (const DcSctpSocketHandoverState::OutgoingStream& state_stream :
        state.tx.streams) {
     StreamID stream_id(state_stream.id);
-    streams_.emplace(
-        std::piecewise_construct, std::forward_as_tuple(stream_id),
-        std::forward_as_tuple(
-            this, &scheduler_, stream_id, StreamPriority(state_stream.priority),
-            [this, stream_id]() { callbacks_.OnBufferedAmountLow(stream_id); },
-            &state_stream));
+    streams_.try_emplace(
+        stream_id, this, &scheduler_, stream_id,
+        StreamPriority(state_stream.priority),
+        [this, stream_id]() { callbacks_.OnBufferedAmountLow(stream_id); },
+        &state_stream);
   }
 }
 }  // namespace dcsctp
@@ -12,7 +12,6 @@
 
 #include <cstdint>
 #include <deque>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -23,6 +22,7 @@
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/common/stream_table.h"
 #include "net/dcsctp/public/dcsctp_message.h"
 #include "net/dcsctp/public/dcsctp_socket.h"
 #include "net/dcsctp/public/types.h"
@@ -263,10 +263,6 @@ class RRSendQueue : public SendQueue {
 
   bool IsConsistent() const;
   OutgoingStream& GetOrCreateStreamInfo(StreamID stream_id);
-  std::optional<DataToSend> Produce(
-      std::map<StreamID, OutgoingStream>::iterator it,
-      webrtc::Timestamp now,
-      size_t max_size);
 
   const absl::string_view log_prefix_;
   DcSctpSocketCallbacks& callbacks_;
@@ -278,7 +274,7 @@ class RRSendQueue : public SendQueue {
   ThresholdWatcher total_buffered_amount_;
 
   // All streams, and messages added to those.
-  std::map<StreamID, OutgoingStream> streams_;
+  StreamTable<OutgoingStream> streams_;
 };
 }  // namespace dcsctp
 
@@ -10,11 +10,15 @@
 
 #include "p2p/base/packet_transport_internal.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <utility>
 
 #include "absl/functional/any_invocable.h"
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
+#include "rtc_base/async_packet_socket.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/network/received_packet.h"
 #include "rtc_base/network_route.h"
@@ -31,6 +35,21 @@ bool PacketTransportInternal::GetOption(Socket::Option /* opt */,
   return false;
 }
 
+size_t PacketTransportInternal::SendPackets(
+    ArrayView<const ArrayView<const uint8_t>> packets,
+    const AsyncSocketPacketOptions& options,
+    int flags) {
+  size_t sent = 0;
+  for (ArrayView<const uint8_t> packet : packets) {
+    if (SendPacket(reinterpret_cast<const char*>(packet.data()), packet.size(),
+                   options, flags) < 0) {
+      break;
+    }
+    ++sent;
+  }
+  return sent;
+}
+
 std::optional<NetworkRoute> PacketTransportInternal::network_route() const {
   return std::optional<NetworkRoute>();
 }
@@ -12,10 +12,12 @@
 #define P2P_BASE_PACKET_TRANSPORT_INTERNAL_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 
 #include "absl/functional/any_invocable.h"
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/callback_list.h"
@@ -52,6 +54,15 @@ class RTC_EXPORT PacketTransportInternal : public sigslot::has_slots<> {
                          const AsyncSocketPacketOptions& options,
                          int flags = 0) = 0;
 
+  // Attempts to send the given packets, in order, stopping at the first one
+  // that fails to be sent. Returns the number of packets that were sent; if
+  // that's fewer than in `packets`, GetError() describes why the next one
+  // failed. Implementations may override this to amortize per-packet work over
+  // the whole batch. The default implementation calls SendPacket for each.
+  virtual size_t SendPackets(ArrayView<const ArrayView<const uint8_t>> packets,
+                             const AsyncSocketPacketOptions& options,
+                             int flags = 0);
+
   // Sets a socket option. Note that not all options are
   // supported by all transport types.
   virtual int SetOption(Socket::Option opt, int value) = 0;
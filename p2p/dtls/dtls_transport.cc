@@ -574,6 +574,30 @@ int DtlsTransportInternalImpl::SendPacket(
   }
 }
 
+size_t DtlsTransportInternalImpl::SendPackets(
+    ArrayView<const ArrayView<const uint8_t>> packets,
+    const AsyncSocketPacketOptions& options,
+    int flags) {
+  if (!dtls_active_) {
+    // Not doing DTLS.
+    return ice_transport_->SendPackets(packets, options);
+  }
+  if (dtls_state() != webrtc::DtlsTransportState::kConnected ||
+      (flags & webrtc::PF_SRTP_BYPASS)) {
+    return DtlsTransportInternal::SendPackets(packets, options, flags);
+  }
+  size_t sent = 0;
+  for (ArrayView<const uint8_t> packet : packets) {
+    size_t written;
+    int error;
+    if (dtls_->WriteAll(packet, written, error) != webrtc::SR_SUCCESS) {
+      break;
+    }
+    ++sent;
+  }
+  return sent;
+}
+
 webrtc::IceTransportInternal* DtlsTransportInternalImpl::ice_transport() {
   return ice_transport_;
 }
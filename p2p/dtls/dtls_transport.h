@@ -173,6 +173,11 @@ class DtlsTransportInternalImpl : public webrtc::DtlsTransportInternal {
                  size_t size,
                  const AsyncSocketPacketOptions& options,
                  int flags) override;
+  // Checks the DTLS state once for the whole batch. Every packet is still
+  // protected as a DTLS record of its own.
+  size_t SendPackets(ArrayView<const ArrayView<const uint8_t>> packets,
+                     const AsyncSocketPacketOptions& options,
+                     int flags) override;
 
   bool GetOption(webrtc::Socket::Option opt, int* value) override;
 
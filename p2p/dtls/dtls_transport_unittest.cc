@@ -260,6 +260,21 @@ class DtlsTestClient : public sigslot::has_slots<> {
     } while (sent < count);
   }
 
+  // Like SendPackets, but sends all the packets with a single call. Returns the
+  // number of packets that were sent.
+  size_t SendPacketBatch(size_t size, size_t count) {
+    std::vector<std::vector<uint8_t>> packets(count,
+                                              std::vector<uint8_t>(size));
+    std::vector<ArrayView<const uint8_t>> views;
+    for (size_t i = 0; i < count; ++i) {
+      memset(packets[i].data(), i & 0xff, size);
+      packets[i][0] = 0x00;
+      SetBE32(packets[i].data() + kPacketNumOffset, static_cast<uint32_t>(i));
+      views.push_back(packets[i]);
+    }
+    return dtls_transport_->SendPackets(views, AsyncSocketPacketOptions(), 0);
+  }
+
   int SendInvalidSrtpPacket(size_t size) {
     std::unique_ptr<char[]> packet(new char[size]);
     // Fill the packet with 0 to form an invalid SRTP packet.
@@ -601,6 +616,26 @@ TEST_F(DtlsTransportInternalImplTest, TestTransferDtls) {
   TestTransfer(1000, 100, /*srtp=*/false);
 }
 
+// Connect with DTLS, and transfer data over DTLS, sending the packets in a
+// batch.
+TEST_F(DtlsTransportInternalImplTest, TestTransferDtlsBatch) {
+  PrepareDtls(KT_DEFAULT);
+  ASSERT_TRUE(Connect());
+  client2_.ExpectPackets(1000);
+  EXPECT_EQ(client1_.SendPacketBatch(1000, 10), 10u);
+  EXPECT_THAT(
+      webrtc::WaitUntil(
+          [&] { return client2_.NumPacketsReceived(); }, Eq(10u),
+          {.timeout = TimeDelta::Millis(kTimeout), .clock = &fake_clock_}),
+      IsRtcOk());
+}
+
+TEST_F(DtlsTransportInternalImplTest, DoesNotSendBatchBeforeConnected) {
+  PrepareDtls(KT_DEFAULT);
+  Negotiate();
+  EXPECT_EQ(client1_.SendPacketBatch(1000, 10), 0u);
+}
+
 // Connect with DTLS, combine multiple DTLS records into one packet.
 // Our DTLS implementation doesn't do this, but other implementations may;
 // see https://tools.ietf.org/html/rfc6347#section-4.1.1.
@@ -104,6 +104,7 @@
 #include "pc/transport_stats.h"
 #include "pc/usage_pattern.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/crypto_random.h"
 #include "rtc_base/ip_address.h"
@@ -1326,6 +1327,19 @@ void PeerConnection::GetStats(
   RTC_DCHECK_BLOCK_COUNT_NO_MORE_THAN(2);
 }
 
+void PeerConnection::GetStats(
+    const std::vector<std::string>& stats_types,
+    scoped_refptr<RTCStatsCollectorCallback> callback) {
+  TRACE_EVENT0("webrtc", "PeerConnection::GetStats");
+  RTC_DCHECK_RUN_ON(signaling_thread());
+  RTC_DCHECK(callback);
+  RTC_DCHECK(stats_collector_);
+  RTC_LOG_THREAD_BLOCK_COUNT();
+  stats_collector_->GetStatsReport(
+      flat_set<std::string>(stats_types.begin(), stats_types.end()), callback);
+  RTC_DCHECK_BLOCK_COUNT_NO_MORE_THAN(2);
+}
+
 PeerConnectionInterface::SignalingState PeerConnection::signaling_state() {
   RTC_DCHECK_RUN_ON(signaling_thread());
   return sdp_handler_->signaling_state();
@@ -179,6 +179,8 @@ class PeerConnection : public PeerConnectionInternal,
                 scoped_refptr<RTCStatsCollectorCallback> callback) override;
   void GetStats(scoped_refptr<RtpReceiverInterface> selector,
                 scoped_refptr<RTCStatsCollectorCallback> callback) override;
+  void GetStats(const std::vector<std::string>& stats_types,
+                scoped_refptr<RTCStatsCollectorCallback> callback) override;
   void ClearStatsCache() override;
 
   SignalingState signaling_state() override;
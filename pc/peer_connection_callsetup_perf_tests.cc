@@ -25,6 +25,7 @@
 #include "api/field_trials_view.h"
 #include "api/jsep.h"
 #include "api/make_ref_counted.h"
+#include "api/media_types.h"
 #include "api/rtc_error.h"
 #include "api/scoped_refptr.h"
 #include "api/test/metrics/global_metrics_logger_and_exporter.h"
@@ -51,16 +52,9 @@ using ::webrtc::test::ImprovementDirection;
 using ::webrtc::test::Unit;
 namespace webrtc {
 
-// All tests in this file require SCTP support.
-#ifdef WEBRTC_HAVE_SCTP
-
-class PeerConnectionDataChannelOpenTest
-    : public ::testing::TestWithParam<
-          std::tuple</*field_trials=*/std::string,
-                     /*signal_candidates_from_client=*/bool,
-                     /*dtls_role=*/ConnectionRole>> {
+class PeerConnectionCallSetupTest : public ::testing::Test {
  public:
-  PeerConnectionDataChannelOpenTest()
+  PeerConnectionCallSetupTest()
       : background_thread_(std::make_unique<Thread>(&vss_)) {
     RTC_CHECK(background_thread_->Start());
     // Delay is set to 50ms so we get a 100ms RTT.
@@ -110,15 +104,6 @@ class PeerConnectionDataChannelOpenTest
     EXPECT_TRUE(Await({p1, p2}));
   }
 
-  bool WaitForDataChannelOpen(scoped_refptr<webrtc::DataChannelInterface> dc) {
-    return WaitUntil(
-               [&] {
-                 return dc->state() == DataChannelInterface::DataState::kOpen;
-               },
-               IsTrue(), {.timeout = webrtc::TimeDelta::Millis(5000)})
-        .ok();
-  }
-
  protected:
   std::unique_ptr<SessionDescriptionInterface> CreateOffer(
       scoped_refptr<PeerConnectionTestWrapper> pc_wrapper) {
@@ -176,6 +161,62 @@ class PeerConnectionDataChannelOpenTest
   std::unique_ptr<Thread> background_thread_;
 };
 
+// Measures how long it takes to renegotiate when a transceiver is added to a
+// session that already has the given number of transceivers, e.g. when a
+// participant joins a large conference. Only the added m= section changes.
+class PeerConnectionRenegotiationTest
+    : public PeerConnectionCallSetupTest,
+      public ::testing::WithParamInterface</*num_transceivers=*/int> {};
+
+TEST_P(PeerConnectionRenegotiationTest, AddTransceiver) {
+  const int num_transceivers = GetParam();
+  scoped_refptr<PeerConnectionTestWrapper> local_pc_wrapper = CreatePc();
+  scoped_refptr<PeerConnectionTestWrapper> remote_pc_wrapper = CreatePc();
+  SignalIceCandidates(local_pc_wrapper, remote_pc_wrapper);
+  SignalIceCandidates(remote_pc_wrapper, local_pc_wrapper);
+
+  for (int i = 0; i < num_transceivers; ++i) {
+    ASSERT_TRUE(local_pc_wrapper->pc()->AddTransceiver(MediaType::AUDIO).ok());
+  }
+  Negotiate(local_pc_wrapper, remote_pc_wrapper, CONNECTIONROLE_ACTIVE);
+
+  ASSERT_TRUE(local_pc_wrapper->pc()->AddTransceiver(MediaType::AUDIO).ok());
+  uint64_t start_time = TimeNanos();
+  Negotiate(local_pc_wrapper, remote_pc_wrapper, CONNECTIONROLE_ACTIVE);
+  uint64_t renegotiation_time = TimeNanos() - start_time;
+
+  double renegotiation_time_millis =
+      static_cast<double>(renegotiation_time) / kNumNanosecsPerMillisec;
+  GetGlobalMetricsLogger()->LogSingleValueMetric(
+      "RenegotiationTime", "transceivers=" + absl::StrCat(num_transceivers),
+      renegotiation_time_millis, Unit::kMilliseconds,
+      ImprovementDirection::kSmallerIsBetter);
+}
+
+INSTANTIATE_TEST_SUITE_P(PeerConnectionRenegotiationTest,
+                         PeerConnectionRenegotiationTest,
+                         Values(10, 50, 200));
+
+// All tests below require SCTP support.
+#ifdef WEBRTC_HAVE_SCTP
+
+class PeerConnectionDataChannelOpenTest
+    : public PeerConnectionCallSetupTest,
+      public ::testing::WithParamInterface<
+          std::tuple</*field_trials=*/std::string,
+                     /*signal_candidates_from_client=*/bool,
+                     /*dtls_role=*/ConnectionRole>> {
+ public:
+  bool WaitForDataChannelOpen(scoped_refptr<webrtc::DataChannelInterface> dc) {
+    return WaitUntil(
+               [&] {
+                 return dc->state() == DataChannelInterface::DataState::kOpen;
+               },
+               IsTrue(), {.timeout = webrtc::TimeDelta::Millis(5000)})
+        .ok();
+  }
+};
+
 TEST_P(PeerConnectionDataChannelOpenTest, OpenAtCaller) {
   std::string trials = std::get<0>(GetParam());
   bool skip_candidates_from_caller = std::get<1>(GetParam());
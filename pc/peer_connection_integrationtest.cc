@@ -106,6 +106,7 @@ using ::testing::AtLeast;
 using ::testing::Eq;
 using ::testing::Field;
 using ::testing::InSequence;
+using ::testing::IsEmpty;
 using ::testing::MockFunction;
 using ::testing::NiceMock;
 using ::testing::NotNull;
@@ -1558,6 +1559,35 @@ TEST_P(PeerConnectionIntegrationTest, NewGetStatsManyAudioAndManyVideoStreams) {
   EXPECT_THAT(inbound_track_ids, UnorderedElementsAreArray(track_ids));
 }
 
+// Test that asking for only some stats types returns those stats without the
+// stats of types that are not needed.
+TEST_P(PeerConnectionIntegrationTest, NewGetStatsOfRequestedTypes) {
+  ASSERT_TRUE(CreatePeerConnectionWrappers());
+  ConnectFakeSignaling();
+  caller()->AddAudioVideoTracks();
+  callee()->AddAudioVideoTracks();
+  caller()->CreateAndSetAndSignalOffer();
+  ASSERT_THAT(
+      WaitUntil([&] { return SignalingStateStable(); }, ::testing::IsTrue()),
+      IsRtcOk());
+  MediaExpectations media_expectations;
+  media_expectations.ExpectBidirectionalAudioAndVideo();
+  ASSERT_TRUE(ExpectNewFrames(media_expectations));
+
+  scoped_refptr<const RTCStatsReport> report =
+      caller()->NewGetStats({RTCOutboundRtpStreamStats::kType});
+  ASSERT_TRUE(report);
+  auto outbound_stream_stats =
+      report->GetStatsOfType<RTCOutboundRtpStreamStats>();
+  ASSERT_EQ(2u, outbound_stream_stats.size());
+  for (const auto& stat : outbound_stream_stats) {
+    ASSERT_TRUE(stat->bytes_sent.has_value());
+    EXPECT_LT(0u, *stat->bytes_sent);
+  }
+  EXPECT_THAT(report->GetStatsOfType<RTCInboundRtpStreamStats>(), IsEmpty());
+  EXPECT_THAT(report->GetStatsOfType<RTCIceCandidatePairStats>(), IsEmpty());
+}
+
 // Test that we can get stats (using the new stats implementation) for
 // unsignaled streams. Meaning when SSRCs/MSIDs aren't signaled explicitly in
 // SDP.
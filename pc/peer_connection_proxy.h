@@ -104,6 +104,10 @@ PROXY_METHOD2(void,
               GetStats,
               scoped_refptr<RtpReceiverInterface>,
               scoped_refptr<RTCStatsCollectorCallback>)
+PROXY_METHOD2(void,
+              GetStats,
+              const std::vector<std::string>&,
+              scoped_refptr<RTCStatsCollectorCallback>)
 PROXY_METHOD0(void, ClearStatsCache)
 PROXY_METHOD2(RTCErrorOr<scoped_refptr<DataChannelInterface>>,
               CreateDataChannelOrError,
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -23,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/algorithm/container.h"
 #include "absl/functional/bind_front.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -68,6 +70,7 @@
 #include "pc/transport_stats.h"
 #include "pc/webrtc_sdp.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/event.h"
 #include "rtc_base/ip_address.h"
 #include "rtc_base/logging.h"
@@ -1063,6 +1066,19 @@ void SetAudioProcessingStats(StatsType* stats,
   }
 }
 
+scoped_refptr<RTCStatsReport> CreateReportFilteredByTypes(
+    const RTCStatsReport& report,
+    const flat_set<std::string>& stats_types) {
+  scoped_refptr<RTCStatsReport> filtered_report =
+      RTCStatsReport::Create(report.timestamp());
+  for (const RTCStats& stats : report) {
+    if (stats_types.contains(absl::string_view(stats.type()))) {
+      filtered_report->AddStats(stats.copy());
+    }
+  }
+  return filtered_report;
+}
+
 }  // namespace
 
 scoped_refptr<RTCStatsReport> RTCStatsCollector::CreateReportFilteredBySelector(
@@ -1139,6 +1155,16 @@ RTCStatsCollector::RequestInfo::RequestInfo(
                   nullptr,
                   std::move(selector)) {}
 
+RTCStatsCollector::RequestInfo::RequestInfo(
+    flat_set<std::string> stats_types,
+    scoped_refptr<RTCStatsCollectorCallback> callback)
+    : RequestInfo(FilterMode::kTypeSelector,
+                  std::move(callback),
+                  nullptr,
+                  nullptr) {
+  stats_types_ = std::move(stats_types);
+}
+
 RTCStatsCollector::RequestInfo::RequestInfo(
     RTCStatsCollector::RequestInfo::FilterMode filter_mode,
     scoped_refptr<RTCStatsCollectorCallback> callback,
@@ -1203,6 +1229,12 @@ void RTCStatsCollector::GetStatsReport(
   GetStatsReportInternal(RequestInfo(std::move(selector), std::move(callback)));
 }
 
+void RTCStatsCollector::GetStatsReport(
+    const flat_set<std::string>& stats_types,
+    scoped_refptr<RTCStatsCollectorCallback> callback) {
+  GetStatsReportInternal(RequestInfo(stats_types, std::move(callback)));
+}
+
 void RTCStatsCollector::GetStatsReportInternal(
     RTCStatsCollector::RequestInfo request) {
   RTC_DCHECK_RUN_ON(signaling_thread_);
@@ -1223,38 +1255,85 @@ void RTCStatsCollector::GetStatsReportInternal(
     // Only start gathering stats if we're not already gathering stats. In the
     // case of already gathering stats, `callback_` will be invoked when there
     // are no more pending partial reports.
+    StartGathering();
+  }
+}
+
+void RTCStatsCollector::StartGathering() {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  RTC_DCHECK(!requests_.empty());
+  RTC_DCHECK_EQ(num_pending_partial_reports_, 0);
 
-    Timestamp timestamp =
-        stats_timestamp_with_environment_clock_
-            ?
-            // "Now" using a monotonically increasing timer.
-            env_.clock().CurrentTime()
-            :
-            // "Now" using a system clock, relative to the UNIX epoch (Jan 1,
-            // 1970, UTC), in microseconds. The system clock could be modified
-            // and is not necessarily monotonically increasing.
-            Timestamp::Micros(TimeUTCMicros());
-
-    num_pending_partial_reports_ = 2;
-    partial_report_timestamp_us_ = cache_now_us;
-
-    // Prepare `transceiver_stats_infos_` and `call_stats_` for use in
-    // `ProducePartialResultsOnNetworkThread` and
-    // `ProducePartialResultsOnSignalingThread`.
-    PrepareTransceiverStatsInfosAndCallStats_s_w_n();
-    // Don't touch `network_report_` on the signaling thread until
-    // ProducePartialResultsOnNetworkThread() has signaled the
-    // `network_report_event_`.
-    network_report_event_.Reset();
-    scoped_refptr<RTCStatsCollector> collector(this);
-    network_thread_->PostTask([collector,
-                               sctp_transport_name = pc_->sctp_transport_name(),
-                               timestamp]() mutable {
-      collector->ProducePartialResultsOnNetworkThread(
-          timestamp, std::move(sctp_transport_name));
-    });
-    ProducePartialResultsOnSignalingThread(timestamp);
+  // Only the stats types that are asked for are gathered, unless a request
+  // needs a full report.
+  gathered_stats_types_.emplace();
+  for (const RequestInfo& request : requests_) {
+    if (request.filter_mode() != RequestInfo::FilterMode::kTypeSelector) {
+      gathered_stats_types_ = std::nullopt;
+      break;
+    }
+    gathered_stats_types_->insert(request.stats_types().begin(),
+                                  request.stats_types().end());
+  }
+
+  Timestamp timestamp =
+      stats_timestamp_with_environment_clock_
+          ?
+          // "Now" using a monotonically increasing timer.
+          env_.clock().CurrentTime()
+          :
+          // "Now" using a system clock, relative to the UNIX epoch (Jan 1,
+          // 1970, UTC), in microseconds. The system clock could be modified
+          // and is not necessarily monotonically increasing.
+          Timestamp::Micros(TimeUTCMicros());
+
+  num_pending_partial_reports_ = 2;
+  // "Now" using a monotonically increasing timer.
+  partial_report_timestamp_us_ = TimeMicros();
+
+  // Prepare `transceiver_stats_infos_` and `call_stats_` for use in
+  // `ProducePartialResultsOnNetworkThread` and
+  // `ProducePartialResultsOnSignalingThread`.
+  PrepareTransceiverStatsInfosAndCallStats_s_w_n();
+  // Don't touch `network_report_` on the signaling thread until
+  // ProducePartialResultsOnNetworkThread() has signaled the
+  // `network_report_event_`.
+  network_report_event_.Reset();
+  scoped_refptr<RTCStatsCollector> collector(this);
+  network_thread_->PostTask([collector,
+                             sctp_transport_name = pc_->sctp_transport_name(),
+                             timestamp]() mutable {
+    collector->ProducePartialResultsOnNetworkThread(
+        timestamp, std::move(sctp_transport_name));
+  });
+  ProducePartialResultsOnSignalingThread(timestamp);
+}
+
+bool RTCStatsCollector::IsCoveredByGathering(
+    const RequestInfo& request) const {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  if (!gathered_stats_types_) {
+    return true;
   }
+  return request.filter_mode() == RequestInfo::FilterMode::kTypeSelector &&
+         absl::c_all_of(request.stats_types(), [&](const std::string& type) {
+           return gathered_stats_types_->contains(type);
+         });
+}
+
+bool RTCStatsCollector::ShouldProduce(
+    std::initializer_list<absl::string_view> types) const {
+  return !gathered_stats_types_ ||
+         absl::c_any_of(types, [&](absl::string_view type) {
+           return gathered_stats_types_->contains(type);
+         });
+}
+
+bool RTCStatsCollector::ShouldProduceRtpStreamStats() const {
+  return ShouldProduce(
+      {RTCInboundRtpStreamStats::kType, RTCOutboundRtpStreamStats::kType,
+       RTCRemoteInboundRtpStreamStats::kType,
+       RTCRemoteOutboundRtpStreamStats::kType, RTCCodecStats::kType});
 }
 
 void RTCStatsCollector::ClearCachedStatsReport() {
@@ -1294,9 +1373,15 @@ void RTCStatsCollector::ProducePartialResultsOnSignalingThreadImpl(
   RTC_DCHECK_RUN_ON(signaling_thread_);
   Thread::ScopedDisallowBlockingCalls no_blocking_calls;
 
-  ProduceMediaSourceStats_s(timestamp, partial_report);
-  ProducePeerConnectionStats_s(timestamp, partial_report);
-  ProduceAudioPlayoutStats_s(timestamp, partial_report);
+  if (ShouldProduce({RTCAudioSourceStats::kType})) {
+    ProduceMediaSourceStats_s(timestamp, partial_report);
+  }
+  if (ShouldProduce({RTCPeerConnectionStats::kType})) {
+    ProducePeerConnectionStats_s(timestamp, partial_report);
+  }
+  if (ShouldProduce({RTCAudioPlayoutStats::kType})) {
+    ProduceAudioPlayoutStats_s(timestamp, partial_report);
+  }
 }
 
 void RTCStatsCollector::ProducePartialResultsOnNetworkThread(
@@ -1311,7 +1396,9 @@ void RTCStatsCollector::ProducePartialResultsOnNetworkThread(
   // `network_report_event_` is reset before this method is invoked.
   network_report_ = RTCStatsReport::Create(timestamp);
 
-  ProduceDataChannelStats_n(timestamp, network_report_.get());
+  if (ShouldProduce({RTCDataChannelStats::kType})) {
+    ProduceDataChannelStats_n(timestamp, network_report_.get());
+  }
 
   std::set<std::string> transport_names;
   if (sctp_transport_name) {
@@ -1323,10 +1410,18 @@ void RTCStatsCollector::ProducePartialResultsOnNetworkThread(
       transport_names.insert(*info.transport_name);
   }
 
-  std::map<std::string, TransportStats> transport_stats_by_name =
-      pc_->GetTransportStatsByNames(transport_names);
-  std::map<std::string, CertificateStatsPair> transport_cert_stats =
-      PrepareTransportCertificateStats_n(transport_stats_by_name);
+  std::map<std::string, TransportStats> transport_stats_by_name;
+  std::map<std::string, CertificateStatsPair> transport_cert_stats;
+  if (ShouldProduceRtpStreamStats() ||
+      ShouldProduce({RTCCertificateStats::kType,
+                     RTCIceCandidatePairStats::kType,
+                     RTCLocalIceCandidateStats::kType,
+                     RTCRemoteIceCandidateStats::kType,
+                     RTCTransportStats::kType})) {
+    transport_stats_by_name = pc_->GetTransportStatsByNames(transport_names);
+    transport_cert_stats =
+        PrepareTransportCertificateStats_n(transport_stats_by_name);
+  }
 
   ProducePartialResultsOnNetworkThreadImpl(timestamp, transport_stats_by_name,
                                            transport_cert_stats,
@@ -1348,12 +1443,25 @@ void RTCStatsCollector::ProducePartialResultsOnNetworkThreadImpl(
   RTC_DCHECK_RUN_ON(network_thread_);
   Thread::ScopedDisallowBlockingCalls no_blocking_calls;
 
-  ProduceCertificateStats_n(timestamp, transport_cert_stats, partial_report);
-  ProduceIceCandidateAndPairStats_n(timestamp, transport_stats_by_name,
-                                    call_stats_, partial_report);
-  ProduceTransportStats_n(timestamp, transport_stats_by_name,
-                          transport_cert_stats, partial_report);
-  ProduceRTPStreamStats_n(timestamp, transceiver_stats_infos_, partial_report);
+  const bool produce_rtp_streams = ShouldProduceRtpStreamStats();
+  if (ShouldProduce({RTCCertificateStats::kType})) {
+    ProduceCertificateStats_n(timestamp, transport_cert_stats, partial_report);
+  }
+  if (ShouldProduce({RTCIceCandidatePairStats::kType,
+                     RTCLocalIceCandidateStats::kType,
+                     RTCRemoteIceCandidateStats::kType})) {
+    ProduceIceCandidateAndPairStats_n(timestamp, transport_stats_by_name,
+                                      call_stats_, partial_report);
+  }
+  // The RTP stream stats look up the transport stats in the report.
+  if (produce_rtp_streams || ShouldProduce({RTCTransportStats::kType})) {
+    ProduceTransportStats_n(timestamp, transport_stats_by_name,
+                            transport_cert_stats, partial_report);
+  }
+  if (produce_rtp_streams) {
+    ProduceRTPStreamStats_n(timestamp, transceiver_stats_infos_,
+                            partial_report);
+  }
 }
 
 void RTCStatsCollector::MergeNetworkReport_s() {
@@ -1381,20 +1489,39 @@ void RTCStatsCollector::MergeNetworkReport_s() {
   // asynchronously, so `num_pending_partial_reports_` must now be 0 and we are
   // ready to deliver the result.
   RTC_DCHECK_EQ(num_pending_partial_reports_, 0);
-  cache_timestamp_us_ = partial_report_timestamp_us_;
-  cached_report_ = partial_report_;
+  scoped_refptr<const RTCStatsReport> report = partial_report_;
   partial_report_ = nullptr;
   transceiver_stats_infos_.clear();
-  // Trace WebRTC Stats when getStats is called on Javascript.
-  // This allows access to WebRTC stats from trace logs. To enable them,
-  // select the "webrtc_stats" category when recording traces.
-  TRACE_EVENT_INSTANT1("webrtc_stats", "webrtc_stats", TRACE_EVENT_SCOPE_GLOBAL,
-                       "report", cached_report_->ToJson());
-
-  // Deliver report and clear `requests_`.
+  // Only full reports are cached.
+  if (!gathered_stats_types_) {
+    cache_timestamp_us_ = partial_report_timestamp_us_;
+    cached_report_ = report;
+    // Trace WebRTC Stats when getStats is called on Javascript.
+    // This allows access to WebRTC stats from trace logs. To enable them,
+    // select the "webrtc_stats" category when recording traces.
+    TRACE_EVENT_INSTANT1("webrtc_stats", "webrtc_stats",
+                         TRACE_EVENT_SCOPE_GLOBAL, "report", report->ToJson());
+  }
+
+  // Deliver the report to the requests it covers and remove them from
+  // `requests_`. Requests for stats types that were not gathered were made
+  // while gathering and are handled by gathering again.
   std::vector<RequestInfo> requests;
-  requests.swap(requests_);
-  DeliverCachedReport(cached_report_, std::move(requests));
+  std::vector<RequestInfo> remaining_requests;
+  for (RequestInfo& request : requests_) {
+    if (IsCoveredByGathering(request)) {
+      requests.push_back(std::move(request));
+    } else {
+      remaining_requests.push_back(std::move(request));
+    }
+  }
+  requests_ = std::move(remaining_requests);
+  gathered_stats_types_ = std::nullopt;
+  DeliverCachedReport(report, std::move(requests));
+  // A callback may have started gathering again.
+  if (!requests_.empty() && !num_pending_partial_reports_) {
+    StartGathering();
+  }
 }
 
 void RTCStatsCollector::DeliverCachedReport(
@@ -1407,6 +1534,10 @@ void RTCStatsCollector::DeliverCachedReport(
   for (const RequestInfo& request : requests) {
     if (request.filter_mode() == RequestInfo::FilterMode::kAll) {
       request.callback()->OnStatsDelivered(cached_report);
+    } else if (request.filter_mode() ==
+               RequestInfo::FilterMode::kTypeSelector) {
+      request.callback()->OnStatsDelivered(
+          CreateReportFilteredByTypes(*cached_report, request.stats_types()));
     } else {
       bool filter_by_sender_selector;
       scoped_refptr<RtpSenderInternal> sender_selector;
@@ -2087,6 +2218,9 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
       video_receive_stats;
 
   auto transceivers = pc_->GetTransceiversInternal();
+  // The media channels are only queried if their stats are used.
+  const bool get_media_stats = ShouldProduceRtpStreamStats() ||
+                               ShouldProduce({RTCAudioSourceStats::kType});
 
   // TODO(tommi): See if we can avoid synchronously blocking the signaling
   // thread while we do this (or avoid the BlockingCall at all).
@@ -2112,6 +2246,9 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
 
       stats.mid = channel->mid();
       stats.transport_name = std::string(channel->transport_name());
+      if (!get_media_stats) {
+        continue;
+      }
 
       if (media_type == webrtc::MediaType::AUDIO) {
         auto voice_send_channel = channel->voice_media_send_channel();
@@ -2179,7 +2316,7 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
       std::optional<VoiceMediaInfo> voice_media_info;
       std::optional<VideoMediaInfo> video_media_info;
       auto channel = transceiver->channel();
-      if (channel) {
+      if (channel && get_media_stats) {
         webrtc::MediaType media_type = transceiver->media_type();
         if (media_type == webrtc::MediaType::AUDIO) {
           auto voice_send_channel = channel->voice_media_send_channel();
@@ -14,12 +14,14 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/strings/string_view.h"
 #include "api/audio/audio_device.h"
 #include "api/data_channel_interface.h"
 #include "api/environment/environment.h"
@@ -78,6 +80,14 @@ class RTCStatsCollector : public RefCountInterface {
   // as: no RTP streams are received by selector). The result is empty.
   void GetStatsReport(scoped_refptr<RtpReceiverInternal> selector,
                       scoped_refptr<RTCStatsCollectorCallback> callback);
+  // Gets a report with only the stats of the given `stats_types`, as returned
+  // by RTCStats::type() (e.g. "outbound-rtp" or "candidate-pair"). If there is
+  // no fresh report cached, only the stats needed for these types are gathered,
+  // e.g. the media channels are only queried for RTP stream and media source
+  // stats. Such a report is not cached. The returned stats may reference stats
+  // of other types that are not part of the report.
+  void GetStatsReport(const flat_set<std::string>& stats_types,
+                      scoped_refptr<RTCStatsCollectorCallback> callback);
   // Clears the cache's reference to the most recent stats report. Subsequently
   // calling `GetStatsReport` guarantees fresh stats. This method must be called
   // any time the PeerConnection visibly changes as a result of an API call as
@@ -120,7 +130,12 @@ class RTCStatsCollector : public RefCountInterface {
  private:
   class RequestInfo {
    public:
-    enum class FilterMode { kAll, kSenderSelector, kReceiverSelector };
+    enum class FilterMode {
+      kAll,
+      kSenderSelector,
+      kReceiverSelector,
+      kTypeSelector
+    };
 
     // Constructs with FilterMode::kAll.
     explicit RequestInfo(scoped_refptr<RTCStatsCollectorCallback> callback);
@@ -132,6 +147,9 @@ class RTCStatsCollector : public RefCountInterface {
     // applied even if `selector` is null, resulting in an empty report.
     RequestInfo(scoped_refptr<RtpReceiverInternal> selector,
                 scoped_refptr<RTCStatsCollectorCallback> callback);
+    // Constructs with FilterMode::kTypeSelector.
+    RequestInfo(flat_set<std::string> stats_types,
+                scoped_refptr<RTCStatsCollectorCallback> callback);
 
     FilterMode filter_mode() const { return filter_mode_; }
     scoped_refptr<RTCStatsCollectorCallback> callback() const {
@@ -145,6 +163,10 @@ class RTCStatsCollector : public RefCountInterface {
       RTC_DCHECK(filter_mode_ == FilterMode::kReceiverSelector);
       return receiver_selector_;
     }
+    const flat_set<std::string>& stats_types() const {
+      RTC_DCHECK(filter_mode_ == FilterMode::kTypeSelector);
+      return stats_types_;
+    }
 
    private:
     RequestInfo(FilterMode filter_mode,
@@ -156,9 +178,18 @@ class RTCStatsCollector : public RefCountInterface {
     scoped_refptr<RTCStatsCollectorCallback> callback_;
     scoped_refptr<RtpSenderInternal> sender_selector_;
     scoped_refptr<RtpReceiverInternal> receiver_selector_;
+    flat_set<std::string> stats_types_;
   };
 
   void GetStatsReportInternal(RequestInfo request);
+  // Starts gathering the stats needed by `requests_`.
+  void StartGathering();
+  // Whether the stats being gathered are enough to complete `request`.
+  bool IsCoveredByGathering(const RequestInfo& request) const;
+  // Whether stats of any of `types` are produced by the stats being gathered.
+  bool ShouldProduce(std::initializer_list<absl::string_view> types) const;
+  // Whether RTP stream stats, and the codec stats they reference, are produced.
+  bool ShouldProduceRtpStreamStats() const;
 
   // Structure for tracking stats about each RtpTransceiver managed by the
   // PeerConnection. This can either by a Plan B style or Unified Plan style
@@ -261,6 +292,11 @@ class RTCStatsCollector : public RefCountInterface {
   // all partial reports are merged this is the result of a request.
   scoped_refptr<RTCStatsReport> partial_report_;
   std::vector<RequestInfo> requests_;
+  // The stats types that are produced by the stats gathering in progress, or
+  // null if all of them are. Set on the signaling thread before gathering
+  // starts, and read on the signaling and network threads while gathering,
+  // like `transceiver_stats_infos_`.
+  std::optional<flat_set<std::string>> gathered_stats_types_;
   // Holds the result of ProducePartialResultsOnNetworkThread(). It is merged
   // into `partial_report_` on the signaling thread and then nulled by
   // MergeNetworkReport_s(). Thread-safety is ensured by using
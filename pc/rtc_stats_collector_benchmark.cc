@@ -0,0 +1,183 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "api/media_types.h"
+#include "api/rtp_parameters.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats_collector_callback.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/stats/rtcstats_objects.h"
+#include "benchmark/benchmark.h"
+#include "media/base/media_channel.h"
+#include "p2p/base/p2p_constants.h"
+#include "pc/rtc_stats_collector.h"
+#include "pc/test/fake_peer_connection_for_stats.h"
+#include "pc/transport_stats.h"
+#include "rtc_base/containers/flat_set.h"
+#include "rtc_base/thread.h"
+
+namespace {
+
+// Heap allocations made by the benchmark binary, counted by the replacement
+// global allocation functions below.
+std::atomic<int64_t> g_num_allocations{0};
+std::atomic<int64_t> g_allocated_bytes{0};
+
+}  // namespace
+
+void* operator new(size_t size) {
+  g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  void* ptr = std::malloc(size > 0 ? size : 1);
+  if (!ptr) {
+    std::abort();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /* size */) noexcept {
+  std::free(ptr);
+}
+
+namespace webrtc {
+namespace {
+
+constexpr char kTransportName[] = "transport";
+constexpr int kPayloadType = 111;
+
+class StatsCallback : public RTCStatsCollectorCallback {
+ public:
+  void OnStatsDelivered(
+      const scoped_refptr<const RTCStatsReport>& report) override {
+    report_ = report;
+  }
+
+  // Processes messages on the current thread, where all the threads of the
+  // fake peer connection run, until the report is delivered.
+  scoped_refptr<const RTCStatsReport> WaitForReport() {
+    while (!report_) {
+      Thread::Current()->ProcessMessages(0);
+    }
+    return std::move(report_);
+  }
+
+ private:
+  scoped_refptr<const RTCStatsReport> report_;
+};
+
+// Creates a peer connection with `num_tracks` audio transceivers on a single
+// transport, that each send and receive a stream.
+scoped_refptr<FakePeerConnectionForStats> CreatePeerConnection(int num_tracks) {
+  auto pc = make_ref_counted<FakePeerConnectionForStats>();
+  RtpCodecParameters codec;
+  codec.payload_type = kPayloadType;
+  codec.kind = MediaType::AUDIO;
+  codec.name = "opus";
+  codec.clock_rate = 48000;
+  for (int i = 0; i < num_tracks; ++i) {
+    VoiceMediaInfo voice_media_info;
+    voice_media_info.senders.emplace_back();
+    voice_media_info.senders[0].local_stats.emplace_back();
+    voice_media_info.senders[0].local_stats[0].ssrc = 2 * i + 1;
+    voice_media_info.senders[0].codec_payload_type = kPayloadType;
+    voice_media_info.receivers.emplace_back();
+    voice_media_info.receivers[0].local_stats.emplace_back();
+    voice_media_info.receivers[0].local_stats[0].ssrc = 2 * i + 2;
+    voice_media_info.receivers[0].codec_payload_type = kPayloadType;
+    voice_media_info.send_codecs.emplace(kPayloadType, codec);
+    voice_media_info.receive_codecs.emplace(kPayloadType, codec);
+    pc->AddVoiceChannel(absl::StrCat(i), kTransportName, voice_media_info);
+  }
+  TransportChannelStats channel_stats;
+  channel_stats.component = ICE_CANDIDATE_COMPONENT_RTP;
+  pc->SetTransportStats(kTransportName, channel_stats);
+  return pc;
+}
+
+// Gathers a new report of all stats, or of the stats of `stats_types` if not
+// empty, for a peer connection with as many tracks as the benchmark argument.
+// The time per iteration is the latency from asking for the report until it is
+// delivered; the counters report the heap allocations made per report.
+void GatherStats(benchmark::State& state,
+                 const flat_set<std::string>& stats_types) {
+  AutoThread main_thread;
+  scoped_refptr<FakePeerConnectionForStats> pc =
+      CreatePeerConnection(state.range(0));
+  scoped_refptr<RTCStatsCollector> collector =
+      RTCStatsCollector::Create(pc.get(), CreateEnvironment());
+  auto callback = make_ref_counted<StatsCallback>();
+
+  size_t num_stats = 0;
+  int64_t num_allocations = g_num_allocations.load();
+  int64_t allocated_bytes = g_allocated_bytes.load();
+  for (auto _ : state) {
+    collector->ClearCachedStatsReport();
+    if (stats_types.empty()) {
+      collector->GetStatsReport(callback);
+    } else {
+      collector->GetStatsReport(stats_types, callback);
+    }
+    num_stats = callback->WaitForReport()->size();
+  }
+  num_allocations = g_num_allocations.load() - num_allocations;
+  allocated_bytes = g_allocated_bytes.load() - allocated_bytes;
+  state.counters["stats_objects"] = num_stats;
+  state.counters["allocs_per_report"] = benchmark::Counter(
+      num_allocations, benchmark::Counter::kAvgIterations);
+  state.counters["bytes_per_report"] = benchmark::Counter(
+      allocated_bytes, benchmark::Counter::kAvgIterations);
+}
+
+void BM_RTCStatsCollectorGetStats(benchmark::State& state) {
+  GatherStats(state, {});
+}
+
+void BM_RTCStatsCollectorGetTransportStats(benchmark::State& state) {
+  GatherStats(state, {RTCTransportStats::kType});
+}
+
+void BM_RTCStatsCollectorGetOutboundRtpStats(benchmark::State& state) {
+  GatherStats(state, {RTCOutboundRtpStreamStats::kType});
+}
+
+BENCHMARK(BM_RTCStatsCollectorGetStats)
+    ->ArgName("tracks")
+    ->Arg(8)
+    ->Arg(64)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RTCStatsCollectorGetTransportStats)
+    ->ArgName("tracks")
+    ->Arg(8)
+    ->Arg(64)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RTCStatsCollectorGetOutboundRtpStats)
+    ->ArgName("tracks")
+    ->Arg(8)
+    ->Arg(64)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace webrtc
@@ -80,6 +80,7 @@
 #include "pc/test/rtc_stats_obtainer.h"
 #include "pc/transport_stats.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/fake_clock.h"
 #include "rtc_base/fake_ssl_identity.h"
 #include "rtc_base/network_constants.h"
@@ -421,6 +422,13 @@ class RTCStatsCollectorWrapper {
     return WaitForReport(callback);
   }
 
+  scoped_refptr<const RTCStatsReport> GetStatsReportOfTypes(
+      const flat_set<std::string>& stats_types) {
+    scoped_refptr<RTCStatsObtainer> callback = RTCStatsObtainer::Create();
+    stats_collector_->GetStatsReport(stats_types, callback);
+    return WaitForReport(callback);
+  }
+
   scoped_refptr<const RTCStatsReport> GetFreshStatsReport() {
     stats_collector_->ClearCachedStatsReport();
     return GetStatsReport();
@@ -3664,6 +3672,80 @@ TEST_F(RTCStatsCollectorTest, GetStatsWithNullReceiverSelector) {
   EXPECT_EQ(empty_report->size(), 0u);
 }
 
+TEST_F(RTCStatsCollectorTest, GetStatsWithTypeSelectorFiltersCachedReport) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  scoped_refptr<const RTCStatsReport> report = stats_->GetStatsReportOfTypes(
+      {RTCOutboundRtpStreamStats::kType, RTCTransportStats::kType});
+  EXPECT_EQ(report->timestamp(), graph.full_report->timestamp());
+  EXPECT_EQ(report->size(), 2u);
+  EXPECT_TRUE(report->Get(graph.outbound_rtp_id));
+  EXPECT_TRUE(report->Get(graph.transport_id));
+}
+
+TEST_F(RTCStatsCollectorTest, GetStatsWithTypeSelectorGathersSelectedTypes) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  stats_->stats_collector()->ClearCachedStatsReport();
+
+  scoped_refptr<const RTCStatsReport> report =
+      stats_->GetStatsReportOfTypes({RTCOutboundRtpStreamStats::kType});
+  EXPECT_EQ(report->size(), 1u);
+  ASSERT_TRUE(report->Get(graph.outbound_rtp_id));
+  // The stats are the same as in a full report, although the stats that they
+  // reference are not part of the report.
+  EXPECT_EQ(
+      report->Get(graph.outbound_rtp_id)->cast_to<RTCOutboundRtpStreamStats>(),
+      graph.full_report->Get(graph.outbound_rtp_id)
+          ->cast_to<RTCOutboundRtpStreamStats>());
+
+  report = stats_->GetStatsReportOfTypes({RTCPeerConnectionStats::kType});
+  EXPECT_EQ(report->size(), 1u);
+  EXPECT_TRUE(report->Get(graph.peer_connection_id));
+}
+
+TEST_F(RTCStatsCollectorTest, GetStatsWithTypeSelectorIsNotCached) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  stats_->stats_collector()->ClearCachedStatsReport();
+
+  scoped_refptr<const RTCStatsReport> typed_report =
+      stats_->GetStatsReportOfTypes({RTCPeerConnectionStats::kType});
+  EXPECT_EQ(typed_report->size(), 1u);
+  scoped_refptr<const RTCStatsReport> full_report = stats_->GetStatsReport();
+  EXPECT_EQ(full_report->size(), graph.full_report->size());
+  // Now that a full report is cached, it is used for selected types too.
+  typed_report = stats_->GetStatsReportOfTypes({RTCTransportStats::kType});
+  EXPECT_EQ(typed_report->timestamp(), full_report->timestamp());
+  EXPECT_EQ(typed_report->size(), 1u);
+  EXPECT_TRUE(typed_report->Get(graph.transport_id));
+}
+
+TEST_F(RTCStatsCollectorTest, GetStatsWithTypeSelectorWhileGathering) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  stats_->stats_collector()->ClearCachedStatsReport();
+
+  // The first request only gathers the peer connection stats. The others need
+  // stats that are not being gathered and are completed by gathering again.
+  scoped_refptr<const RTCStatsReport> a, b, c;
+  stats_->stats_collector()->GetStatsReport(
+      flat_set<std::string>{RTCPeerConnectionStats::kType},
+      RTCStatsObtainer::Create(&a));
+  stats_->stats_collector()->GetStatsReport(RTCStatsObtainer::Create(&b));
+  stats_->stats_collector()->GetStatsReport(
+      flat_set<std::string>{RTCTransportStats::kType},
+      RTCStatsObtainer::Create(&c));
+  for (scoped_refptr<const RTCStatsReport>* report : {&a, &b, &c}) {
+    EXPECT_THAT(
+        WaitUntil(
+            [&] { return *report != nullptr; }, ::testing::IsTrue(),
+            {.timeout = webrtc::TimeDelta::Millis(kGetStatsReportTimeoutMs)}),
+        IsRtcOk());
+  }
+  EXPECT_EQ(a->size(), 1u);
+  EXPECT_TRUE(a->Get(graph.peer_connection_id));
+  EXPECT_EQ(b->size(), graph.full_report->size());
+  EXPECT_EQ(c->size(), 1u);
+  EXPECT_TRUE(c->Get(graph.transport_id));
+}
+
 // Before SetLocalDescription() senders don't have an SSRC.
 // To simulate this case we create a mock sender with SSRC=0.
 TEST_F(RTCStatsCollectorTest, RtpIsMissingWhileSsrcIsZero) {
@@ -879,18 +879,33 @@ bool CanAddLocalMediaStream(StreamCollectionInterface* current_streams,
   return true;
 }
 
-scoped_refptr<DtlsTransport> LookupDtlsTransportByMid(
+// Looks up the DTLS transports for the MIDs of all `transceivers`, with a
+// single BlockingCall instead of one per transceiver. The result is indexed
+// like `transceivers`, and is null for transceivers that don't have a MID.
+// TODO(tommi): Can we post this (and associated operations where this
+// function is called) to the network thread and avoid this BlockingCall?
+// We might be able to simplify a few things if we set the transport on
+// the network thread and then update the implementation to check that
+// the set_ and relevant get methods are always called on the network
+// thread (we'll need to update proxy maps).
+std::vector<scoped_refptr<DtlsTransport>> LookupDtlsTransportsByMid(
     Thread* network_thread,
     JsepTransportController* controller,
-    const std::string& mid) {
-  // TODO(tommi): Can we post this (and associated operations where this
-  // function is called) to the network thread and avoid this BlockingCall?
-  // We might be able to simplify a few things if we set the transport on
-  // the network thread and then update the implementation to check that
-  // the set_ and relevant get methods are always called on the network
-  // thread (we'll need to update proxy maps).
-  return network_thread->BlockingCall(
-      [controller, &mid] { return controller->LookupDtlsTransportByMid(mid); });
+    const std::vector<RtpTransceiverProxyRefPtr>& transceivers) {
+  std::vector<std::optional<std::string>> mids;
+  mids.reserve(transceivers.size());
+  for (const auto& transceiver : transceivers) {
+    mids.push_back(transceiver->internal()->mid());
+  }
+  return network_thread->BlockingCall([controller, &mids] {
+    std::vector<scoped_refptr<DtlsTransport>> dtls_transports;
+    dtls_transports.reserve(mids.size());
+    for (const std::optional<std::string>& mid : mids) {
+      dtls_transports.push_back(
+          mid ? controller->LookupDtlsTransportByMid(*mid) : nullptr);
+    }
+    return dtls_transports;
+  });
 }
 
 bool ContentHasHeaderExtension(const ContentInfo& content_info,
@@ -1810,7 +1825,14 @@ RTCError SdpOfferAnswerHandler::ApplyLocalDescription(
     if (ConfiguredForMedia()) {
       std::vector<scoped_refptr<RtpTransceiverInterface>> remove_list;
       std::vector<scoped_refptr<MediaStreamInterface>> removed_streams;
-      for (const auto& transceiver_ext : transceivers()->List()) {
+      const std::vector<RtpTransceiverProxyRefPtr> transceiver_list =
+          transceivers()->List();
+      const std::vector<scoped_refptr<DtlsTransport>> dtls_transports =
+          LookupDtlsTransportsByMid(context_->network_thread(),
+                                    transport_controller_s(),
+                                    transceiver_list);
+      for (size_t i = 0; i < transceiver_list.size(); ++i) {
+        const auto& transceiver_ext = transceiver_list[i];
         auto transceiver = transceiver_ext->internal();
         if (transceiver->stopped()) {
           continue;
@@ -1820,11 +1842,8 @@ RTCError SdpOfferAnswerHandler::ApplyLocalDescription(
         // Note that code paths that don't set MID won't be able to use
         // information about DTLS transports.
         if (transceiver->mid()) {
-          auto dtls_transport = LookupDtlsTransportByMid(
-              context_->network_thread(), transport_controller_s(),
-              *transceiver->mid());
-          transceiver->sender_internal()->set_transport(dtls_transport);
-          transceiver->receiver_internal()->set_transport(dtls_transport);
+          transceiver->sender_internal()->set_transport(dtls_transports[i]);
+          transceiver->receiver_internal()->set_transport(dtls_transports[i]);
         }
 
         const ContentInfo* content =
@@ -2208,7 +2227,15 @@ void SdpOfferAnswerHandler::ApplyRemoteDescriptionUpdateTransceiverState(
   std::vector<scoped_refptr<RtpTransceiverInterface>> remove_list;
   std::vector<scoped_refptr<MediaStreamInterface>> added_streams;
   std::vector<scoped_refptr<MediaStreamInterface>> removed_streams;
-  for (const auto& transceiver_ext : transceivers()->List()) {
+  const std::vector<RtpTransceiverProxyRefPtr> transceiver_list =
+      transceivers()->List();
+  std::vector<scoped_refptr<DtlsTransport>> dtls_transports;
+  if (sdp_type == SdpType::kPrAnswer || sdp_type == SdpType::kAnswer) {
+    dtls_transports = LookupDtlsTransportsByMid(
+        context_->network_thread(), transport_controller_s(), transceiver_list);
+  }
+  for (size_t i = 0; i < transceiver_list.size(); ++i) {
+    const auto& transceiver_ext = transceiver_list[i];
     const auto transceiver = transceiver_ext->internal();
     const ContentInfo* content =
         FindMediaSectionForTransceiver(transceiver, remote_description());
@@ -2281,11 +2308,8 @@ void SdpOfferAnswerHandler::ApplyRemoteDescriptionUpdateTransceiverState(
       transceiver->set_current_direction(local_direction);
       // 2.2.8.1.11.[3-6]: Set the transport internal slots.
       if (transceiver->mid()) {
-        auto dtls_transport = LookupDtlsTransportByMid(
-            context_->network_thread(), transport_controller_s(),
-            *transceiver->mid());
-        transceiver->sender_internal()->set_transport(dtls_transport);
-        transceiver->receiver_internal()->set_transport(dtls_transport);
+        transceiver->sender_internal()->set_transport(dtls_transports[i]);
+        transceiver->receiver_internal()->set_transport(dtls_transports[i]);
       }
     }
     // 2.2.8.1.12: If the media description is rejected, and transceiver is
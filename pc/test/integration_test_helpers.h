@@ -520,6 +520,17 @@ class PeerConnectionIntegrationWrapper : public PeerConnectionObserver,
     return callback->report();
   }
 
+  // Same as above, but only asks for the stats of `stats_types`.
+  scoped_refptr<const RTCStatsReport> NewGetStats(
+      const std::vector<std::string>& stats_types) {
+    auto callback = make_ref_counted<MockRTCStatsCollectorCallback>();
+    peer_connection_->GetStats(stats_types, callback);
+    EXPECT_THAT(
+        WaitUntil([&] { return callback->called(); }, ::testing::IsTrue()),
+        IsRtcOk());
+    return callback->report();
+  }
+
   int rendered_width() {
     EXPECT_FALSE(fake_video_renderers_.empty());
     return fake_video_renderers_.empty()
@@ -64,7 +64,7 @@ RtpTransceiverProxyRefPtr TransceiverList::FindBySender(
     scoped_refptr<RtpSenderInterface> sender) const {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
   for (auto transceiver : transceivers_) {
-    if (transceiver->sender() == sender) {
+    if (transceiver->internal()->sender() == sender) {
       return transceiver;
     }
   }
@@ -75,7 +75,7 @@ RtpTransceiverProxyRefPtr TransceiverList::FindByMid(
     const std::string& mid) const {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
   for (auto transceiver : transceivers_) {
-    if (transceiver->mid() == mid) {
+    if (transceiver->internal()->mid() == mid) {
       return transceiver;
     }
   }
@@ -2602,6 +2602,9 @@ static std::unique_ptr<MediaContentDescription> ParseContentDescription(
   }
 
   media_desc->set_extmap_allow_mixed_enum(MediaContentDescription::kNo);
+  // Most payload types in the fmt list get a codec, so reserve for them up
+  // front rather than moving the codecs as they're added.
+  media_desc->mutable_codecs().reserve(payload_types.size());
   if (!ParseContent(message, media_type, mline_index, protocol, payload_types,
                     pos, content_name, bundle_only, msid_signaling,
                     media_desc.get(), transport, candidates, error)) {
@@ -2616,15 +2619,13 @@ static std::unique_ptr<MediaContentDescription> ParseContentDescription(
   for (int pt : payload_types) {
     payload_type_preferences[pt] = preference--;
   }
-  std::vector<Codec> codecs = media_desc->codecs();
+  std::vector<Codec>& codecs = media_desc->mutable_codecs();
   absl::c_sort(
       codecs, [&payload_type_preferences](const Codec& a, const Codec& b) {
         return payload_type_preferences[a.id] > payload_type_preferences[b.id];
       });
   // Backfill any default parameters.
   BackfillCodecParameters(codecs);
-
-  media_desc->set_codecs(codecs);
   return media_desc;
 }
 
@@ -2860,41 +2861,24 @@ void AddFeedbackParameters(const FeedbackParams& feedback_params,
   }
 }
 
-// Gets the current codec setting associated with `payload_type`. If there
-// is no Codec associated with that payload type it returns an empty codec
-// with that payload type.
-Codec GetCodecWithPayloadType(webrtc::MediaType type,
-                              const std::vector<Codec>& codecs,
-                              int payload_type) {
-  const Codec* codec = FindCodecById(codecs, payload_type);
-  if (codec)
-    return *codec;
-  // Return empty codec with `payload_type`.
-  if (type == webrtc::MediaType::AUDIO) {
-    return CreateAudioCodec(payload_type, "", 0, 0);
-  } else {
-    return CreateVideoCodec(payload_type, "");
-  }
-}
-
-// Updates or creates a new codec entry in the media description.
-void AddOrReplaceCodec(MediaContentDescription* content_desc,
-                       const Codec& codec) {
-  std::vector<Codec> codecs = content_desc->codecs();
-  bool found = false;
-  for (Codec& existing_codec : codecs) {
-    if (codec.id == existing_codec.id) {
-      // Overwrite existing codec with the new codec.
-      existing_codec = codec;
-      found = true;
-      break;
+// Gets the codec associated with `payload_type`, which is updated in place. If
+// there is no Codec associated with that payload type, an empty codec with
+// that payload type is added.
+Codec& GetOrAddCodecWithPayloadType(MediaContentDescription* content_desc,
+                                    int payload_type) {
+  std::vector<Codec>& codecs = content_desc->mutable_codecs();
+  for (Codec& codec : codecs) {
+    if (codec.id == payload_type) {
+      return codec;
     }
   }
-  if (!found) {
-    content_desc->AddCodec(codec);
-    return;
+  // Add empty codec with `payload_type`.
+  if (content_desc->type() == webrtc::MediaType::AUDIO) {
+    codecs.push_back(CreateAudioCodec(payload_type, "", 0, 0));
+  } else {
+    codecs.push_back(CreateVideoCodec(payload_type, ""));
   }
-  content_desc->set_codecs(codecs);
+  return codecs.back();
 }
 
 // Adds or updates existing codec corresponding to `payload_type` according
@@ -2903,10 +2887,8 @@ void UpdateCodec(MediaContentDescription* content_desc,
                  int payload_type,
                  const webrtc::CodecParameterMap& parameters) {
   // Codec might already have been populated (from rtpmap).
-  Codec new_codec = GetCodecWithPayloadType(
-      content_desc->type(), content_desc->codecs(), payload_type);
-  AddParameters(parameters, &new_codec);
-  AddOrReplaceCodec(content_desc, new_codec);
+  AddParameters(parameters,
+                &GetOrAddCodecWithPayloadType(content_desc, payload_type));
 }
 
 // Adds or updates existing codec corresponding to `payload_type` according
@@ -2915,10 +2897,9 @@ void UpdateCodec(MediaContentDescription* content_desc,
                  int payload_type,
                  const FeedbackParam& feedback_param) {
   // Codec might already have been populated (from rtpmap).
-  Codec new_codec = GetCodecWithPayloadType(
-      content_desc->type(), content_desc->codecs(), payload_type);
-  AddFeedbackParameter(feedback_param, &new_codec);
-  AddOrReplaceCodec(content_desc, new_codec);
+  AddFeedbackParameter(
+      feedback_param,
+      &GetOrAddCodecWithPayloadType(content_desc, payload_type));
 }
 
 // Adds or updates existing video codec corresponding to `payload_type`
@@ -2932,10 +2913,8 @@ void UpdateVideoCodecPacketization(MediaContentDescription* desc,
   }
 
   // Codec might already have been populated (from rtpmap).
-  Codec codec =
-      GetCodecWithPayloadType(desc->type(), desc->codecs(), payload_type);
-  codec.packetization = std::string(packetization);
-  AddOrReplaceCodec(desc, codec);
+  GetOrAddCodecWithPayloadType(desc, payload_type).packetization =
+      std::string(packetization);
 }
 
 std::optional<Codec> PopWildcardCodec(std::vector<Codec>* codecs) {
@@ -2952,7 +2931,7 @@ std::optional<Codec> PopWildcardCodec(std::vector<Codec>* codecs) {
 
 void UpdateFromWildcardCodecs(MediaContentDescription* desc) {
   RTC_DCHECK(desc);
-  auto codecs = desc->codecs();
+  std::vector<Codec>& codecs = desc->mutable_codecs();
   std::optional<Codec> wildcard_codec = PopWildcardCodec(&codecs);
   if (!wildcard_codec) {
     return;
@@ -2964,7 +2943,6 @@ void UpdateFromWildcardCodecs(MediaContentDescription* desc) {
   if (wildcard_codec->feedback_params.Has({"ack", "ccfb"})) {
     desc->set_rtcp_fb_ack_ccfb(true);
   }
-  desc->set_codecs(codecs);
 }
 
 void AddAudioAttribute(const std::string& name,
@@ -2974,11 +2952,9 @@ void AddAudioAttribute(const std::string& name,
   if (value.empty()) {
     return;
   }
-  std::vector<Codec> codecs = desc->codecs();
-  for (Codec& codec : codecs) {
+  for (Codec& codec : desc->mutable_codecs()) {
     codec.params[name] = std::string(value);
   }
-  desc->set_codecs(codecs);
 }
 
 bool ParseContent(absl::string_view message,
@@ -3380,7 +3356,7 @@ bool ParseContent(absl::string_view message,
   // can happen if an SDP has an fmtp or rtcp-fb with a payload type but doesn't
   // have a corresponding "rtpmap" line. This should lead to a parse error.
   if (!absl::c_all_of(media_desc->codecs(),
-                      [](const Codec codec) { return !codec.name.empty(); })) {
+                      [](const Codec& codec) { return !codec.name.empty(); })) {
     return ParseFailed("Failed to parse codecs correctly.", error);
   }
   if (media_type == webrtc::MediaType::AUDIO) {
@@ -3519,13 +3495,11 @@ void UpdateCodec(int payload_type,
                  MediaContentDescription* desc) {
   // Codec may already be populated with (only) optional parameters
   // (from an fmtp).
-  Codec codec =
-      GetCodecWithPayloadType(desc->type(), desc->codecs(), payload_type);
+  Codec& codec = GetOrAddCodecWithPayloadType(desc, payload_type);
   codec.name = std::string(name);
   codec.clockrate = clockrate;
   codec.bitrate = bitrate;
   codec.channels = channels;
-  AddOrReplaceCodec(desc, codec);
 }
 
 // Updates or creates a new codec entry in the video description according to
@@ -3535,10 +3509,7 @@ void UpdateCodec(int payload_type,
                  MediaContentDescription* desc) {
   // Codec may already be populated with (only) optional parameters
   // (from an fmtp).
-  Codec codec =
-      GetCodecWithPayloadType(desc->type(), desc->codecs(), payload_type);
-  codec.name = std::string(name);
-  AddOrReplaceCodec(desc, codec);
+  GetOrAddCodecWithPayloadType(desc, payload_type).name = std::string(name);
 }
 
 bool ParseRtpmapAttribute(absl::string_view line,
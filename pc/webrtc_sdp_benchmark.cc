@@ -0,0 +1,120 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string>
+
+#include "api/jsep.h"
+#include "api/jsep_session_description.h"
+#include "benchmark/benchmark.h"
+#include "pc/webrtc_sdp.h"
+#include "rtc_base/strings/string_builder.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumCodecs = 12;
+
+// Generates an offer with `num_sections` bundled m= sections, alternating
+// between audio and video, each with its own media stream track and a set of
+// codecs, header extensions and feedback parameters similar to what a browser
+// offers.
+std::string GenerateSdp(int num_sections) {
+  StringBuilder sdp;
+  sdp << "v=0\r\n"
+         "o=- 1 2 IN IP4 127.0.0.1\r\n"
+         "s=-\r\n"
+         "t=0 0\r\n"
+         "a=group:BUNDLE";
+  for (int i = 0; i < num_sections; ++i) {
+    sdp << " " << i;
+  }
+  sdp << "\r\na=msid-semantic: WMS\r\n";
+  for (int i = 0; i < num_sections; ++i) {
+    const bool video = i % 2 == 1;
+    const int first_payload_type = video ? 96 : 111;
+    sdp << "m=" << (video ? "video" : "audio") << " 9 UDP/TLS/RTP/SAVPF";
+    for (int j = 0; j < kNumCodecs; ++j) {
+      sdp << " " << first_payload_type + j;
+    }
+    sdp << "\r\n"
+           "c=IN IP4 0.0.0.0\r\n"
+           "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+           "a=ice-ufrag:ETEn\r\n"
+           "a=ice-pwd:OtSK0WpNtpUjkY4+86js7ZQl\r\n"
+           "a=ice-options:trickle\r\n"
+           "a=fingerprint:sha-256 "
+           "19:E2:1C:3B:4B:9F:81:E6:B8:5C:F4:A5:A8:D8:73:04:"
+           "BB:05:2F:70:9F:04:A9:0E:05:E9:26:33:E8:70:88:A2\r\n"
+           "a=setup:actpass\r\n"
+           "a=mid:"
+        << i
+        << "\r\n"
+           "a=extmap:1 urn:ietf:params:rtp-hdrext:toffset\r\n"
+           "a=extmap:2 "
+           "http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\r\n"
+           "a=extmap:3 http://www.ietf.org/id/"
+           "draft-holmer-rmcat-transport-wide-cc-extensions-01\r\n"
+           "a=sendrecv\r\n"
+           "a=msid:stream"
+        << i << " track" << i
+        << "\r\n"
+           "a=rtcp-mux\r\n"
+           "a=rtcp-rsize\r\n";
+    for (int j = 0; j < kNumCodecs; ++j) {
+      const int payload_type = first_payload_type + j;
+      if (video) {
+        sdp << "a=rtpmap:" << payload_type << " VP8/90000\r\n";
+        for (const char* feedback :
+             {"goog-remb", "transport-cc", "ccm fir", "nack", "nack pli"}) {
+          sdp << "a=rtcp-fb:" << payload_type << " " << feedback << "\r\n";
+        }
+      } else {
+        sdp << "a=rtpmap:" << payload_type << " opus/48000/2\r\n"
+            << "a=rtcp-fb:" << payload_type << " transport-cc\r\n"
+            << "a=fmtp:" << payload_type << " minptime=10;useinbandfec=1\r\n";
+      }
+    }
+    sdp << "a=ssrc:" << 1000 + i << " cname:0pU2vEVxfvNZUuqX\r\n";
+  }
+  return sdp.Release();
+}
+
+void BM_SdpDeserialize(benchmark::State& state) {
+  const std::string sdp = GenerateSdp(state.range(0));
+  for (auto _ : state) {
+    JsepSessionDescription jdesc(SdpType::kOffer);
+    SdpParseError error;
+    if (!SdpDeserialize(sdp, &jdesc, &error)) {
+      state.SkipWithError(error.description.c_str());
+      break;
+    }
+    benchmark::DoNotOptimize(jdesc);
+  }
+  state.SetBytesProcessed(state.iterations() * sdp.size());
+}
+
+void BM_SdpSerialize(benchmark::State& state) {
+  const std::string sdp = GenerateSdp(state.range(0));
+  JsepSessionDescription jdesc(SdpType::kOffer);
+  SdpParseError error;
+  if (!SdpDeserialize(sdp, &jdesc, &error)) {
+    state.SkipWithError(error.description.c_str());
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SdpSerialize(jdesc));
+  }
+}
+
+BENCHMARK(BM_SdpDeserialize)->ArgName("sections")->Arg(16)->Arg(128);
+BENCHMARK(BM_SdpSerialize)->ArgName("sections")->Arg(16)->Arg(128);
+
+}  // namespace
+}  // namespace webrtc
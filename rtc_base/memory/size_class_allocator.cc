@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/memory/size_class_allocator.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/memory/aligned_malloc.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+namespace {
+
+// Each power of two is split in 1 << kSubClassBits size classes.
+constexpr int kSubClassBits = 2;
+constexpr int kMinPooledSizeLog2 = 12;
+constexpr int kMaxPooledSizeLog2 = 27;
+constexpr int kNumSizeClasses =
+    ((kMaxPooledSizeLog2 - kMinPooledSizeLog2) << kSubClassBits) + 1;
+
+static_assert(SizeClassAllocator::kMinPooledSize ==
+              size_t{1} << kMinPooledSizeLog2);
+static_assert(SizeClassAllocator::kMaxPooledSize ==
+              size_t{1} << kMaxPooledSizeLog2);
+
+// Returns the index of the smallest size class holding `size` bytes, or -1 if
+// `size` is outside the pooled range.
+int SizeClassIndex(size_t size) {
+  if (size < SizeClassAllocator::kMinPooledSize ||
+      size > SizeClassAllocator::kMaxPooledSize) {
+    return -1;
+  }
+  int log2 = absl::bit_width(size) - 1;
+  size_t base = size_t{1} << log2;
+  size_t step = base >> kSubClassBits;
+  // Round up to the next multiple of `step` above `base`.
+  int sub_class = static_cast<int>((size - base + step - 1) / step);
+  return ((log2 - kMinPooledSizeLog2) << kSubClassBits) + sub_class;
+}
+
+size_t SizeClassBytes(int index) {
+  RTC_DCHECK_GE(index, 0);
+  RTC_DCHECK_LT(index, kNumSizeClasses);
+  int log2 = kMinPooledSizeLog2 + (index >> kSubClassBits);
+  int sub_class = index & ((1 << kSubClassBits) - 1);
+  size_t base = size_t{1} << log2;
+  return base + sub_class * (base >> kSubClassBits);
+}
+
+}  // namespace
+
+void SizeClassAllocator::Deleter::operator()(uint8_t* ptr) const {
+  RTC_DCHECK(allocator_);
+  allocator_->Free(ptr, size_, uncached_);
+}
+
+// static
+SizeClassAllocator& SizeClassAllocator::Global() {
+  static SizeClassAllocator* const instance =
+      new SizeClassAllocator(kDefaultGlobalMaxCachedBytes);
+  return *instance;
+}
+
+SizeClassAllocator::SizeClassAllocator(size_t max_cached_bytes)
+    : max_cached_bytes_(max_cached_bytes),
+      free_lists_(kNumSizeClasses),
+      last_trim_ms_(TimeMillis()) {}
+
+SizeClassAllocator::~SizeClassAllocator() {
+  MutexLock lock(&mutex_);
+  ReleaseCachedLocked(0);
+}
+
+// static
+size_t SizeClassAllocator::RoundUpToSizeClass(size_t size) {
+  int index = SizeClassIndex(size);
+  return index < 0 ? size : SizeClassBytes(index);
+}
+
+SizeClassAllocator::Block SizeClassAllocator::Allocate(size_t size) {
+  if (max_cached_bytes_.load(std::memory_order_relaxed) == 0) {
+    // Nothing is cached, so there is no shared state to lock for.
+    num_uncached_allocations_.fetch_add(1, std::memory_order_relaxed);
+    uncached_bytes_in_use_.fetch_add(size, std::memory_order_relaxed);
+    return Block(static_cast<uint8_t*>(AlignedMalloc(size, kAlignment)),
+                 Deleter(this, size, /*uncached=*/true));
+  }
+  {
+    MutexLock lock(&mutex_);
+    const int64_t now_ms = TimeMillis();
+    if (now_ms - last_trim_ms_ >= kTrimIntervalMs) {
+      TrimLocked();
+    }
+    ++stats_.num_allocations;
+    const int size_class = SizeClassIndex(size);
+    size_t block_size = size_class < 0 ? size : SizeClassBytes(size_class);
+    stats_.bytes_in_use += block_size;
+    stats_.high_water_mark_bytes =
+        std::max(stats_.high_water_mark_bytes, stats_.bytes_in_use);
+    if (size_class >= 0 && !free_lists_[size_class].empty()) {
+      uint8_t* ptr = free_lists_[size_class].back();
+      free_lists_[size_class].pop_back();
+      stats_.bytes_cached -= block_size;
+      ++stats_.num_reused;
+      return Block(ptr, Deleter(this, block_size, /*uncached=*/false));
+    }
+    ++stats_.num_system_allocations;
+    size = block_size;
+  }
+  // Allocate outside of the lock; this is the expensive part.
+  return Block(static_cast<uint8_t*>(AlignedMalloc(size, kAlignment)),
+               Deleter(this, size, /*uncached=*/false));
+}
+
+void SizeClassAllocator::Free(uint8_t* ptr, size_t size, bool uncached) {
+  if (uncached) {
+    RTC_DCHECK_GE(uncached_bytes_in_use_.load(std::memory_order_relaxed),
+                  size);
+    uncached_bytes_in_use_.fetch_sub(size, std::memory_order_relaxed);
+    num_uncached_frees_.fetch_add(1, std::memory_order_relaxed);
+    AlignedFree(ptr);
+    return;
+  }
+  {
+    MutexLock lock(&mutex_);
+    RTC_DCHECK_GE(stats_.bytes_in_use, size);
+    stats_.bytes_in_use -= size;
+    // Cached blocks are allocated with the size of their class, if any.
+    const int size_class = SizeClassIndex(size);
+    if (size_class >= 0 &&
+        stats_.bytes_cached + size <=
+            max_cached_bytes_.load(std::memory_order_relaxed)) {
+      free_lists_[size_class].push_back(ptr);
+      stats_.bytes_cached += size;
+      return;
+    }
+    ++stats_.num_system_frees;
+  }
+  AlignedFree(ptr);
+}
+
+void SizeClassAllocator::SetMaxCachedBytes(size_t max_cached_bytes) {
+  MutexLock lock(&mutex_);
+  max_cached_bytes_.store(max_cached_bytes, std::memory_order_relaxed);
+  ReleaseCachedLocked(max_cached_bytes);
+}
+
+void SizeClassAllocator::Trim() {
+  MutexLock lock(&mutex_);
+  TrimLocked();
+}
+
+void SizeClassAllocator::TrimLocked() {
+  last_trim_ms_ = TimeMillis();
+  size_t budget = stats_.high_water_mark_bytes > stats_.bytes_in_use
+                      ? stats_.high_water_mark_bytes - stats_.bytes_in_use
+                      : 0;
+  ReleaseCachedLocked(budget);
+  stats_.high_water_mark_bytes = stats_.bytes_in_use;
+}
+
+SizeClassAllocator::Stats SizeClassAllocator::GetStats() const {
+  Stats stats;
+  {
+    MutexLock lock(&mutex_);
+    stats = stats_;
+  }
+  int64_t num_uncached_allocations =
+      num_uncached_allocations_.load(std::memory_order_relaxed);
+  stats.num_allocations += num_uncached_allocations;
+  stats.num_system_allocations += num_uncached_allocations;
+  stats.num_system_frees += num_uncached_frees_.load(std::memory_order_relaxed);
+  stats.bytes_in_use += uncached_bytes_in_use_.load(std::memory_order_relaxed);
+  stats.high_water_mark_bytes =
+      std::max(stats.high_water_mark_bytes, stats.bytes_in_use);
+  return stats;
+}
+
+void SizeClassAllocator::ReleaseCachedLocked(size_t target_bytes) {
+  // Largest blocks first: they are the most expensive to keep and the most
+  // likely to belong to a resolution that has been adapted away from.
+  for (int index = kNumSizeClasses - 1;
+       index >= 0 && stats_.bytes_cached > target_bytes; --index) {
+    std::vector<uint8_t*>& free_list = free_lists_[index];
+    size_t block_size = SizeClassBytes(index);
+    while (!free_list.empty() && stats_.bytes_cached > target_bytes) {
+      AlignedFree(free_list.back());
+      free_list.pop_back();
+      stats_.bytes_cached -= block_size;
+      ++stats_.num_system_frees;
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_MEMORY_SIZE_CLASS_ALLOCATOR_H_
+#define RTC_BASE_MEMORY_SIZE_CLASS_ALLOCATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Thread safe allocator of large, aligned memory blocks, intended for video
+// frame buffers. Requested sizes are rounded up to a size class (four classes
+// per power of two, so at most 25% of a block is wasted) and freed blocks are
+// kept on a per class free list, so that buffers of a different but similar
+// resolution can reuse them. This lets memory be recycled across resolution
+// changes, e.g. when simulcast layers are reconfigured or the resolution is
+// adapted, where a per-resolution pool would have to drop its buffers.
+//
+// When caching is disabled (`max_cached_bytes` is 0), every allocation is
+// forwarded to AlignedMalloc with the exact size, without taking the lock.
+// While caching is enabled, the allocator trims itself, see Trim(), at most
+// every kTrimInterval as blocks are allocated.
+//
+// The cache does not attempt any NUMA placement; blocks are handed out to
+// whichever thread asks first.
+class RTC_EXPORT SizeClassAllocator {
+ public:
+  // All returned blocks are aligned to this many bytes.
+  static constexpr size_t kAlignment = 64;
+  // Smallest and largest block sizes that are recycled. Requests outside this
+  // range always go to the system allocator.
+  static constexpr size_t kMinPooledSize = 4 * 1024;
+  static constexpr size_t kMaxPooledSize = 128 * 1024 * 1024;
+  // Cache size of the Global() instance, enough for a few frames of each
+  // layer of a 1080p simulcast stream.
+  static constexpr size_t kDefaultGlobalMaxCachedBytes = 32 * 1024 * 1024;
+  static constexpr int64_t kTrimIntervalMs = 10000;
+
+  struct Stats {
+    // Number of calls to Allocate().
+    int64_t num_allocations = 0;
+    // Number of allocations that were served from the free lists.
+    int64_t num_reused = 0;
+    // Number of blocks allocated from and released to the system.
+    int64_t num_system_allocations = 0;
+    int64_t num_system_frees = 0;
+    // Bytes currently handed out, and the maximum since the last Trim().
+    size_t bytes_in_use = 0;
+    size_t high_water_mark_bytes = 0;
+    // Bytes currently kept on the free lists.
+    size_t bytes_cached = 0;
+  };
+
+  // Deleter returning a block to the allocator it was allocated from. The
+  // allocator must outlive all blocks it has handed out.
+  class Deleter {
+   public:
+    Deleter() = default;
+    void operator()(uint8_t* ptr) const;
+
+    // What Free() needs to take the block back.
+    size_t size() const { return size_; }
+    bool uncached() const { return uncached_; }
+
+   private:
+    friend class SizeClassAllocator;
+    Deleter(SizeClassAllocator* allocator, size_t size, bool uncached)
+        : allocator_(allocator), size_(size), uncached_(uncached) {}
+
+    SizeClassAllocator* allocator_ = nullptr;
+    size_t size_ = 0;
+    // Whether the block was allocated while caching was disabled, and so is
+    // freed without taking the lock.
+    bool uncached_ = false;
+  };
+
+  using Block = std::unique_ptr<uint8_t, Deleter>;
+
+  // Returns the process wide instance, which is never destroyed. It caches up
+  // to kDefaultGlobalMaxCachedBytes; embedders can change that, or disable
+  // caching, with SetMaxCachedBytes().
+  static SizeClassAllocator& Global();
+
+  explicit SizeClassAllocator(size_t max_cached_bytes = 0);
+  ~SizeClassAllocator();
+
+  SizeClassAllocator(const SizeClassAllocator&) = delete;
+  SizeClassAllocator& operator=(const SizeClassAllocator&) = delete;
+
+  // Returns a block of at least `size` bytes aligned to `kAlignment`.
+  Block Allocate(size_t size);
+
+  // Takes back a block that was released from its Block, given the size()
+  // and uncached() of the Block's deleter. For owners that keep blocks in a
+  // type of their own, e.g. to not expose this class in their headers.
+  void Free(uint8_t* ptr, size_t size, bool uncached);
+
+  // Sets the upper bound on memory kept on the free lists. Lowering the bound
+  // releases cached blocks immediately.
+  void SetMaxCachedBytes(size_t max_cached_bytes);
+
+  // Releases cached blocks so that in use plus cached memory does not exceed
+  // the high water mark of in use memory since the previous call to Trim(),
+  // then restarts the high water mark. This returns memory kept for
+  // resolutions that are no longer used. Besides the calls made by
+  // Allocate(), it can be called e.g. when memory is low.
+  void Trim();
+
+  Stats GetStats() const;
+
+  // Returns the size in bytes of the size class that `size` rounds up to, or
+  // `size` if it is outside the pooled range.
+  static size_t RoundUpToSizeClass(size_t size);
+
+ private:
+  void TrimLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Frees cached blocks, largest first, until `bytes_cached_` is at most
+  // `target_bytes`.
+  void ReleaseCachedLocked(size_t target_bytes)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable Mutex mutex_;
+  // Written with `mutex_` held, and read without locking by Allocate() to
+  // skip the lock when caching is disabled.
+  std::atomic<size_t> max_cached_bytes_;
+  std::vector<std::vector<uint8_t*>> free_lists_ RTC_GUARDED_BY(mutex_);
+  Stats stats_ RTC_GUARDED_BY(mutex_);
+  int64_t last_trim_ms_ RTC_GUARDED_BY(mutex_);
+  // Counters of the blocks allocated while caching is disabled, which are
+  // added to `stats_` by GetStats().
+  std::atomic<int64_t> num_uncached_allocations_{0};
+  std::atomic<int64_t> num_uncached_frees_{0};
+  std::atomic<size_t> uncached_bytes_in_use_{0};
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_MEMORY_SIZE_CLASS_ALLOCATOR_H_
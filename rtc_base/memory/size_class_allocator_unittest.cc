@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/memory/size_class_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "api/units/time_delta.h"
+#include "rtc_base/fake_clock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kCacheSize = 64 * 1024 * 1024;
+
+bool IsAligned(const uint8_t* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % SizeClassAllocator::kAlignment ==
+         0;
+}
+
+TEST(SizeClassAllocatorTest, RoundsUpToSizeClass) {
+  EXPECT_EQ(SizeClassAllocator::RoundUpToSizeClass(4096), 4096u);
+  EXPECT_EQ(SizeClassAllocator::RoundUpToSizeClass(4097), 5120u);
+  EXPECT_EQ(SizeClassAllocator::RoundUpToSizeClass(8000), 8192u);
+  // 640x360 I420.
+  EXPECT_EQ(SizeClassAllocator::RoundUpToSizeClass(345600), 393216u);
+  // Outside of the pooled range.
+  EXPECT_EQ(SizeClassAllocator::RoundUpToSizeClass(100), 100u);
+}
+
+TEST(SizeClassAllocatorTest, DoesNotCacheByDefault) {
+  SizeClassAllocator allocator;
+  allocator.Allocate(100000).reset();
+  SizeClassAllocator::Block block = allocator.Allocate(100000);
+  EXPECT_TRUE(IsAligned(block.get()));
+
+  SizeClassAllocator::Stats stats = allocator.GetStats();
+  EXPECT_EQ(stats.num_allocations, 2);
+  EXPECT_EQ(stats.num_reused, 0);
+  EXPECT_EQ(stats.num_system_frees, 1);
+  EXPECT_EQ(stats.bytes_in_use, 100000u);
+  EXPECT_EQ(stats.bytes_cached, 0u);
+}
+
+TEST(SizeClassAllocatorTest, ReusesBlockOfSameSizeClass) {
+  SizeClassAllocator allocator(kCacheSize);
+  SizeClassAllocator::Block block = allocator.Allocate(100000);
+  uint8_t* ptr = block.get();
+  block.reset();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, 114688u);
+
+  // A slightly different size maps to the same size class.
+  block = allocator.Allocate(110000);
+  EXPECT_EQ(block.get(), ptr);
+  EXPECT_TRUE(IsAligned(block.get()));
+
+  SizeClassAllocator::Stats stats = allocator.GetStats();
+  EXPECT_EQ(stats.num_allocations, 2);
+  EXPECT_EQ(stats.num_reused, 1);
+  EXPECT_EQ(stats.num_system_allocations, 1);
+  EXPECT_EQ(stats.bytes_cached, 0u);
+}
+
+TEST(SizeClassAllocatorTest, DoesNotCacheMoreThanLimit) {
+  SizeClassAllocator allocator(/*max_cached_bytes=*/8192);
+  SizeClassAllocator::Block first = allocator.Allocate(8192);
+  SizeClassAllocator::Block second = allocator.Allocate(8192);
+  first.reset();
+  second.reset();
+  SizeClassAllocator::Stats stats = allocator.GetStats();
+  EXPECT_EQ(stats.bytes_cached, 8192u);
+  EXPECT_EQ(stats.num_system_frees, 1);
+}
+
+TEST(SizeClassAllocatorTest, TrimReleasesMemoryAboveHighWaterMark) {
+  SizeClassAllocator allocator(kCacheSize);
+  {
+    SizeClassAllocator::Block large = allocator.Allocate(1 << 20);
+    SizeClassAllocator::Block small = allocator.Allocate(1 << 16);
+  }
+  // Both blocks were in use since the last trim, so both are kept.
+  allocator.Trim();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, (1u << 20) + (1u << 16));
+
+  // Only the small block is used in the following period.
+  allocator.Allocate(1 << 16).reset();
+  allocator.Trim();
+  SizeClassAllocator::Stats stats = allocator.GetStats();
+  EXPECT_EQ(stats.bytes_cached, 1u << 16);
+  EXPECT_EQ(stats.high_water_mark_bytes, 0u);
+}
+
+TEST(SizeClassAllocatorTest, TrimsPeriodicallyWhenAllocating) {
+  ScopedBaseFakeClock clock;
+  SizeClassAllocator allocator(kCacheSize);
+  {
+    SizeClassAllocator::Block large = allocator.Allocate(1 << 20);
+    SizeClassAllocator::Block small = allocator.Allocate(1 << 16);
+  }
+  clock.AdvanceTime(TimeDelta::Millis(SizeClassAllocator::kTrimIntervalMs));
+  // Both blocks were in use in the first interval, so both are kept.
+  allocator.Allocate(1 << 16).reset();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, (1u << 20) + (1u << 16));
+
+  // The large block was idle for all of the second interval.
+  clock.AdvanceTime(TimeDelta::Millis(SizeClassAllocator::kTrimIntervalMs));
+  allocator.Allocate(1 << 16).reset();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, 1u << 16);
+}
+
+TEST(SizeClassAllocatorTest, GlobalInstanceCachesByDefault) {
+  SizeClassAllocator::Global().Allocate(1 << 20).reset();
+  EXPECT_GE(SizeClassAllocator::Global().GetStats().bytes_cached, 1u << 20);
+}
+
+TEST(SizeClassAllocatorTest, LoweringLimitReleasesCachedBlocks) {
+  SizeClassAllocator allocator(kCacheSize);
+  allocator.Allocate(1 << 20).reset();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, 1u << 20);
+  allocator.SetMaxCachedBytes(0);
+  EXPECT_EQ(allocator.GetStats().bytes_cached, 0u);
+}
+
+TEST(SizeClassAllocatorTest, KeepsCountingBlocksAcrossLimitChanges) {
+  SizeClassAllocator allocator;
+  SizeClassAllocator::Block uncached = allocator.Allocate(100000);
+  allocator.SetMaxCachedBytes(kCacheSize);
+  SizeClassAllocator::Block cached = allocator.Allocate(100000);
+  EXPECT_EQ(allocator.GetStats().bytes_in_use, 100000u + 114688u);
+
+  // The block allocated while caching was disabled is not recycled.
+  uncached.reset();
+  SizeClassAllocator::Stats stats = allocator.GetStats();
+  EXPECT_EQ(stats.bytes_in_use, 114688u);
+  EXPECT_EQ(stats.bytes_cached, 0u);
+  EXPECT_EQ(stats.num_system_frees, 1);
+
+  cached.reset();
+  EXPECT_EQ(allocator.GetStats().bytes_cached, 114688u);
+  allocator.SetMaxCachedBytes(0);
+  stats = allocator.GetStats();
+  EXPECT_EQ(stats.num_allocations, 2);
+  EXPECT_EQ(stats.num_system_allocations, 2);
+  EXPECT_EQ(stats.num_system_frees, 2);
+  EXPECT_EQ(stats.bytes_in_use, 0u);
+  EXPECT_EQ(stats.bytes_cached, 0u);
+}
+
+}  // namespace
+}  // namespace webrtc
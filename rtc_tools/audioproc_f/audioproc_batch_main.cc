@@ -0,0 +1,142 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdio.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment_factory.h"
+#include "common_audio/wav_file.h"
+#include "modules/audio_processing/offline/offline_audio_processor.h"
+#include "rtc_base/logging.h"
+
+ABSL_FLAG(int, num_threads, 1, "Number of files processed in parallel.");
+ABSL_FLAG(int,
+          block_duration_ms,
+          1000,
+          "Duration of the audio read from and written to the files at a "
+          "time. At least 10 ms.");
+ABSL_FLAG(int, stream_delay_ms, 0, "Render to capture delay to report.");
+ABSL_FLAG(bool, aec, true, "Activate the echo canceller.");
+ABSL_FLAG(bool, ns, true, "Activate the noise suppressor.");
+ABSL_FLAG(bool, agc2, false, "Activate the adaptive digital gain controller.");
+ABSL_FLAG(bool, hpf, true, "Activate the high-pass filter.");
+ABSL_FLAG(bool, float_wav_output, false, "Write float WAV output files.");
+
+namespace webrtc {
+namespace {
+
+bool ReadJobs(absl::string_view filename,
+              std::vector<OfflineProcessingJob>& jobs) {
+  std::ifstream file{std::string(filename)};
+  if (!file.is_open()) {
+    RTC_LOG(LS_ERROR) << "Could not open " << filename;
+    return false;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::vector<std::string> fields = absl::StrSplit(line, ',');
+    if (fields.size() < 2 || fields.size() > 3) {
+      RTC_LOG(LS_ERROR) << "Malformed line: " << line;
+      return false;
+    }
+    jobs.push_back({.capture_filename = fields[0],
+                    .render_filename = fields.size() == 3 ? fields[2] : "",
+                    .output_filename = fields[1]});
+  }
+  return true;
+}
+
+int RunBatch(absl::string_view job_list_filename) {
+  if (absl::GetFlag(FLAGS_num_threads) < 1) {
+    RTC_LOG(LS_ERROR) << "--num_threads must be at least 1.";
+    return 1;
+  }
+  if (absl::GetFlag(FLAGS_block_duration_ms) < AudioProcessing::kChunkSizeMs) {
+    RTC_LOG(LS_ERROR) << "--block_duration_ms must be at least "
+                      << AudioProcessing::kChunkSizeMs << ".";
+    return 1;
+  }
+
+  std::vector<OfflineProcessingJob> jobs;
+  if (!ReadJobs(job_list_filename, jobs)) {
+    return 1;
+  }
+
+  OfflineAudioProcessor::Config config;
+  config.apm_config.echo_canceller.enabled = absl::GetFlag(FLAGS_aec);
+  config.apm_config.noise_suppression.enabled = absl::GetFlag(FLAGS_ns);
+  config.apm_config.gain_controller2.enabled = absl::GetFlag(FLAGS_agc2);
+  config.apm_config.gain_controller2.adaptive_digital.enabled =
+      absl::GetFlag(FLAGS_agc2);
+  config.apm_config.high_pass_filter.enabled = absl::GetFlag(FLAGS_hpf);
+  config.num_threads = absl::GetFlag(FLAGS_num_threads);
+  config.block_duration_ms = absl::GetFlag(FLAGS_block_duration_ms);
+  config.stream_delay_ms = absl::GetFlag(FLAGS_stream_delay_ms);
+  if (absl::GetFlag(FLAGS_float_wav_output)) {
+    config.output_format = WavFile::SampleFormat::kFloat;
+  }
+  OfflineAudioProcessor processor(CreateEnvironment(), config);
+  const OfflineBatchResult result = processor.ProcessBatch(jobs);
+
+  int num_failed_jobs = 0;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    const OfflineProcessingResult& job_result = result.jobs[i];
+    if (!job_result.success) {
+      ++num_failed_jobs;
+      printf("%s: failed\n", jobs[i].capture_filename.c_str());
+      continue;
+    }
+    printf("%s: %.1f s of audio in %.1f s (%.1fx realtime)\n",
+           jobs[i].capture_filename.c_str(),
+           job_result.audio_duration.seconds<double>(),
+           job_result.processing_time.seconds<double>(),
+           job_result.RealtimeFactor());
+  }
+  printf("Total: %.1f s of audio in %.1f s (%.1fx realtime), %d failed\n",
+         result.audio_duration.seconds<double>(),
+         result.processing_time.seconds<double>(), result.RealtimeFactor(),
+         num_failed_jobs);
+  return num_failed_jobs == 0 ? 0 : 1;
+}
+
+}  // namespace
+}  // namespace webrtc
+
+// Processes recorded WAV files through the audio processing as fast as
+// possible and reports the throughput.
+int main(int argc, char* argv[]) {
+  absl::SetProgramUsageMessage(
+      "Processes a batch of WAV recordings through the audio processing.\n"
+      "The job list has one recording per line, using the format:\n"
+      "<capture_wav>,<output_wav>[,<render_wav>]\n"
+      "\n"
+      "Example usage:\n"
+      "./audioproc_batch --num_threads=8 <job_list>\n");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() != 2) {
+    absl::string_view usage = absl::ProgramUsageMessage();
+    fwrite(usage.data(), usage.size(), 1, stderr);
+    return 1;
+  }
+  webrtc::LogMessage::LogToDebug(webrtc::LS_WARNING);
+  return webrtc::RunBatch(args[1]);
+}
@@ -12,7 +12,8 @@
  *  Create a server using: ./data_channel_benchmark --server --port 12345
  *  Start the flow of data from the server to a client using:
  *  ./data_channel_benchmark --port 12345 --transfer_size 100 --packet_size 8196
- *  The throughput is reported on the server console.
+ *  The throughput, in bytes and in messages, is reported on the server
+ *  console.
  *
  *  The negotiation does not require a 3rd party server and is done over a gRPC
  *  transport. No TURN server is configured, so both peers need to be reachable
@@ -293,11 +294,14 @@ int RunServer() {
 
           auto end_time = webrtc::Clock::GetRealTimeClock()->CurrentTime();
           auto duration_ms = (end_time - begin_time).ms<size_t>();
-          double throughput =
-              (data_channel_observer->parameters().transfer_size / 1024. /
-               1024.) /
-              (duration_ms / 1000.);
-          printf("Elapsed time: %zums %gMiB/s\n", duration_ms, throughput);
+          const SetupMessage& parameters = data_channel_observer->parameters();
+          double throughput = (parameters.transfer_size / 1024. / 1024.) /
+                              (duration_ms / 1000.);
+          size_t num_messages =
+              (parameters.transfer_size + parameters.packet_size - 1) /
+              parameters.packet_size;
+          printf("Elapsed time: %zums %gMiB/s %g messages/s\n", duration_ms,
+                 throughput, num_messages / (duration_ms / 1000.));
         },
         port, oneshot);
     grpc_server->Start();
@@ -0,0 +1,592 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "stats/rtc_stats_report_encoder.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/attribute.h"
+#include "api/stats/rtc_stats.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/encoder/var_int.h"
+#include "rtc_base/bitstream_reader.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+// The storage of a decoded attribute, with the alternatives in the same order
+// as `Attribute::StatVariant`, whose index identifies the type of an attribute
+// in the encoded schemas.
+using Value = std::variant<std::optional<bool>,
+                           std::optional<int32_t>,
+                           std::optional<uint32_t>,
+                           std::optional<int64_t>,
+                           std::optional<uint64_t>,
+                           std::optional<double>,
+                           std::optional<std::string>,
+                           std::optional<std::vector<bool>>,
+                           std::optional<std::vector<int32_t>>,
+                           std::optional<std::vector<uint32_t>>,
+                           std::optional<std::vector<int64_t>>,
+                           std::optional<std::vector<uint64_t>>,
+                           std::optional<std::vector<double>>,
+                           std::optional<std::vector<std::string>>,
+                           std::optional<std::map<std::string, uint64_t>>,
+                           std::optional<std::map<std::string, double>>>;
+
+constexpr size_t kNumValueTypes = std::variant_size_v<Value>;
+static_assert(kNumValueTypes == std::variant_size_v<Attribute::StatVariant>);
+
+// Returns an unset value of the type with index `type` in `Value`.
+template <size_t... kTypes>
+std::optional<Value> CreateValue(uint64_t type,
+                                 std::index_sequence<kTypes...>) {
+  std::optional<Value> value;
+  ((type == kTypes ? (value.emplace(std::in_place_index<kTypes>), 0) : 0), ...);
+  return value;
+}
+
+template <typename T>
+uint64_t ToBits(T value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    static_assert(sizeof(T) == sizeof(uint64_t));
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  } else if constexpr (std::is_signed_v<T>) {
+    return static_cast<uint64_t>(static_cast<int64_t>(value));
+  } else {
+    return static_cast<uint64_t>(value);
+  }
+}
+
+template <typename T>
+T FromBits(uint64_t bits) {
+  if constexpr (std::is_floating_point_v<T>) {
+    T value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return bits != 0;
+  } else if constexpr (std::is_signed_v<T>) {
+    return static_cast<T>(static_cast<int64_t>(bits));
+  } else {
+    return static_cast<T>(bits);
+  }
+}
+
+// Maps the difference of two integers, which may be negative, to an unsigned
+// value that is small if the difference is, i.e. 0, -1, 1, -2, 2... map to 0,
+// 1, 2, 3, 4...
+uint64_t ZigZagEncode(uint64_t difference) {
+  return (difference << 1) ^ (0 - (difference >> 63));
+}
+
+uint64_t ZigZagDecode(uint64_t value) {
+  return (value >> 1) ^ (0 - (value & 1));
+}
+
+// The xor of two doubles that are close to each other has its set bits in the
+// mantissa, which often ends with zero bytes. Reversing the byte order moves
+// these to the most significant end, where they don't take space in a varint.
+uint64_t ReverseBytes(uint64_t value) {
+  uint64_t reversed = 0;
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    reversed = (reversed << 8) | (value & 0xff);
+    value >>= 8;
+  }
+  return reversed;
+}
+
+// Returns true if `a` and `b` have the same attribute names and types, in the
+// same order.
+bool HaveSameSchema(const std::vector<Attribute>& a,
+                    const std::vector<Attribute>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].as_variant().index() != b[i].as_variant().index() ||
+        (a[i].name() != b[i].name() &&
+         std::strcmp(a[i].name(), b[i].name()) != 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns a key that identifies the schema of stats objects of type `type`
+// with `attributes`. Objects of the same type can differ in their attributes,
+// e.g. the audio and video "media-source" stats.
+std::string SchemaKey(absl::string_view type,
+                      const std::vector<Attribute>& attributes) {
+  std::string key(type);
+  for (const Attribute& attribute : attributes) {
+    key += '\0';
+    key += attribute.name();
+    key += '\0';
+    key += static_cast<char>(attribute.as_variant().index());
+  }
+  return key;
+}
+
+}  // namespace
+
+// Writes the varints of an encoded report.
+class RTCStatsReportEncoder::Writer {
+ public:
+  Writer(std::map<std::string, uint64_t, std::less<>>& string_indices,
+         std::string& output)
+      : string_indices_(string_indices), output_(output) {}
+
+  void WriteVarInt(uint64_t value) { output_ += EncodeVarInt(value); }
+
+  // Writes the difference of `value` to `last`.
+  template <typename T>
+  void WriteNumber(T value, T last) {
+    if constexpr (std::is_floating_point_v<T>) {
+      WriteVarInt(ReverseBytes(ToBits(value) ^ ToBits(last)));
+    } else {
+      WriteVarInt(ZigZagEncode(ToBits(value) - ToBits(last)));
+    }
+  }
+
+  // Strings are written as 0, followed by their length and bytes, the first
+  // time they are written, and as one more than their index in the order they
+  // were first written in after that.
+  void WriteString(absl::string_view value) {
+    auto it = string_indices_.find(value);
+    if (it != string_indices_.end()) {
+      WriteVarInt(it->second + 1);
+      return;
+    }
+    string_indices_.emplace(value, string_indices_.size());
+    WriteVarInt(0);
+    WriteVarInt(value.size());
+    output_.append(value.data(), value.size());
+  }
+
+  // Writes the value of an attribute, given its value in the last report, if
+  // any.
+  template <typename T>
+  void WriteValue(const T& value, const T* last) {
+    WriteNumber(value, last ? *last : T());
+  }
+  void WriteValue(const std::string& value, const std::string* /* last */) {
+    WriteString(value);
+  }
+  // The elements of sequences are written as the difference to the element
+  // before them.
+  template <typename T>
+  void WriteValue(const std::vector<T>& values,
+                  const std::vector<T>* /* last */) {
+    WriteVarInt(values.size());
+    T last = T();
+    for (const T& value : values) {
+      WriteNumber<T>(value, last);
+      last = value;
+    }
+  }
+  void WriteValue(const std::vector<std::string>& values,
+                  const std::vector<std::string>* /* last */) {
+    WriteVarInt(values.size());
+    for (const std::string& value : values) {
+      WriteString(value);
+    }
+  }
+  template <typename T>
+  void WriteValue(const std::map<std::string, T>& values,
+                  const std::map<std::string, T>* /* last */) {
+    WriteVarInt(values.size());
+    for (const auto& [key, value] : values) {
+      WriteString(key);
+      WriteNumber(value, T());
+    }
+  }
+
+ private:
+  std::map<std::string, uint64_t, std::less<>>& string_indices_;
+  std::string& output_;
+};
+
+RTCStatsReportEncoder::RTCStatsReportEncoder() = default;
+
+RTCStatsReportEncoder::~RTCStatsReportEncoder() = default;
+
+std::string RTCStatsReportEncoder::Encode(
+    scoped_refptr<const RTCStatsReport> report) {
+  RTC_DCHECK(report);
+  std::string output;
+  Writer writer(string_indices_, output);
+  Timestamp last_timestamp =
+      last_report_ ? last_report_->timestamp() : Timestamp::Zero();
+  writer.WriteNumber(report->timestamp().us(), last_timestamp.us());
+  writer.WriteVarInt(report->size());
+  for (const RTCStats& stats : *report) {
+    EncodeStats(stats, report->timestamp(), writer);
+  }
+  last_report_ = std::move(report);
+  return output;
+}
+
+// A stats object is written as its id, followed by whether it is new, i.e. it
+// wasn't in the last report with the same schema. New stats objects are
+// followed by their schema, which is written like strings are: as 0 followed by
+// the type and the attribute names and types the first time, and as one more
+// than its index in the order schemas were first written in after that. All
+// stats objects end with their timestamp and the attributes that changed since
+// the last report.
+void RTCStatsReportEncoder::EncodeStats(const RTCStats& stats,
+                                        Timestamp report_timestamp,
+                                        Writer& writer) {
+  writer.WriteString(stats.id());
+  std::vector<Attribute> attributes = stats.Attributes();
+  const RTCStats* last = last_report_ ? last_report_->Get(stats.id()) : nullptr;
+  std::vector<Attribute> last_attributes;
+  if (last) {
+    last_attributes = last->Attributes();
+    if (std::strcmp(last->type(), stats.type()) != 0 ||
+        !HaveSameSchema(attributes, last_attributes)) {
+      last = nullptr;
+      last_attributes.clear();
+    }
+  }
+  writer.WriteVarInt(last ? 0 : 1);
+  if (!last) {
+    auto [it, inserted] = schema_indices_.emplace(
+        SchemaKey(stats.type(), attributes), schema_indices_.size());
+    if (!inserted) {
+      writer.WriteVarInt(it->second + 1);
+    } else {
+      writer.WriteVarInt(0);
+      writer.WriteString(stats.type());
+      writer.WriteVarInt(attributes.size());
+      for (const Attribute& attribute : attributes) {
+        writer.WriteString(attribute.name());
+        writer.WriteVarInt(attribute.as_variant().index());
+      }
+    }
+  }
+  writer.WriteNumber(stats.timestamp().us(), report_timestamp.us());
+
+  std::vector<size_t> changed;
+  for (size_t i = 0; i < attributes.size(); ++i) {
+    if (last ? attributes[i] != last_attributes[i]
+             : attributes[i].has_value()) {
+      changed.push_back(i);
+    }
+  }
+  // Changed attributes are written as their index and whether they have a
+  // value, followed by the value.
+  writer.WriteVarInt(changed.size());
+  for (size_t i : changed) {
+    const Attribute& attribute = attributes[i];
+    writer.WriteVarInt((i << 1) | (attribute.has_value() ? 1 : 0));
+    if (!attribute.has_value()) {
+      continue;
+    }
+    std::visit(
+        [&](const auto* value) {
+          const decltype(value) last_value =
+              last ? std::get<decltype(value)>(last_attributes[i].as_variant())
+                   : nullptr;
+          writer.WriteValue(**value, last_value && last_value->has_value()
+                                         ? &**last_value
+                                         : nullptr);
+        },
+        attribute.as_variant());
+  }
+}
+
+// The type and attribute names and types of decoded stats objects.
+struct RTCStatsReportDecoder::Schema {
+  std::string type;
+  std::vector<std::string> names;
+  // Unset attributes of the attribute types.
+  std::vector<Value> values;
+};
+
+class RTCStatsReportDecoder::DecodedStats : public RTCStats {
+ public:
+  DecodedStats(const std::string& id,
+               Timestamp timestamp,
+               std::shared_ptr<const Schema> schema)
+      : RTCStats(id, timestamp),
+        schema_(std::move(schema)),
+        values_(schema_->values) {}
+
+  std::unique_ptr<RTCStats> copy() const override {
+    return std::make_unique<DecodedStats>(*this);
+  }
+  const char* type() const override { return schema_->type.c_str(); }
+
+  const std::shared_ptr<const Schema>& schema() const { return schema_; }
+  Value& value(size_t index) { return values_[index]; }
+
+ protected:
+  std::vector<Attribute> AttributesImpl(
+      size_t additional_capacity) const override {
+    std::vector<Attribute> attributes =
+        RTCStats::AttributesImpl(values_.size() + additional_capacity);
+    for (size_t i = 0; i < values_.size(); ++i) {
+      attributes.push_back(std::visit(
+          [&](const auto& value) {
+            return Attribute(schema_->names[i].c_str(), &value);
+          },
+          values_[i]));
+    }
+    return attributes;
+  }
+
+ private:
+  std::shared_ptr<const Schema> schema_;
+  std::vector<Value> values_;
+};
+
+// Reads the varints of an encoded report, as written by
+// `RTCStatsReportEncoder::Writer`. Like `BitstreamReader`, sets the reader into
+// the failure state on errors, in which case the read values are unspecified.
+class RTCStatsReportDecoder::Reader {
+ public:
+  Reader(absl::string_view input, std::vector<std::string>& strings)
+      : reader_(input), strings_(strings) {}
+
+  bool Ok() const { return reader_.Ok(); }
+  bool Done() const { return reader_.RemainingBitCount() == 0; }
+  void Invalidate() { reader_.Invalidate(); }
+
+  uint64_t ReadVarInt() { return DecodeVarInt(reader_); }
+
+  // Reads the number of elements of something where each takes at least one
+  // byte.
+  size_t ReadSize() {
+    uint64_t size = ReadVarInt();
+    if (!Ok() ||
+        size > static_cast<uint64_t>(reader_.RemainingBitCount()) / 8) {
+      Invalidate();
+      return 0;
+    }
+    return size;
+  }
+
+  template <typename T>
+  T ReadNumber(T last) {
+    uint64_t bits = ReadVarInt();
+    if constexpr (std::is_floating_point_v<T>) {
+      return FromBits<T>(ReverseBytes(bits) ^ ToBits(last));
+    } else {
+      return FromBits<T>(ToBits(last) + ZigZagDecode(bits));
+    }
+  }
+
+  std::optional<Timestamp> ReadTimestamp(Timestamp last) {
+    int64_t us = ReadNumber(last.us());
+    if (us < 0 || us == std::numeric_limits<int64_t>::max()) {
+      Invalidate();
+      return std::nullopt;
+    }
+    return Timestamp::Micros(us);
+  }
+
+  std::string ReadString() {
+    uint64_t index = ReadVarInt();
+    if (!Ok()) {
+      return std::string();
+    }
+    if (index > 0) {
+      if (index > strings_.size()) {
+        Invalidate();
+        return std::string();
+      }
+      return strings_[index - 1];
+    }
+    size_t size = ReadSize();
+    std::string value = reader_.ReadString(static_cast<int>(size));
+    if (Ok()) {
+      strings_.push_back(value);
+    }
+    return value;
+  }
+
+  // Reads the value of an attribute into `value`, which holds its value in the
+  // last report, or the default value if it had none.
+  template <typename T>
+  void ReadValue(T& value) {
+    value = ReadNumber(value);
+  }
+  void ReadValue(std::string& value) { value = ReadString(); }
+  template <typename T>
+  void ReadValue(std::vector<T>& values) {
+    size_t size = ReadSize();
+    values.clear();
+    values.reserve(size);
+    T last = T();
+    for (size_t i = 0; i < size && Ok(); ++i) {
+      last = ReadNumber(last);
+      values.push_back(last);
+    }
+  }
+  void ReadValue(std::vector<std::string>& values) {
+    size_t size = ReadSize();
+    values.clear();
+    values.reserve(size);
+    for (size_t i = 0; i < size && Ok(); ++i) {
+      values.push_back(ReadString());
+    }
+  }
+  template <typename T>
+  void ReadValue(std::map<std::string, T>& values) {
+    size_t size = ReadSize();
+    values.clear();
+    for (size_t i = 0; i < size && Ok(); ++i) {
+      std::string key = ReadString();
+      values[std::move(key)] = ReadNumber(T());
+    }
+  }
+
+ private:
+  BitstreamReader reader_;
+  std::vector<std::string>& strings_;
+};
+
+RTCStatsReportDecoder::RTCStatsReportDecoder() = default;
+
+RTCStatsReportDecoder::~RTCStatsReportDecoder() = default;
+
+scoped_refptr<const RTCStatsReport> RTCStatsReportDecoder::Decode(
+    absl::string_view encoded) {
+  Reader reader(encoded, strings_);
+  std::optional<Timestamp> timestamp = reader.ReadTimestamp(
+      last_report_ ? last_report_->timestamp() : Timestamp::Zero());
+  size_t num_stats = reader.ReadSize();
+  if (!reader.Ok()) {
+    return nullptr;
+  }
+  scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(*timestamp);
+  for (size_t i = 0; i < num_stats; ++i) {
+    std::unique_ptr<RTCStats> stats = DecodeStats(reader, *timestamp);
+    if (!stats || report->Get(stats->id())) {
+      return nullptr;
+    }
+    report->AddStats(std::move(stats));
+  }
+  if (!reader.Ok() || !reader.Done()) {
+    return nullptr;
+  }
+  last_report_ = report;
+  return report;
+}
+
+std::unique_ptr<RTCStats> RTCStatsReportDecoder::DecodeStats(
+    Reader& reader,
+    Timestamp report_timestamp) {
+  std::string id = reader.ReadString();
+  bool is_new = reader.ReadVarInt() != 0;
+  if (!reader.Ok()) {
+    return nullptr;
+  }
+  // Stats objects are only ever added to the reports as `DecodedStats`.
+  const DecodedStats* last =
+      !is_new && last_report_
+          ? static_cast<const DecodedStats*>(last_report_->Get(id))
+          : nullptr;
+  std::shared_ptr<const Schema> schema;
+  if (last) {
+    schema = last->schema();
+  } else if (!is_new) {
+    return nullptr;
+  } else {
+    uint64_t schema_index = reader.ReadVarInt();
+    if (!reader.Ok()) {
+      return nullptr;
+    }
+    if (schema_index > 0) {
+      if (schema_index > schemas_.size()) {
+        return nullptr;
+      }
+      schema = schemas_[schema_index - 1];
+    } else {
+      schema = DecodeSchema(reader);
+      if (!schema) {
+        return nullptr;
+      }
+      schemas_.push_back(schema);
+    }
+  }
+  std::optional<Timestamp> timestamp = reader.ReadTimestamp(report_timestamp);
+  size_t num_changed = reader.ReadSize();
+  if (!reader.Ok()) {
+    return nullptr;
+  }
+
+  auto stats = last ? std::make_unique<DecodedStats>(*last)
+                    : std::make_unique<DecodedStats>(id, *timestamp, schema);
+  stats->set_timestamp(*timestamp);
+  for (size_t i = 0; i < num_changed; ++i) {
+    uint64_t field = reader.ReadVarInt();
+    uint64_t index = field >> 1;
+    if (!reader.Ok() || index >= schema->values.size()) {
+      return nullptr;
+    }
+    std::visit(
+        [&](auto& value) {
+          if (!(field & 1)) {
+            value.reset();
+            return;
+          }
+          if (!value.has_value()) {
+            value.emplace();
+          }
+          reader.ReadValue(*value);
+        },
+        stats->value(index));
+  }
+  if (!reader.Ok()) {
+    return nullptr;
+  }
+  return stats;
+}
+
+std::shared_ptr<const RTCStatsReportDecoder::Schema>
+RTCStatsReportDecoder::DecodeSchema(Reader& reader) {
+  auto schema = std::make_shared<Schema>();
+  schema->type = reader.ReadString();
+  size_t num_attributes = reader.ReadSize();
+  for (size_t i = 0; i < num_attributes && reader.Ok(); ++i) {
+    schema->names.push_back(reader.ReadString());
+    std::optional<Value> value = CreateValue(
+        reader.ReadVarInt(), std::make_index_sequence<kNumValueTypes>());
+    if (!value) {
+      reader.Invalidate();
+      break;
+    }
+    schema->values.push_back(*std::move(value));
+  }
+  if (!reader.Ok()) {
+    return nullptr;
+  }
+  return schema;
+}
+
+}  // namespace webrtc
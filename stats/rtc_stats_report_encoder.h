@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef STATS_RTC_STATS_REPORT_ENCODER_H_
+#define STATS_RTC_STATS_REPORT_ENCODER_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/units/timestamp.h"
+
+namespace webrtc {
+
+// Encodes a stream of stats reports, e.g. the reports periodically gathered for
+// a peer connection, into a compact binary format that is an alternative to
+// exporting them as JSON.
+//
+// Each report is encoded as a delta against the previous one: ids, types,
+// attribute names and string values are sent once and are then referred to by
+// index, only the attributes that changed since the previous report are sent,
+// and numeric attributes are sent as varints of the difference to their
+// previous value. The attributes of an object are sent in the order of its
+// `Attributes()`, so its schema, i.e. its type and the names and types of its
+// attributes, is only sent the first time an object with that schema is
+// encoded. Objects of the same type may have different schemas, e.g. the
+// "media-source" stats of audio and video sources.
+//
+// A report can therefore only be decoded by a `RTCStatsReportDecoder` that has
+// decoded all the preceding reports of the same encoder, in order.
+class RTCStatsReportEncoder {
+ public:
+  RTCStatsReportEncoder();
+  ~RTCStatsReportEncoder();
+
+  std::string Encode(scoped_refptr<const RTCStatsReport> report);
+
+ private:
+  class Writer;
+
+  void EncodeStats(const RTCStats& stats,
+                   Timestamp report_timestamp,
+                   Writer& writer);
+
+  std::map<std::string, uint64_t, std::less<>> string_indices_;
+  // Indexed by the type and the attribute names and types of the schema.
+  std::map<std::string, uint64_t> schema_indices_;
+  // The report that the next one is encoded as a delta against.
+  scoped_refptr<const RTCStatsReport> last_report_;
+};
+
+// Decodes a stream of stats reports encoded by `RTCStatsReportEncoder`.
+//
+// The decoded stats objects have the type, id, timestamp and attributes of the
+// encoded ones, but aren't instances of their `RTCStats` subclasses, so they
+// must be read with `Attributes()` or `ToJson()` rather than `cast_to()`.
+class RTCStatsReportDecoder {
+ public:
+  RTCStatsReportDecoder();
+  ~RTCStatsReportDecoder();
+
+  // Returns null if `encoded` is malformed. A stream can't be decoded further
+  // after an error, as the following reports are deltas against the one that
+  // failed to decode.
+  scoped_refptr<const RTCStatsReport> Decode(absl::string_view encoded);
+
+ private:
+  class DecodedStats;
+  class Reader;
+  struct Schema;
+
+  std::unique_ptr<RTCStats> DecodeStats(Reader& reader,
+                                        Timestamp report_timestamp);
+  std::shared_ptr<const Schema> DecodeSchema(Reader& reader);
+
+  std::vector<std::string> strings_;
+  // In the order they were first encoded in.
+  std::vector<std::shared_ptr<const Schema>> schemas_;
+  // The report that the next one is decoded as a delta against.
+  scoped_refptr<const RTCStatsReport> last_report_;
+};
+
+}  // namespace webrtc
+
+#endif  // STATS_RTC_STATS_REPORT_ENCODER_H_
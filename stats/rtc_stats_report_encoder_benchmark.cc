@@ -0,0 +1,145 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/stats/rtcstats_objects.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/random.h"
+#include "stats/rtc_stats_report_encoder.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumReports = 100;
+
+// Creates the reports of a call with `num_streams` video streams in each
+// direction over a single transport, gathered once per second.
+std::vector<scoped_refptr<const RTCStatsReport>> CreateReports(
+    int num_streams) {
+  Random random(42);
+  std::vector<scoped_refptr<const RTCStatsReport>> reports;
+  for (int i = 1; i <= kNumReports; ++i) {
+    const Timestamp timestamp = Timestamp::Seconds(1700000000 + i);
+    scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(timestamp);
+    auto transport = std::make_unique<RTCTransportStats>("T01", timestamp);
+    transport->bytes_sent = i * num_streams * 125000;
+    transport->packets_sent = i * num_streams * 100;
+    transport->bytes_received = i * num_streams * 125000;
+    transport->packets_received = i * num_streams * 100;
+    transport->dtls_state = "connected";
+    transport->selected_candidate_pair_id = "CPabcdefgh_ijklmnop";
+    report->AddStats(std::move(transport));
+    for (int j = 0; j < num_streams; ++j) {
+      auto outbound = std::make_unique<RTCOutboundRtpStreamStats>(
+          absl::StrCat("OT01V", 1000 + j), timestamp);
+      outbound->ssrc = 1000 + j;
+      outbound->kind = "video";
+      outbound->transport_id = "T01";
+      outbound->codec_id = "COT01_96";
+      outbound->mid = absl::StrCat(j);
+      outbound->media_source_id = absl::StrCat("SV", j);
+      outbound->packets_sent = i * 100 + random.Rand(10);
+      outbound->bytes_sent = i * 125000 + random.Rand(1000);
+      outbound->header_bytes_sent = i * 2400 + random.Rand(100);
+      outbound->frames_encoded = i * 30;
+      outbound->frames_sent = i * 30;
+      outbound->total_encode_time = i * 0.15 + random.Rand<double>() / 100;
+      outbound->target_bitrate = 1000000;
+      outbound->frame_width = 1280;
+      outbound->frame_height = 720;
+      outbound->frames_per_second = 30;
+      outbound->quality_limitation_reason = "none";
+      outbound->quality_limitation_durations =
+          std::map<std::string, double>{{"bandwidth", 0},
+                                        {"cpu", 0},
+                                        {"none", i * 1.0},
+                                        {"other", 0}};
+      report->AddStats(std::move(outbound));
+
+      auto inbound = std::make_unique<RTCInboundRtpStreamStats>(
+          absl::StrCat("IT01V", 2000 + j), timestamp);
+      inbound->ssrc = 2000 + j;
+      inbound->kind = "video";
+      inbound->transport_id = "T01";
+      inbound->codec_id = "CIT01_96";
+      inbound->mid = absl::StrCat(j);
+      inbound->jitter = random.Rand<double>() / 100;
+      inbound->packets_lost = random.Rand(5);
+      inbound->packets_received = i * 100 + random.Rand(10);
+      inbound->bytes_received = i * 125000 + random.Rand(1000);
+      inbound->header_bytes_received = i * 2400 + random.Rand(100);
+      inbound->last_packet_received_timestamp =
+          timestamp.ms() - random.Rand(20);
+      inbound->jitter_buffer_delay = i * 1.5 + random.Rand<double>();
+      inbound->jitter_buffer_emitted_count = i * 30;
+      inbound->frames_received = i * 30;
+      inbound->frames_decoded = i * 30;
+      inbound->frame_width = 1280;
+      inbound->frame_height = 720;
+      inbound->frames_per_second = 30;
+      report->AddStats(std::move(inbound));
+    }
+    reports.push_back(report);
+  }
+  return reports;
+}
+
+// Exports consecutive reports of a call as JSON, as e.g. for uploading them to
+// a server.
+void BM_RTCStatsReportToJson(benchmark::State& state) {
+  const std::vector<scoped_refptr<const RTCStatsReport>> reports =
+      CreateReports(state.range(0));
+  size_t bytes = 0;
+  size_t i = 0;
+  for (auto _ : state) {
+    std::string json = reports[i++ % reports.size()]->ToJson();
+    bytes += json.size();
+    benchmark::DoNotOptimize(json);
+  }
+  state.counters["bytes_per_report"] =
+      benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+}
+
+// Exports the same reports with `RTCStatsReportEncoder`, starting a new stream
+// of reports after the last one, so that the average includes the cost of the
+// first report of a stream, which isn't a delta.
+void BM_RTCStatsReportEncode(benchmark::State& state) {
+  const std::vector<scoped_refptr<const RTCStatsReport>> reports =
+      CreateReports(state.range(0));
+  auto encoder = std::make_unique<RTCStatsReportEncoder>();
+  size_t bytes = 0;
+  size_t i = 0;
+  for (auto _ : state) {
+    if (i == reports.size()) {
+      encoder = std::make_unique<RTCStatsReportEncoder>();
+      i = 0;
+    }
+    std::string encoded = encoder->Encode(reports[i++]);
+    bytes += encoded.size();
+    benchmark::DoNotOptimize(encoded);
+  }
+  state.counters["bytes_per_report"] =
+      benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_RTCStatsReportToJson)->ArgName("streams")->Arg(2)->Arg(32);
+BENCHMARK(BM_RTCStatsReportEncode)->ArgName("streams")->Arg(2)->Arg(32);
+
+}  // namespace
+}  // namespace webrtc
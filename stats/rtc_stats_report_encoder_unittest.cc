@@ -0,0 +1,218 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "stats/rtc_stats_report_encoder.h"
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/stats/rtcstats_objects.h"
+#include "api/units/timestamp.h"
+#include "stats/test/rtc_test_stats.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+class RTCOtherTestStats : public RTCStats {
+ public:
+  WEBRTC_RTCSTATS_DECL(RTCOtherTestStats);
+
+  RTCOtherTestStats(const std::string& id, Timestamp timestamp)
+      : RTCStats(id, timestamp) {}
+
+  std::optional<uint32_t> count;
+};
+
+WEBRTC_RTCSTATS_IMPL(RTCOtherTestStats,
+                     RTCStats,
+                     "other-test-stats",
+                     AttributeInit("count", &count))
+
+namespace {
+
+std::unique_ptr<RTCTestStats> CreateTestStats(const std::string& id,
+                                              Timestamp timestamp) {
+  auto stats = std::make_unique<RTCTestStats>(id, timestamp);
+  stats->m_bool = true;
+  stats->m_int32 = -123;
+  stats->m_uint32 = 123;
+  stats->m_int64 = std::numeric_limits<int64_t>::min();
+  stats->m_uint64 = std::numeric_limits<uint64_t>::max();
+  stats->m_double = 0.125;
+  stats->m_string = "string";
+  stats->m_sequence_bool = std::vector<bool>{true, false};
+  stats->m_sequence_int32 = std::vector<int32_t>{3, -2, 1};
+  stats->m_sequence_uint32 = std::vector<uint32_t>{5, 0};
+  stats->m_sequence_int64 = std::vector<int64_t>{
+      std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+  stats->m_sequence_uint64 = std::vector<uint64_t>{7, 8};
+  stats->m_sequence_double = std::vector<double>{1.5, -0.25};
+  stats->m_sequence_string = std::vector<std::string>{"a", "string"};
+  stats->m_map_string_uint64 = std::map<std::string, uint64_t>{{"a", 1}};
+  stats->m_map_string_double =
+      std::map<std::string, double>{{"b", 2.5}, {"c", 1e-9}};
+  return stats;
+}
+
+TEST(RTCStatsReportEncoderTest, EncodesAllAttributeTypes) {
+  scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1000));
+  report->AddStats(CreateTestStats("a", Timestamp::Micros(1000)));
+  report->AddStats(std::make_unique<RTCTestStats>("b", Timestamp::Micros(0)));
+
+  RTCStatsReportEncoder encoder;
+  RTCStatsReportDecoder decoder;
+  scoped_refptr<const RTCStatsReport> decoded =
+      decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+  EXPECT_EQ(decoded->Get("a")->type(), std::string(RTCTestStats::kType));
+}
+
+TEST(RTCStatsReportEncoderTest, EncodesChangesSinceLastReport) {
+  RTCStatsReportEncoder encoder;
+  RTCStatsReportDecoder decoder;
+
+  scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1000));
+  report->AddStats(CreateTestStats("a", Timestamp::Micros(1000)));
+  report->AddStats(CreateTestStats("b", Timestamp::Micros(1000)));
+  scoped_refptr<const RTCStatsReport> decoded =
+      decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+
+  // Change, unset and set attributes, remove "b", and add "c" and an object of
+  // another type.
+  report = RTCStatsReport::Create(Timestamp::Micros(500));
+  std::unique_ptr<RTCTestStats> a =
+      CreateTestStats("a", Timestamp::Micros(400));
+  a->m_int32 = 456;
+  a->m_uint32 = 0;
+  a->m_double = -0.5;
+  a->m_string = "other string";
+  a->m_sequence_int32->push_back(4);
+  a->m_map_string_uint64.reset();
+  report->AddStats(std::move(a));
+  std::unique_ptr<RTCTestStats> c =
+      std::make_unique<RTCTestStats>("c", Timestamp::Micros(500));
+  c->m_int64 = -1;
+  report->AddStats(std::move(c));
+  std::unique_ptr<RTCOtherTestStats> d =
+      std::make_unique<RTCOtherTestStats>("d", Timestamp::Micros(500));
+  d->count = 3;
+  report->AddStats(std::move(d));
+  decoded = decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+
+  // Replace "d" by an object of another type with the same id.
+  report = RTCStatsReport::Create(Timestamp::Micros(1500));
+  report->AddStats(CreateTestStats("a", Timestamp::Micros(1500)));
+  report->AddStats(CreateTestStats("d", Timestamp::Micros(1500)));
+  decoded = decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+}
+
+TEST(RTCStatsReportEncoderTest, EncodesObjectsOfOneTypeWithDifferentSchemas) {
+  RTCStatsReportEncoder encoder;
+  RTCStatsReportDecoder decoder;
+
+  // Both are "media-source" stats, with different attributes.
+  scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1000));
+  auto audio = std::make_unique<RTCAudioSourceStats>("audio",
+                                                     Timestamp::Micros(1000));
+  audio->kind = "audio";
+  audio->audio_level = 0.5;
+  audio->total_audio_energy = 2.25;
+  report->AddStats(std::move(audio));
+  auto video = std::make_unique<RTCVideoSourceStats>("video",
+                                                     Timestamp::Micros(1000));
+  video->kind = "video";
+  video->width = 640;
+  video->height = 480;
+  video->frames_per_second = 30.0;
+  report->AddStats(std::move(video));
+  scoped_refptr<const RTCStatsReport> decoded =
+      decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+
+  // Swap the ids, so that each object is a new object with a schema that was
+  // written before, and add another video source.
+  report = RTCStatsReport::Create(Timestamp::Micros(2000));
+  audio = std::make_unique<RTCAudioSourceStats>("video",
+                                                Timestamp::Micros(2000));
+  audio->audio_level = 0.25;
+  report->AddStats(std::move(audio));
+  video = std::make_unique<RTCVideoSourceStats>("audio",
+                                                Timestamp::Micros(2000));
+  video->frames = 60;
+  report->AddStats(std::move(video));
+  video = std::make_unique<RTCVideoSourceStats>("video2",
+                                                Timestamp::Micros(2000));
+  video->width = 1280;
+  report->AddStats(std::move(video));
+  decoded = decoder.Decode(encoder.Encode(report));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->ToJson(), report->ToJson());
+}
+
+TEST(RTCStatsReportEncoderTest, EncodesUnchangedReportsCompactly) {
+  auto create_report = [](Timestamp timestamp) {
+    scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(timestamp);
+    for (int i = 0; i < 10; ++i) {
+      report->AddStats(CreateTestStats(std::to_string(i), timestamp));
+    }
+    return report;
+  };
+  RTCStatsReportEncoder encoder;
+  scoped_refptr<RTCStatsReport> report =
+      create_report(Timestamp::Micros(1000));
+  EXPECT_LT(encoder.Encode(report).size(), report->ToJson().size());
+
+  report = create_report(Timestamp::Micros(2000));
+  // Each object takes a byte for its id, whether it is new, its timestamp and
+  // the number of changed attributes.
+  EXPECT_LE(encoder.Encode(report).size(), 4 * report->size() + 3);
+}
+
+TEST(RTCStatsReportEncoderTest, FailsToDecodeMalformedReports) {
+  RTCStatsReportEncoder encoder;
+  scoped_refptr<RTCStatsReport> report =
+      RTCStatsReport::Create(Timestamp::Micros(1000));
+  report->AddStats(CreateTestStats("a", Timestamp::Micros(1000)));
+  std::string first = encoder.Encode(report);
+  std::string second = encoder.Encode(report);
+
+  EXPECT_FALSE(RTCStatsReportDecoder().Decode(""));
+  EXPECT_FALSE(RTCStatsReportDecoder().Decode(first.substr(0, 30)));
+  EXPECT_FALSE(RTCStatsReportDecoder().Decode(first + "x"));
+  // Deltas can't be decoded without the reports before them.
+  EXPECT_FALSE(RTCStatsReportDecoder().Decode(second));
+
+  RTCStatsReportDecoder decoder;
+  EXPECT_TRUE(decoder.Decode(first));
+  EXPECT_TRUE(decoder.Decode(second));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,260 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/async_encoder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/fec_controller_override.h"
+#include "api/function_view.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/units/timestamp.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_type.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_encoder.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/experiments/field_trial_parser.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/clock.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+namespace {
+
+constexpr char kAsyncEncodeFieldTrial[] = "WebRTC-Video-AsyncEncode";
+// One frame being encoded and one waiting, so that the encoder doesn't idle
+// waiting for the caller while the next frame is already available.
+constexpr int kDefaultMaxFramesInFlight = 2;
+
+class AsyncEncoder : public VideoEncoder {
+ public:
+  AsyncEncoder(std::unique_ptr<VideoEncoder> wrapped,
+               const Environment& env,
+               VideoStreamEncoderObserver* observer,
+               int max_frames_in_flight)
+      : clock_(env.clock()),
+        observer_(observer),
+        max_frames_in_flight_(max_frames_in_flight),
+        wrapped_(std::move(wrapped)),
+        encoder_info_(wrapped_->GetEncoderInfo()),
+        worker_(env.task_queue_factory().CreateTaskQueue(
+            "AsyncEncoder",
+            TaskQueueFactory::Priority::NORMAL)) {}
+
+  // VideoEncoder overloads.
+  void SetFecControllerOverride(
+      FecControllerOverride* fec_controller_override) override {
+    worker_->PostTask([this, fec_controller_override] {
+      wrapped_->SetFecControllerOverride(fec_controller_override);
+    });
+  }
+  int InitEncode(const VideoCodec* codec_settings,
+                 const VideoEncoder::Settings& settings) override {
+    RTC_DCHECK_RUN_ON(&caller_sequence_);
+    int result = WEBRTC_VIDEO_CODEC_OK;
+    RunOnWorkerAndWait([&] {
+      result = wrapped_->InitEncode(codec_settings, settings);
+      UpdateEncoderInfo();
+    });
+    ResetPendingState();
+    return result;
+  }
+  int32_t RegisterEncodeCompleteCallback(
+      EncodedImageCallback* callback) override {
+    RTC_DCHECK_RUN_ON(&caller_sequence_);
+    callback_ = callback;
+    int32_t result = WEBRTC_VIDEO_CODEC_OK;
+    RunOnWorkerAndWait(
+        [&] { result = wrapped_->RegisterEncodeCompleteCallback(callback); });
+    return result;
+  }
+  int32_t Release() override {
+    RTC_DCHECK_RUN_ON(&caller_sequence_);
+    int32_t result = WEBRTC_VIDEO_CODEC_OK;
+    RunOnWorkerAndWait([&] {
+      result = wrapped_->Release();
+      UpdateEncoderInfo();
+    });
+    ResetPendingState();
+    return result;
+  }
+  int32_t Encode(const VideoFrame& frame,
+                 const std::vector<VideoFrameType>* frame_types) override {
+    RTC_DCHECK_RUN_ON(&caller_sequence_);
+    std::vector<VideoFrameType> types;
+    if (frame_types) {
+      types = *frame_types;
+    }
+    // Key frames requested along with frames that were dropped must still be
+    // produced.
+    for (size_t i = 0; i < types.size() && i < pending_key_frames_.size();
+         ++i) {
+      if (pending_key_frames_[i]) {
+        types[i] = VideoFrameType::kVideoFrameKey;
+      }
+    }
+
+    bool drop = false;
+    {
+      MutexLock lock(&mutex_);
+      if (async_error_ != WEBRTC_VIDEO_CODEC_OK) {
+        // Report the failure of an earlier frame, so that the caller can e.g.
+        // fall back to another encoder.
+        int32_t error = async_error_;
+        async_error_ = WEBRTC_VIDEO_CODEC_OK;
+        return error;
+      }
+      drop = frames_in_flight_ >= max_frames_in_flight_;
+      if (!drop) {
+        ++frames_in_flight_;
+      }
+    }
+
+    if (drop) {
+      pending_key_frames_.resize(types.size(), false);
+      for (size_t i = 0; i < types.size(); ++i) {
+        pending_key_frames_[i] = pending_key_frames_[i] ||
+                                 types[i] == VideoFrameType::kVideoFrameKey;
+      }
+      if (callback_) {
+        callback_->OnDroppedFrame(
+            EncodedImageCallback::DropReason::kDroppedByEncoder);
+      }
+      return WEBRTC_VIDEO_CODEC_OK;
+    }
+    pending_key_frames_.clear();
+
+    worker_->PostTask([this, frame, types = std::move(types),
+                       has_types = frame_types != nullptr,
+                       queued_at = clock_.CurrentTime()] {
+      RTC_DCHECK_RUN_ON(worker_.get());
+      observer_->OnEncodeQueueingDelayMeasured(clock_.CurrentTime() -
+                                               queued_at);
+      int32_t result = wrapped_->Encode(frame, has_types ? &types : nullptr);
+      EncoderInfo info = wrapped_->GetEncoderInfo();
+      MutexLock lock(&mutex_);
+      --frames_in_flight_;
+      if (result < 0) {
+        RTC_LOG(LS_WARNING) << "Asynchronous encode failed: " << result;
+        async_error_ = result;
+      }
+      encoder_info_ = std::move(info);
+    });
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+  void SetRates(const RateControlParameters& parameters) override {
+    worker_->PostTask([this, parameters] {
+      RTC_DCHECK_RUN_ON(worker_.get());
+      wrapped_->SetRates(parameters);
+      UpdateEncoderInfo();
+    });
+  }
+  void OnPacketLossRateUpdate(float packet_loss_rate) override {
+    worker_->PostTask([this, packet_loss_rate] {
+      wrapped_->OnPacketLossRateUpdate(packet_loss_rate);
+    });
+  }
+  void OnRttUpdate(int64_t rtt_ms) override {
+    worker_->PostTask([this, rtt_ms] { wrapped_->OnRttUpdate(rtt_ms); });
+  }
+  void OnLossNotification(const LossNotification& loss_notification) override {
+    worker_->PostTask([this, loss_notification] {
+      wrapped_->OnLossNotification(loss_notification);
+    });
+  }
+  // Returns the info of the wrapped encoder as of the last call that
+  // completed on the worker, since it may not be queried concurrently with
+  // other calls.
+  EncoderInfo GetEncoderInfo() const override {
+    MutexLock lock(&mutex_);
+    return encoder_info_;
+  }
+
+ private:
+  void RunOnWorkerAndWait(FunctionView<void()> task) {
+    Event done;
+    worker_->PostTask([&] {
+      task();
+      done.Set();
+    });
+    done.Wait(Event::kForever);
+  }
+
+  void UpdateEncoderInfo() {
+    RTC_DCHECK_RUN_ON(worker_.get());
+    EncoderInfo info = wrapped_->GetEncoderInfo();
+    MutexLock lock(&mutex_);
+    encoder_info_ = std::move(info);
+  }
+
+  // Called after a blocking call, when no frames are in flight.
+  void ResetPendingState() {
+    RTC_DCHECK_RUN_ON(&caller_sequence_);
+    pending_key_frames_.clear();
+    MutexLock lock(&mutex_);
+    RTC_DCHECK_EQ(frames_in_flight_, 0);
+    async_error_ = WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  Clock& clock_;
+  VideoStreamEncoderObserver* const observer_;
+  const int max_frames_in_flight_;
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker caller_sequence_{
+      SequenceChecker::kDetached};
+  EncodedImageCallback* callback_ RTC_GUARDED_BY(caller_sequence_) = nullptr;
+  std::vector<bool> pending_key_frames_ RTC_GUARDED_BY(caller_sequence_);
+  // Only called on `worker_` after construction.
+  const std::unique_ptr<VideoEncoder> wrapped_;
+  mutable Mutex mutex_;
+  int frames_in_flight_ RTC_GUARDED_BY(mutex_) = 0;
+  int32_t async_error_ RTC_GUARDED_BY(mutex_) = WEBRTC_VIDEO_CODEC_OK;
+  EncoderInfo encoder_info_ RTC_GUARDED_BY(mutex_);
+  // Declared last so that it is destroyed first, which waits for a running
+  // task and discards pending ones before `wrapped_` is destroyed.
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> worker_;
+};
+
+}  // namespace
+
+std::unique_ptr<VideoEncoder> MaybeCreateAsyncEncoderWrapper(
+    std::unique_ptr<VideoEncoder> encoder,
+    const Environment& env,
+    VideoStreamEncoderObserver* observer) {
+  if (!encoder || !env.field_trials().IsEnabled(kAsyncEncodeFieldTrial)) {
+    return encoder;
+  }
+  FieldTrialParameter<int> max_in_flight("max_in_flight",
+                                         kDefaultMaxFramesInFlight);
+  ParseFieldTrial({&max_in_flight},
+                  env.field_trials().Lookup(kAsyncEncodeFieldTrial));
+  int max_frames_in_flight = max_in_flight.Get();
+  if (max_frames_in_flight < 1) {
+    RTC_LOG(LS_WARNING) << "Invalid max_in_flight " << max_frames_in_flight
+                        << ", using " << kDefaultMaxFramesInFlight;
+    max_frames_in_flight = kDefaultMaxFramesInFlight;
+  }
+  return std::make_unique<AsyncEncoder>(std::move(encoder), env, observer,
+                                        max_frames_in_flight);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_ASYNC_ENCODER_H_
+#define VIDEO_ASYNC_ENCODER_H_
+
+#include <memory>
+
+#include "api/environment/environment.h"
+#include "api/video_codecs/video_encoder.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+
+// Creates an encoder that wraps another passed encoder and runs all calls into
+// it on a dedicated task queue, so that the caller, e.g. the encoder queue of
+// VideoStreamEncoder, doesn't block while a frame is being encoded and stays
+// responsive to rate updates and adaptation. Encode() returns as soon as the
+// frame is queued. At most "max_in_flight" frames of the
+// "WebRTC-Video-AsyncEncode" field trial may be queued or being encoded;
+// further frames are dropped, and reported as dropped by the encoder, until
+// one completes. The time that frames spend queued is reported to `observer`.
+// If the passed encoder is nullptr, or the field trial is not enabled, the
+// function just returns the passed encoder.
+std::unique_ptr<VideoEncoder> MaybeCreateAsyncEncoderWrapper(
+    std::unique_ptr<VideoEncoder> encoder,
+    const Environment& env,
+    VideoStreamEncoderObserver* observer);
+
+}  // namespace webrtc
+
+#endif  // VIDEO_ASYNC_ENCODER_H_
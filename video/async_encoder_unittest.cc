@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/async_encoder.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/test/mock_video_encoder.h"
+#include "api/units/time_delta.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_type.h"
+#include "api/video_codecs/video_encoder.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/event.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/scoped_key_value_config.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Pointee;
+using ::testing::Return;
+
+constexpr TimeDelta kTimeout = TimeDelta::Seconds(5);
+
+class QueueingDelayObserver : public VideoStreamEncoderObserver {
+ public:
+  void OnEncodedFrameTimeMeasured(int, int) override {}
+  void OnIncomingFrame(int, int) override {}
+  void OnSendEncodedImage(const EncodedImage&,
+                          const CodecSpecificInfo*) override {}
+  void OnEncoderImplementationChanged(EncoderImplementation) override {}
+  void OnFrameDropped(DropReason) override {}
+  void OnEncoderReconfigured(const VideoEncoderConfig&,
+                             const std::vector<VideoStream>&) override {}
+  void OnAdaptationChanged(VideoAdaptationReason,
+                           const VideoAdaptationCounters&,
+                           const VideoAdaptationCounters&) override {}
+  void ClearAdaptationStats() override {}
+  void UpdateAdaptationSettings(AdaptationSettings,
+                                AdaptationSettings) override {}
+  void OnMinPixelLimitReached() override {}
+  void OnInitialQualityResolutionAdaptDown() override {}
+  void OnSuspendChange(bool) override {}
+  int GetInputFrameRate() const override { return 0; }
+
+  void OnEncodeQueueingDelayMeasured(TimeDelta) override { ++num_measured; }
+
+  std::atomic<int> num_measured = 0;
+};
+
+VideoFrame CreateFrame() {
+  return VideoFrame::Builder()
+      .set_video_frame_buffer(I420Buffer::Create(16, 16))
+      .build();
+}
+
+class AsyncEncoderTest : public ::testing::Test {
+ protected:
+  AsyncEncoderTest()
+      : field_trials_("WebRTC-Video-AsyncEncode/Enabled/"),
+        env_(CreateEnvironment(&field_trials_)) {
+    auto mock_encoder = std::make_unique<MockVideoEncoder>();
+    mock_encoder_ = mock_encoder.get();
+    encoder_ = MaybeCreateAsyncEncoderWrapper(std::move(mock_encoder), env_,
+                                              &observer_);
+    encoder_->RegisterEncodeCompleteCallback(&callback_);
+  }
+
+  test::ScopedKeyValueConfig field_trials_;
+  const Environment env_;
+  QueueingDelayObserver observer_;
+  MockEncodedImageCallback callback_;
+  MockVideoEncoder* mock_encoder_;
+  std::unique_ptr<VideoEncoder> encoder_;
+};
+
+TEST(AsyncEncoderFieldTrialTest, ReturnsPassedEncoderByDefault) {
+  test::ScopedKeyValueConfig field_trials;
+  QueueingDelayObserver observer;
+  auto mock_encoder = std::make_unique<MockVideoEncoder>();
+  VideoEncoder* mock_encoder_ptr = mock_encoder.get();
+  std::unique_ptr<VideoEncoder> encoder = MaybeCreateAsyncEncoderWrapper(
+      std::move(mock_encoder), CreateEnvironment(&field_trials), &observer);
+  EXPECT_EQ(encoder.get(), mock_encoder_ptr);
+}
+
+TEST_F(AsyncEncoderTest, EncodeDoesNotWaitForWrappedEncoder) {
+  Event encode_started;
+  Event finish_encode;
+  EXPECT_CALL(*mock_encoder_, Encode).WillOnce([&] {
+    encode_started.Set();
+    finish_encode.Wait(kTimeout);
+    return WEBRTC_VIDEO_CODEC_OK;
+  });
+  std::vector<VideoFrameType> frame_types = {VideoFrameType::kVideoFrameKey};
+  EXPECT_EQ(encoder_->Encode(CreateFrame(), &frame_types),
+            WEBRTC_VIDEO_CODEC_OK);
+
+  // Other calls are queued behind the encode without blocking.
+  EXPECT_CALL(*mock_encoder_, OnRttUpdate(100));
+  encoder_->OnRttUpdate(100);
+  EXPECT_TRUE(encode_started.Wait(kTimeout));
+
+  finish_encode.Set();
+  // Release() waits for all queued calls.
+  encoder_->Release();
+  EXPECT_EQ(observer_.num_measured, 1);
+}
+
+TEST_F(AsyncEncoderTest, DropsFramesAboveMaxInFlightAndKeepsKeyFrameRequest) {
+  Event finish_encode(/*manual_reset=*/true, /*initially_signaled=*/false);
+  std::vector<VideoFrameType> key = {VideoFrameType::kVideoFrameKey};
+  std::vector<VideoFrameType> delta = {VideoFrameType::kVideoFrameDelta};
+  EXPECT_CALL(*mock_encoder_, Encode(_, Pointee(ElementsAre(
+                                            VideoFrameType::kVideoFrameDelta))))
+      .Times(2)
+      .WillRepeatedly([&] {
+        finish_encode.Wait(kTimeout);
+        return WEBRTC_VIDEO_CODEC_OK;
+      });
+  EXPECT_CALL(callback_, OnDroppedFrame(EncodedImageCallback::DropReason::
+                                            kDroppedByEncoder));
+  // The default depth is two frames; the third is dropped, along with its key
+  // frame request.
+  encoder_->Encode(CreateFrame(), &delta);
+  encoder_->Encode(CreateFrame(), &delta);
+  encoder_->Encode(CreateFrame(), &key);
+
+  finish_encode.Set();
+  Event idle;
+  EXPECT_CALL(*mock_encoder_, SetRates).WillOnce([&] { idle.Set(); });
+  encoder_->SetRates(VideoEncoder::RateControlParameters());
+  ASSERT_TRUE(idle.Wait(kTimeout));
+
+  // The key frame request is applied to the next frame that is encoded.
+  EXPECT_CALL(*mock_encoder_, Encode(_, Pointee(ElementsAre(
+                                            VideoFrameType::kVideoFrameKey))))
+      .WillOnce(Return(WEBRTC_VIDEO_CODEC_OK));
+  encoder_->Encode(CreateFrame(), &delta);
+  encoder_->Release();
+}
+
+TEST_F(AsyncEncoderTest, ReportsEncodeFailureOnNextEncode) {
+  std::vector<VideoFrameType> delta = {VideoFrameType::kVideoFrameDelta};
+  EXPECT_CALL(*mock_encoder_, Encode)
+      .WillOnce(Return(WEBRTC_VIDEO_CODEC_ENCODER_FAILURE));
+  EXPECT_EQ(encoder_->Encode(CreateFrame(), &delta), WEBRTC_VIDEO_CODEC_OK);
+
+  // Wait for the worker to run the task following the encode.
+  Event idle;
+  EXPECT_CALL(*mock_encoder_, SetRates).WillOnce([&] { idle.Set(); });
+  encoder_->SetRates(VideoEncoder::RateControlParameters());
+  ASSERT_TRUE(idle.Wait(kTimeout));
+
+  EXPECT_EQ(encoder_->Encode(CreateFrame(), &delta),
+            WEBRTC_VIDEO_CODEC_ENCODER_FAILURE);
+}
+
+TEST_F(AsyncEncoderTest, CachesEncoderInfo) {
+  VideoEncoder::EncoderInfo info;
+  info.implementation_name = "Mock";
+  EXPECT_CALL(*mock_encoder_, Release).WillOnce(Return(WEBRTC_VIDEO_CODEC_OK));
+  EXPECT_CALL(*mock_encoder_, GetEncoderInfo).WillOnce(Return(info));
+  encoder_->Release();
+
+  // Queried without calling into the wrapped encoder.
+  EXPECT_EQ(encoder_->GetEncoderInfo().implementation_name, "Mock");
+  EXPECT_EQ(encoder_->GetEncoderInfo().implementation_name, "Mock");
+}
+
+}  // namespace
+}  // namespace webrtc
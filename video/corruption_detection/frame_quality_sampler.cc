@@ -0,0 +1,66 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/corruption_detection/frame_quality_sampler.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/frame_quality_metrics.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "video/corruption_detection/halton_frame_sampler.h"
+
+namespace webrtc {
+
+FrameQualitySampler::FrameQualitySampler(int num_samples)
+    : num_samples_(num_samples) {
+  RTC_DCHECK_GE(num_samples_, 1);
+}
+
+std::optional<FrameQuality> FrameQualitySampler::OnFrame(
+    scoped_refptr<VideoFrameBuffer> reference,
+    scoped_refptr<VideoFrameBuffer> test,
+    bool is_key_frame,
+    uint32_t rtp_timestamp) {
+  std::vector<HaltonFrameSampler::Coordinates> coordinates =
+      frame_sampler_.GetSampleCoordinatesForFrameIfFrameShouldBeSampled(
+          is_key_frame, rtp_timestamp, num_samples_);
+  if (coordinates.empty()) {
+    return std::nullopt;
+  }
+
+  scoped_refptr<I420BufferInterface> reference_i420 = reference->ToI420();
+  scoped_refptr<I420BufferInterface> test_i420 = test->ToI420();
+  if (!reference_i420 || !test_i420) {
+    RTC_LOG(LS_WARNING) << "Failed to convert frames to I420.";
+    return std::nullopt;
+  }
+  if (reference_i420->width() != test_i420->width() ||
+      reference_i420->height() != test_i420->height()) {
+    scoped_refptr<I420Buffer> scaled_test =
+        I420Buffer::Create(reference_i420->width(), reference_i420->height());
+    scaled_test->ScaleFrom(*test_i420);
+    test_i420 = scaled_test;
+  }
+
+  std::vector<QualitySamplePosition> positions;
+  positions.reserve(coordinates.size());
+  for (const HaltonFrameSampler::Coordinates& coordinate : coordinates) {
+    positions.push_back({.row = coordinate.row, .column = coordinate.column});
+  }
+  return ComputeSampledFrameQuality(*reference_i420, *test_i420, positions);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_CORRUPTION_DETECTION_FRAME_QUALITY_SAMPLER_H_
+#define VIDEO_CORRUPTION_DETECTION_FRAME_QUALITY_SAMPLER_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/frame_quality_metrics.h"
+#include "video/corruption_detection/halton_frame_sampler.h"
+
+namespace webrtc {
+
+// Computes the quality of a subset of frames, for monitoring e.g. encoder
+// output against its input outside of tests. Frames are selected by a
+// HaltonFrameSampler, i.e. every key frame and at least once per second, and
+// their quality is computed over `num_samples` blocks centered on points of
+// the Halton sequence. Over time the blocks cover the whole frame, while the
+// cost of a sampled frame is bounded and independent of the resolution.
+class FrameQualitySampler {
+ public:
+  static constexpr int kDefaultNumSamples = 64;
+
+  explicit FrameQualitySampler(int num_samples = kDefaultNumSamples);
+
+  // Returns the quality of `test` compared to `reference` if this frame is
+  // sampled, and nullopt otherwise. `test` is scaled to the resolution of
+  // `reference` if they differ. `rtp_timestamp` must differ between calls.
+  std::optional<FrameQuality> OnFrame(scoped_refptr<VideoFrameBuffer> reference,
+                                      scoped_refptr<VideoFrameBuffer> test,
+                                      bool is_key_frame,
+                                      uint32_t rtp_timestamp);
+
+ private:
+  const int num_samples_;
+  HaltonFrameSampler frame_sampler_;
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_CORRUPTION_DETECTION_FRAME_QUALITY_SAMPLER_H_
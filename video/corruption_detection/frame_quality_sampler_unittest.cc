@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/corruption_detection/frame_quality_sampler.h"
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "common_video/frame_quality_metrics.h"
+#include "common_video/libyuv/include/webrtc_libyuv.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kRtpTimestampStep = 3000;
+
+scoped_refptr<I420Buffer> CreateFilledBuffer(int width,
+                                             int height,
+                                             uint8_t value) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  memset(buffer->MutableDataY(), value, buffer->StrideY() * height);
+  memset(buffer->MutableDataU(), 128,
+         buffer->StrideU() * buffer->ChromaHeight());
+  memset(buffer->MutableDataV(), 128,
+         buffer->StrideV() * buffer->ChromaHeight());
+  return buffer;
+}
+
+TEST(FrameQualitySamplerTest, SamplesFirstFrameAndKeyFrames) {
+  FrameQualitySampler sampler;
+  scoped_refptr<I420Buffer> buffer = CreateFilledBuffer(320, 180, 100);
+  uint32_t rtp_timestamp = 0;
+
+  std::optional<FrameQuality> quality =
+      sampler.OnFrame(buffer, buffer, /*is_key_frame=*/false, rtp_timestamp);
+  ASSERT_TRUE(quality);
+  EXPECT_EQ(quality->psnr, kPerfectPSNR);
+  EXPECT_DOUBLE_EQ(quality->ssim, 1.0);
+
+  rtp_timestamp += kRtpTimestampStep;
+  EXPECT_FALSE(
+      sampler.OnFrame(buffer, buffer, /*is_key_frame=*/false, rtp_timestamp));
+  rtp_timestamp += kRtpTimestampStep;
+  EXPECT_TRUE(
+      sampler.OnFrame(buffer, buffer, /*is_key_frame=*/true, rtp_timestamp));
+}
+
+TEST(FrameQualitySamplerTest, SamplesAtLeastOncePerSecond) {
+  FrameQualitySampler sampler;
+  scoped_refptr<I420Buffer> buffer = CreateFilledBuffer(320, 180, 100);
+  int num_sampled = 0;
+  // Two seconds at 30 fps.
+  for (uint32_t rtp_timestamp = 0; rtp_timestamp < 2 * 90'000;
+       rtp_timestamp += kRtpTimestampStep) {
+    if (sampler.OnFrame(buffer, buffer, /*is_key_frame=*/false,
+                        rtp_timestamp)) {
+      ++num_sampled;
+    }
+  }
+  EXPECT_GE(num_sampled, 2);
+  EXPECT_LE(num_sampled, 4);
+}
+
+TEST(FrameQualitySamplerTest, ScalesTestFrameToReferenceResolution) {
+  FrameQualitySampler sampler;
+  std::optional<FrameQuality> quality = sampler.OnFrame(
+      CreateFilledBuffer(320, 180, 100), CreateFilledBuffer(160, 90, 110),
+      /*is_key_frame=*/true, /*rtp_timestamp=*/0);
+  ASSERT_TRUE(quality);
+  EXPECT_LT(quality->psnr, kPerfectPSNR);
+}
+
+}  // namespace
+}  // namespace webrtc
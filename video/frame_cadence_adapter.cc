@@ -41,10 +41,17 @@
 #include "system_wrappers/include/clock.h"
 #include "system_wrappers/include/metrics.h"
 #include "system_wrappers/include/ntp_time.h"
+#include "video/frame_change_detector.h"
 
 namespace webrtc {
 namespace {
 
+// In content aware mode, the number of consecutive unchanged frames that are
+// still passed on before unchanged frames start being skipped. Matches the
+// number of frames after which libvpx encoders consider the content to be in
+// steady state.
+constexpr int kStaticFramesBeforeSkipping = 3;
+
 // Abstracts concrete modes of the cadence adapter.
 class AdapterMode {
  public:
@@ -382,6 +389,11 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
   // - zero-hertz mode enabled
   bool IsZeroHertzScreenshareEnabled() const RTC_RUN_ON(queue_);
 
+  // In content aware mode, sets the update rect of `frame` if the source
+  // didn't, and returns true if `frame` is unchanged and should be skipped.
+  bool AnnotateAndMaybeSkipFrame(Timestamp post_time, VideoFrame& frame)
+      RTC_RUN_ON(queue_);
+
   // Configures current adapter on non-ZeroHertz mode, called when Initialize or
   // MaybeReconfigureAdapters.
   void ConfigureCurrentAdapterWithoutZeroHertz();
@@ -398,6 +410,19 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
   // Field trial for using timestamp from video frames, rather than clock when
   // calculating input frame rate.
   const bool use_video_frame_timestamp_;
+  // Field trial for content aware mode: update rects are computed for frames
+  // from sources that don't provide them, so that encoders can treat static
+  // content as such, and unchanged frames are skipped outside of zero-hertz
+  // mode once the encoder has seen a few of them.
+  const bool content_aware_;
+  FrameChangeDetector change_detector_ RTC_GUARDED_BY(queue_);
+  // Number of consecutive unchanged frames passed on to the adapter mode.
+  int static_frames_forwarded_ RTC_GUARDED_BY(queue_) = 0;
+  std::optional<Timestamp> last_forwarded_frame_time_ RTC_GUARDED_BY(queue_);
+  // Number of frames seen in content aware mode, and how many of them were
+  // skipped as unchanged.
+  int64_t num_content_aware_frames_ = 0;
+  int64_t num_static_frames_skipped_ = 0;
   // Used for verifying that timestamps are monotonically increasing.
   std::optional<Timestamp> last_incoming_frame_timestamp_;
   bool incoming_frame_timestamp_monotonically_increasing_ = true;
@@ -869,6 +894,8 @@ FrameCadenceAdapterImpl::FrameCadenceAdapterImpl(
           !field_trials.IsDisabled("WebRTC-ZeroHertzQueueOverload")),
       use_video_frame_timestamp_(field_trials.IsEnabled(
           "WebRTC-FrameCadenceAdapter-UseVideoFrameTimestamp")),
+      content_aware_(
+          field_trials.IsEnabled("WebRTC-FrameCadenceAdapter-ContentAware")),
       metronome_(metronome),
       worker_queue_(worker_queue) {}
 
@@ -886,6 +913,12 @@ FrameCadenceAdapterImpl::~FrameCadenceAdapterImpl() {
   RTC_HISTOGRAM_BOOLEAN(
       "WebRTC.Video.InputFrameTimestampMonotonicallyIncreasing",
       incoming_frame_timestamp_monotonically_increasing_);
+  if (num_content_aware_frames_ > 0) {
+    RTC_HISTOGRAM_PERCENTAGE(
+        "WebRTC.Video.FrameCadenceAdapter.StaticFramesSkippedPercent",
+        static_cast<int>(num_static_frames_skipped_ * 100 /
+                         num_content_aware_frames_));
+  }
 }
 
 void FrameCadenceAdapterImpl::Initialize(Callback* callback) {
@@ -1015,7 +1048,20 @@ void FrameCadenceAdapterImpl::OnFrameOnMainQueue(Timestamp post_time,
                                                  bool queue_overload,
                                                  const VideoFrame& frame) {
   RTC_DCHECK_RUN_ON(queue_);
-  current_adapter_mode_->OnFrame(post_time, queue_overload, frame);
+  if (content_aware_) {
+    VideoFrame annotated_frame = frame;
+    ++num_content_aware_frames_;
+    if (!AnnotateAndMaybeSkipFrame(post_time, annotated_frame)) {
+      current_adapter_mode_->OnFrame(post_time, queue_overload,
+                                     annotated_frame);
+    } else {
+      // Not reported as discarded: the source delivered the frame, and the
+      // encoder already has its content.
+      ++num_static_frames_skipped_;
+    }
+  } else {
+    current_adapter_mode_->OnFrame(post_time, queue_overload, frame);
+  }
   if (last_incoming_frame_timestamp_ &&
       last_incoming_frame_timestamp_ >=
           Timestamp::Micros(frame.timestamp_us())) {
@@ -1031,6 +1077,40 @@ void FrameCadenceAdapterImpl::OnFrameOnMainQueue(Timestamp post_time,
   UpdateFrameRate(update_frame_rate_timestamp);
 }
 
+bool FrameCadenceAdapterImpl::AnnotateAndMaybeSkipFrame(Timestamp post_time,
+                                                        VideoFrame& frame) {
+  RTC_DCHECK_RUN_ON(queue_);
+  if (frame.has_update_rect()) {
+    // The source knows best. The detector didn't see this frame though, so
+    // its state can't be used for the next one.
+    change_detector_.Reset();
+  } else if (std::optional<VideoFrame::UpdateRect> update_rect =
+                 change_detector_.DetectChanges(*frame.video_frame_buffer())) {
+    frame.set_update_rect(*update_rect);
+  }
+
+  if (!frame.has_update_rect() || !frame.update_rect().IsEmpty()) {
+    static_frames_forwarded_ = 0;
+    last_forwarded_frame_time_ = post_time;
+    return false;
+  }
+  // The zero-hertz adapter has its own logic for repeating unchanged content
+  // until quality has converged. Otherwise, let a few unchanged frames through
+  // so that the encoder can refine quality, and then only one per idle repeat
+  // period to keep the stream alive.
+  if (zero_hertz_adapter_.has_value() ||
+      static_frames_forwarded_ < kStaticFramesBeforeSkipping ||
+      !last_forwarded_frame_time_ ||
+      post_time - *last_forwarded_frame_time_ >=
+          kZeroHertzIdleRepeatRatePeriod) {
+    ++static_frames_forwarded_;
+    last_forwarded_frame_time_ = post_time;
+    return false;
+  }
+  TRACE_EVENT0("webrtc", "FrameCadenceAdapterImpl::SkipStaticFrame");
+  return true;
+}
+
 bool FrameCadenceAdapterImpl::IsZeroHertzScreenshareEnabled() const {
   RTC_DCHECK_RUN_ON(queue_);
   return source_constraints_.has_value() &&
@@ -11,6 +11,7 @@
 #include "video/frame_cadence_adapter.h"
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -675,6 +676,93 @@ TEST(FrameCadenceAdapterTest, ShutdownUnderMetronome) {
   time_controller.AdvanceTime(TimeDelta::Millis(100));
 }
 
+scoped_refptr<NV12Buffer> CreateBufferWithContent(uint8_t value) {
+  scoped_refptr<NV12Buffer> buffer =
+      NV12Buffer::Create(/*width=*/64, /*height=*/64);
+  memset(buffer->MutableDataY(), value, buffer->StrideY() * buffer->height());
+  memset(buffer->MutableDataUV(), 128,
+         buffer->StrideUV() * buffer->ChromaHeight());
+  return buffer;
+}
+
+VideoFrame CreateFrameWithContent(uint8_t value) {
+  return VideoFrame::Builder()
+      .set_video_frame_buffer(CreateBufferWithContent(value))
+      .build();
+}
+
+TEST(FrameCadenceAdapterTest, ContentAwareModeSetsUpdateRect) {
+  test::ScopedKeyValueConfig field_trials(
+      "WebRTC-FrameCadenceAdapter-ContentAware/Enabled/");
+  GlobalSimulatedTimeController time_controller(Timestamp::Zero());
+  auto adapter = CreateAdapter(field_trials, time_controller.GetClock());
+  MockCallback callback;
+  adapter->Initialize(&callback);
+
+  std::vector<VideoFrame::UpdateRect> update_rects;
+  EXPECT_CALL(callback, OnFrame)
+      .WillRepeatedly([&](Timestamp, bool, const VideoFrame& frame) {
+        update_rects.push_back(frame.update_rect());
+      });
+  adapter->OnFrame(CreateFrameWithContent(0));
+  time_controller.AdvanceTime(TimeDelta::Millis(33));
+  adapter->OnFrame(CreateFrameWithContent(0));
+  time_controller.AdvanceTime(TimeDelta::Millis(33));
+  // Change a pixel in the bottom right block.
+  scoped_refptr<NV12Buffer> changed_buffer = CreateBufferWithContent(0);
+  changed_buffer->MutableDataY()[40 * changed_buffer->StrideY() + 40] = 1;
+  adapter->OnFrame(
+      VideoFrame::Builder().set_video_frame_buffer(changed_buffer).build());
+  time_controller.AdvanceTime(TimeDelta::Millis(33));
+
+  EXPECT_THAT(update_rects,
+              ElementsAre(VideoFrame::UpdateRect{0, 0, 64, 64},
+                          VideoFrame::UpdateRect{0, 0, 0, 0},
+                          VideoFrame::UpdateRect{32, 32, 32, 32}));
+}
+
+TEST(FrameCadenceAdapterTest, ContentAwareModeSkipsStaticFrames) {
+  metrics::Reset();
+  test::ScopedKeyValueConfig field_trials(
+      "WebRTC-FrameCadenceAdapter-ContentAware/Enabled/");
+  GlobalSimulatedTimeController time_controller(Timestamp::Zero());
+  auto adapter = CreateAdapter(field_trials, time_controller.GetClock());
+  MockCallback callback;
+  adapter->Initialize(&callback);
+
+  // The first frame and three unchanged frames are passed on. The rest of the
+  // unchanged frames within the idle repeat period are skipped, without being
+  // reported as discarded.
+  EXPECT_CALL(callback, OnFrame).Times(4);
+  EXPECT_CALL(callback, OnDiscardedFrame).Times(0);
+  for (int i = 0; i != 10; ++i) {
+    adapter->OnFrame(CreateFrameWithContent(0));
+    time_controller.AdvanceTime(TimeDelta::Millis(33));
+  }
+  Mock::VerifyAndClearExpectations(&callback);
+
+  // One unchanged frame per idle repeat period is still passed on.
+  EXPECT_CALL(callback, OnFrame).Times(1);
+  EXPECT_CALL(callback, OnDiscardedFrame).Times(0);
+  time_controller.AdvanceTime(
+      FrameCadenceAdapterInterface::kZeroHertzIdleRepeatRatePeriod);
+  adapter->OnFrame(CreateFrameWithContent(0));
+  time_controller.AdvanceTime(TimeDelta::Millis(33));
+  Mock::VerifyAndClearExpectations(&callback);
+
+  // Changed frames are always passed on.
+  EXPECT_CALL(callback, OnFrame).Times(1);
+  adapter->OnFrame(CreateFrameWithContent(1));
+  time_controller.AdvanceTime(TimeDelta::Millis(33));
+
+  // 6 of the 12 frames were skipped.
+  adapter = nullptr;
+  EXPECT_THAT(
+      metrics::Samples(
+          "WebRTC.Video.FrameCadenceAdapter.StaticFramesSkippedPercent"),
+      ElementsAre(Pair(50, 1)));
+}
+
 class FrameCadenceAdapterSimulcastLayersParamTest
     : public ::testing::TestWithParam<int> {
  public:
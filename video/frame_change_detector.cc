@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/frame_change_detector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+// A block row is hashed as up to four 64-bit words, each with its own
+// accumulator. The lanes don't depend on each other, so the multiplications of
+// a row are pipelined (or vectorized, where 64-bit multiplies are available).
+constexpr int kLanes = 4;
+constexpr int kMaxRowBytes = kLanes * sizeof(uint64_t);
+static_assert(FrameChangeDetector::kBlockSize == kMaxRowBytes);
+
+// The primes and seeds of xxHash64.
+constexpr uint64_t kPrime1 = 0x9e3779b185ebca87;
+constexpr uint64_t kPrime2 = 0xc2b2ae3d27d4eb4f;
+constexpr uint64_t kPrime3 = 0x165667b19e3779f9;
+constexpr uint64_t kSeeds[kLanes] = {kPrime1 + kPrime2, kPrime2, 0,
+                                     0 - kPrime1};
+
+uint64_t RotateLeft(uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// The xxHash64 round. Multiplications only carry changes towards the high
+// bits, so the rotation brings them back down before the next word is mixed
+// in; without it, changes to the top bits of two words of a lane cancel out.
+uint64_t Round(uint64_t lane, uint64_t word) {
+  return RotateLeft(lane + word * kPrime2, 31) * kPrime1;
+}
+
+// The xxHash64 finalizer, which makes every bit of the hash depend on every
+// bit of `hash`.
+uint64_t Avalanche(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+// Hashes `rows` rows of `row_bytes` bytes starting at `data`. A change to a
+// single word is always detected, since each round is a bijection of both the
+// lane and the word. Other changes go undetected only if the hashes collide.
+uint64_t HashBlock(const uint8_t* data, int stride, int row_bytes, int rows) {
+  RTC_DCHECK_LE(row_bytes, kMaxRowBytes);
+  uint64_t lanes[kLanes] = {kSeeds[0], kSeeds[1], kSeeds[2], kSeeds[3]};
+  uint64_t words[kLanes] = {};
+  for (int y = 0; y < rows; ++y, data += stride) {
+    if (row_bytes == kMaxRowBytes) {
+      memcpy(words, data, kMaxRowBytes);
+    } else {
+      memset(words, 0, sizeof(words));
+      memcpy(words, data, row_bytes);
+    }
+    for (int lane = 0; lane < kLanes; ++lane) {
+      lanes[lane] = Round(lanes[lane], words[lane]);
+    }
+  }
+  return Avalanche(RotateLeft(lanes[0], 1) + RotateLeft(lanes[1], 7) +
+                   RotateLeft(lanes[2], 12) + RotateLeft(lanes[3], 18));
+}
+
+}  // namespace
+
+std::optional<VideoFrame::UpdateRect> FrameChangeDetector::DetectChanges(
+    const VideoFrameBuffer& buffer) {
+  const VideoFrameBuffer::Type type = buffer.type();
+  if (type != VideoFrameBuffer::Type::kI420 &&
+      type != VideoFrameBuffer::Type::kNV12) {
+    Reset();
+    return std::nullopt;
+  }
+  const int width = buffer.width();
+  const int height = buffer.height();
+  const int blocks_x = (width + kBlockSize - 1) / kBlockSize;
+  const int blocks_y = (height + kBlockSize - 1) / kBlockSize;
+  new_block_hashes_.resize(blocks_x * blocks_y);
+
+  // Each luma block is hashed together with the co-located chroma samples.
+  constexpr int kChromaBlockSize = kBlockSize / 2;
+  const I420BufferInterface* i420 =
+      type == VideoFrameBuffer::Type::kI420 ? buffer.GetI420() : nullptr;
+  const NV12BufferInterface* nv12 =
+      type == VideoFrameBuffer::Type::kNV12 ? buffer.GetNV12() : nullptr;
+  const int chroma_width = (width + 1) / 2;
+  const int chroma_height = (height + 1) / 2;
+  for (int by = 0; by < blocks_y; ++by) {
+    const int y = by * kBlockSize;
+    const int rows = std::min(kBlockSize, height - y);
+    const int chroma_y = by * kChromaBlockSize;
+    const int chroma_rows =
+        std::min(kChromaBlockSize, chroma_height - chroma_y);
+    for (int bx = 0; bx < blocks_x; ++bx) {
+      const int x = bx * kBlockSize;
+      const int columns = std::min(kBlockSize, width - x);
+      const int chroma_x = bx * kChromaBlockSize;
+      const int chroma_columns =
+          std::min(kChromaBlockSize, chroma_width - chroma_x);
+      uint64_t hash;
+      if (i420) {
+        hash = HashBlock(i420->DataY() + y * i420->StrideY() + x,
+                         i420->StrideY(), columns, rows);
+        hash ^= RotateLeft(
+            HashBlock(i420->DataU() + chroma_y * i420->StrideU() + chroma_x,
+                      i420->StrideU(), chroma_columns, chroma_rows),
+            21);
+        hash ^= RotateLeft(
+            HashBlock(i420->DataV() + chroma_y * i420->StrideV() + chroma_x,
+                      i420->StrideV(), chroma_columns, chroma_rows),
+            42);
+      } else {
+        hash = HashBlock(nv12->DataY() + y * nv12->StrideY() + x,
+                         nv12->StrideY(), columns, rows);
+        hash ^= RotateLeft(
+            HashBlock(nv12->DataUV() + chroma_y * nv12->StrideUV() +
+                          2 * chroma_x,
+                      nv12->StrideUV(), 2 * chroma_columns, chroma_rows),
+            21);
+      }
+      new_block_hashes_[by * blocks_x + bx] = hash;
+    }
+  }
+
+  VideoFrame::UpdateRect update_rect;
+  if (width != width_ || height != height_ || type != type_) {
+    update_rect = VideoFrame::UpdateRect{0, 0, width, height};
+  } else {
+    for (int by = 0; by < blocks_y; ++by) {
+      for (int bx = 0; bx < blocks_x; ++bx) {
+        int index = by * blocks_x + bx;
+        if (new_block_hashes_[index] == block_hashes_[index]) {
+          continue;
+        }
+        const int x = bx * kBlockSize;
+        const int y = by * kBlockSize;
+        update_rect.Union(VideoFrame::UpdateRect{
+            x, y, std::min(kBlockSize, width - x),
+            std::min(kBlockSize, height - y)});
+      }
+    }
+  }
+  width_ = width;
+  height_ = height;
+  type_ = type;
+  std::swap(block_hashes_, new_block_hashes_);
+  return update_rect;
+}
+
+void FrameChangeDetector::Reset() {
+  width_ = 0;
+  height_ = 0;
+  type_ = VideoFrameBuffer::Type::kNative;
+  block_hashes_.clear();
+}
+
+}  // namespace webrtc
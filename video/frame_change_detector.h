@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_FRAME_CHANGE_DETECTOR_H_
+#define VIDEO_FRAME_CHANGE_DETECTOR_H_
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
+
+namespace webrtc {
+
+// Finds the region that changed between consecutive frames, for sources that
+// don't provide an update rect themselves. Like the block differ used by
+// DesktopCapturerDifferWrapper, frames are split in square blocks, but rather
+// than keeping the previous frame around (which could starve the capturer's
+// buffer pool) a 64-bit hash of every block is kept and compared. A changed
+// block is missed only if its hashes collide, which for arbitrary changes
+// happens with a probability of about 2^-64.
+class FrameChangeDetector {
+ public:
+  // Size in luma pixels of the square blocks that are compared.
+  static constexpr int kBlockSize = 32;
+
+  // Returns the bounding box of the blocks of `buffer` that differ from the
+  // buffer passed in the previous call, or the full frame if the previous
+  // buffer had a different resolution or pixel format. Returns nullopt, and
+  // forgets the previous buffer, if the pixel format of `buffer` isn't
+  // supported (only I420 and NV12 are).
+  std::optional<VideoFrame::UpdateRect> DetectChanges(
+      const VideoFrameBuffer& buffer);
+
+  // Forgets the previous buffer, so that the next call to DetectChanges()
+  // reports the full frame as changed.
+  void Reset();
+
+ private:
+  int width_ = 0;
+  int height_ = 0;
+  VideoFrameBuffer::Type type_ = VideoFrameBuffer::Type::kNative;
+  std::vector<uint64_t> block_hashes_;
+  std::vector<uint64_t> new_block_hashes_;
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_FRAME_CHANGE_DETECTOR_H_
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <optional>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "benchmark/benchmark.h"
+#include "video/frame_change_detector.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kWidth = 3840;
+constexpr int kHeight = 2160;
+
+// A mostly static 4K screen share: a document with some text, where only a
+// small region (e.g. a blinking cursor) changes from one frame to the next.
+scoped_refptr<I420Buffer> CreateScreen() {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(kWidth, kHeight);
+  I420Buffer::SetBlack(buffer.get());
+  for (int y = 0; y < kHeight; ++y) {
+    uint8_t* row = buffer->MutableDataY() + y * buffer->StrideY();
+    for (int x = 0; x < kWidth; ++x) {
+      row[x] = ((x / 7) ^ (y / 11)) & 1 ? 235 : 16;
+    }
+  }
+  return buffer;
+}
+
+void ReportPixelRate(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * kWidth * kHeight * 3 / 2);
+}
+
+void BM_DetectChangesStatic4K(benchmark::State& state) {
+  scoped_refptr<I420Buffer> screen = CreateScreen();
+  FrameChangeDetector detector;
+  detector.DetectChanges(*screen);
+  for (auto _ : state) {
+    std::optional<VideoFrame::UpdateRect> update_rect =
+        detector.DetectChanges(*screen);
+    benchmark::DoNotOptimize(update_rect);
+  }
+  ReportPixelRate(state);
+}
+
+void BM_DetectChangesCursor4K(benchmark::State& state) {
+  scoped_refptr<I420Buffer> screen = CreateScreen();
+  FrameChangeDetector detector;
+  detector.DetectChanges(*screen);
+  int frame = 0;
+  for (auto _ : state) {
+    // Toggle a 2x20 cursor at a fixed position.
+    uint8_t value = (frame++ & 1) ? 0 : 255;
+    for (int y = 1000; y < 1020; ++y) {
+      uint8_t* row = screen->MutableDataY() + y * screen->StrideY();
+      row[1900] = row[1901] = value;
+    }
+    std::optional<VideoFrame::UpdateRect> update_rect =
+        detector.DetectChanges(*screen);
+    benchmark::DoNotOptimize(update_rect);
+  }
+  ReportPixelRate(state);
+}
+
+void BM_DetectChangesFullFrame4K(benchmark::State& state) {
+  scoped_refptr<I420Buffer> screens[] = {CreateScreen(), CreateScreen()};
+  I420Buffer::SetBlack(screens[1].get());
+  FrameChangeDetector detector;
+  int frame = 0;
+  for (auto _ : state) {
+    std::optional<VideoFrame::UpdateRect> update_rect =
+        detector.DetectChanges(*screens[frame++ & 1]);
+    benchmark::DoNotOptimize(update_rect);
+  }
+  ReportPixelRate(state);
+}
+
+BENCHMARK(BM_DetectChangesStatic4K);
+BENCHMARK(BM_DetectChangesCursor4K);
+BENCHMARK(BM_DetectChangesFullFrame4K);
+
+}  // namespace
+}  // namespace webrtc
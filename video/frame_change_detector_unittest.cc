@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/frame_change_detector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i010_buffer.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "api/video/video_frame.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using UpdateRect = VideoFrame::UpdateRect;
+
+scoped_refptr<I420Buffer> CreateI420(int width, int height) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  I420Buffer::SetBlack(buffer.get());
+  return buffer;
+}
+
+TEST(FrameChangeDetectorTest, ReportsFullFrameForFirstFrame) {
+  FrameChangeDetector detector;
+  EXPECT_EQ(detector.DetectChanges(*CreateI420(100, 50)),
+            (UpdateRect{0, 0, 100, 50}));
+}
+
+TEST(FrameChangeDetectorTest, ReportsEmptyRectForIdenticalFrames) {
+  FrameChangeDetector detector;
+  detector.DetectChanges(*CreateI420(100, 50));
+  std::optional<UpdateRect> update_rect =
+      detector.DetectChanges(*CreateI420(100, 50));
+  ASSERT_TRUE(update_rect);
+  EXPECT_TRUE(update_rect->IsEmpty());
+}
+
+TEST(FrameChangeDetectorTest, ReportsChangedBlocks) {
+  FrameChangeDetector detector;
+  detector.DetectChanges(*CreateI420(100, 70));
+
+  scoped_refptr<I420Buffer> changed = CreateI420(100, 70);
+  // Luma change in the second block of the first block row.
+  changed->MutableDataY()[5 * changed->StrideY() + 40] = 255;
+  // Chroma change in the last, partial, block of the last block row.
+  changed->MutableDataV()[33 * changed->StrideV() + 49] = 0;
+  EXPECT_EQ(detector.DetectChanges(*changed), (UpdateRect{32, 0, 68, 70}));
+}
+
+TEST(FrameChangeDetectorTest, DetectsChangesToTopBitsOfSeveralRows) {
+  FrameChangeDetector detector;
+  detector.DetectChanges(*CreateI420(64, 64));
+
+  // Flip the top bit of the same 64-bit word in two rows of the first block,
+  // and of two words in the same row of the second block.
+  scoped_refptr<I420Buffer> changed = CreateI420(64, 64);
+  changed->MutableDataY()[7] ^= 0x80;
+  changed->MutableDataY()[changed->StrideY() + 7] ^= 0x80;
+  changed->MutableDataY()[32 + 15] ^= 0x80;
+  changed->MutableDataY()[32 + 23] ^= 0x80;
+  EXPECT_EQ(detector.DetectChanges(*changed), (UpdateRect{0, 0, 64, 32}));
+}
+
+TEST(FrameChangeDetectorTest, DetectsChangesInNV12) {
+  FrameChangeDetector detector;
+  scoped_refptr<NV12Buffer> buffer = NV12Buffer::Create(64, 64);
+  memset(buffer->MutableDataY(), 16, buffer->StrideY() * 64);
+  memset(buffer->MutableDataUV(), 128, buffer->StrideUV() * 32);
+  detector.DetectChanges(*buffer);
+
+  // Change the V sample of the top right chroma block.
+  buffer->MutableDataUV()[2 * 20 + 1] = 0;
+  EXPECT_EQ(detector.DetectChanges(*buffer), (UpdateRect{32, 0, 32, 32}));
+}
+
+TEST(FrameChangeDetectorTest, ReportsFullFrameOnResolutionChange) {
+  FrameChangeDetector detector;
+  detector.DetectChanges(*CreateI420(64, 64));
+  EXPECT_EQ(detector.DetectChanges(*CreateI420(64, 32)),
+            (UpdateRect{0, 0, 64, 32}));
+}
+
+TEST(FrameChangeDetectorTest, ReportsFullFrameAfterReset) {
+  FrameChangeDetector detector;
+  detector.DetectChanges(*CreateI420(64, 64));
+  detector.Reset();
+  EXPECT_EQ(detector.DetectChanges(*CreateI420(64, 64)),
+            (UpdateRect{0, 0, 64, 64}));
+}
+
+TEST(FrameChangeDetectorTest, DoesNotSupportOtherFormats) {
+  FrameChangeDetector detector;
+  EXPECT_EQ(detector.DetectChanges(*I010Buffer::Create(64, 64)), std::nullopt);
+}
+
+}  // namespace
+}  // namespace webrtc
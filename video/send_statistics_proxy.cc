@@ -147,6 +147,7 @@ SendStatisticsProxy::SendStatisticsProxy(
       content_type_(content_type),
       start_ms_(clock->TimeInMilliseconds()),
       encode_time_(kEncodeTimeWeigthFactor),
+      encode_queueing_delay_(kEncodeTimeWeigthFactor),
       quality_limitation_reason_tracker_(clock_),
       media_byte_rate_tracker_(kBucketSizeMs, kBucketCount),
       encoded_frame_rate_tracker_(kBucketSizeMs, kBucketCount),
@@ -1289,6 +1290,16 @@ void SendStatisticsProxy::OnEncoderInternalScalerUpdate(bool is_scaled) {
   UpdateAdaptationStats();
 }
 
+void SendStatisticsProxy::OnEncodeQueueingDelayMeasured(
+    TimeDelta queueing_delay) {
+  RTC_DCHECK_GE(queueing_delay, TimeDelta::Zero());
+  MutexLock lock(&mutex_);
+  encode_queueing_delay_.Apply(1.0f, queueing_delay.ms<float>());
+  stats_.avg_encode_queueing_delay_ms =
+      std::round(encode_queueing_delay_.filtered());
+  stats_.total_encode_queueing_delay += queueing_delay;
+}
+
 // TODO(asapersson): Include fps changes.
 void SendStatisticsProxy::OnInitialQualityResolutionAdaptDown() {
   MutexLock lock(&mutex_);
@@ -98,6 +98,8 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
 
   void OnEncoderInternalScalerUpdate(bool is_scaled) override;
 
+  void OnEncodeQueueingDelayMeasured(TimeDelta queueing_delay) override;
+
   void OnMinPixelLimitReached() override;
   void OnInitialQualityResolutionAdaptDown() override;
 
@@ -312,6 +314,7 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
   const int64_t start_ms_;
   VideoSendStream::Stats stats_ RTC_GUARDED_BY(mutex_);
   ExpFilter encode_time_ RTC_GUARDED_BY(mutex_);
+  ExpFilter encode_queueing_delay_ RTC_GUARDED_BY(mutex_);
   QualityLimitationReasonTracker quality_limitation_reason_tracker_
       RTC_GUARDED_BY(mutex_);
   RateTracker media_byte_rate_tracker_ RTC_GUARDED_BY(mutex_);
@@ -361,6 +361,15 @@ TEST_F(SendStatisticsProxyTest, OnEncodedFrameTimeMeasured) {
   EXPECT_EQ(encode_usage_percent, stats.encode_usage_percent);
 }
 
+TEST_F(SendStatisticsProxyTest, OnEncodeQueueingDelayMeasured) {
+  statistics_proxy_->OnEncodeQueueingDelayMeasured(TimeDelta::Millis(7));
+  statistics_proxy_->OnEncodeQueueingDelayMeasured(TimeDelta::Millis(7));
+
+  VideoSendStream::Stats stats = statistics_proxy_->GetStats();
+  EXPECT_EQ(stats.avg_encode_queueing_delay_ms, 7);
+  EXPECT_EQ(stats.total_encode_queueing_delay, TimeDelta::Millis(14));
+}
+
 TEST_F(SendStatisticsProxyTest, TotalEncodeTimeIncreasesPerFrameMeasured) {
   const int kEncodeUsagePercent = 0;  // Don't care for this test.
   EXPECT_EQ(0u, statistics_proxy_->GetStats().total_encode_time_ms);
@@ -87,6 +87,7 @@
 #include "video/adaptation/overuse_frame_detector.h"
 #include "video/adaptation/video_stream_encoder_resource_manager.h"
 #include "video/alignment_adjuster.h"
+#include "video/async_encoder.h"
 #include "video/config/encoder_stream_factory.h"
 #include "video/config/video_encoder_config.h"
 #include "video/corruption_detection/frame_instrumentation_generator.h"
@@ -1034,9 +1035,12 @@ void VideoStreamEncoder::ReconfigureEncoder() {
     // supports only single instance of encoder of given type.
     encoder_.reset();
 
-    encoder_ = MaybeCreateFrameDumpingEncoderWrapper(
-        settings_.encoder_factory->Create(env_, encoder_config_.video_format),
-        env_.field_trials());
+    encoder_ = MaybeCreateAsyncEncoderWrapper(
+        MaybeCreateFrameDumpingEncoderWrapper(
+            settings_.encoder_factory->Create(env_,
+                                              encoder_config_.video_format),
+            env_.field_trials()),
+        env_, encoder_stats_observer_);
     if (!encoder_) {
       RTC_LOG(LS_ERROR) << "CreateVideoEncoder failed, failing encoder format: "
                         << encoder_config_.video_format.ToString();
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "api/units/time_delta.h"
 #include "api/video/video_adaptation_counters.h"
 #include "api/video/video_adaptation_reason.h"
 #include "api/video/video_bitrate_allocation.h"
@@ -108,6 +109,10 @@ class VideoStreamEncoderObserver : public CpuOveruseMetricsObserver {
   // down.
   virtual void OnEncoderInternalScalerUpdate(bool is_scaled) {}
 
+  // Time that a frame spent queued for an encoder that runs asynchronously
+  // from VideoStreamEncoder, before encoding of it started.
+  virtual void OnEncodeQueueingDelayMeasured(TimeDelta queueing_delay) {}
+
   // TODO(bugs.webrtc.org/14246): VideoStreamEncoder wants to query the stats,
   // which makes this not a pure observer. GetInputFrameRate is needed for the
   // cpu adaptation, so can be deleted if that responsibility is moved out to a